@@ -62,6 +62,12 @@ PXR_NAMESPACE_OPEN_SCOPE
     ((SerializedUsdEditsLocation, "mayaUsd_SerializedUsdEditsLocation")) \
     /* optionVar to force a prompt on every save                    */ \
     ((SerializedUsdEditsLocationPrompt, "mayaUsd_SerializedUsdEditsLocationPrompt")) \
+    /* Format of the Usd edits serialized to Maya string attributes.  */ \
+    /* optionVar values are:                                        */ \
+    /*    0: usda text (the default).                               */ \
+    /*    1: usdc binary.                                           */ \
+    /*    2: usdc binary, LZ4-compressed.                           */ \
+    ((SerializedUsdEditsFormat, "mayaUsd_SerializedUsdEditsFormat")) \
     /* optionVar to control if comfirmation dialog will be show when overriding file */ \
     ((ConfirmExistingFileSave, "mayaUsd_ConfirmExistingFileSave"))     \
     /* optionVar to turn on or off async texture loading            */ \
@@ -103,6 +103,10 @@ MSyntax MayaUSDExportCommand::createSyntax()
         kNormalizeNurbsFlag,
         UsdMayaJobExportArgsTokens->normalizeNurbs.GetText(),
         MSyntax::kBoolean);
+    syntax.addFlag(
+        kParallelWriteFlag,
+        UsdMayaJobExportArgsTokens->parallelWrite.GetText(),
+        MSyntax::kBoolean);
     syntax.addFlag(
         kPreserveUVSetNamesFlag,
         UsdMayaJobExportArgsTokens->preserveUVSetNames.GetText(),
@@ -211,6 +215,16 @@ MSyntax MayaUSDExportCommand::createSyntax()
         kStaticSingleSample,
         UsdMayaJobExportArgsTokens->staticSingleSample.GetText(),
         MSyntax::kBoolean);
+    syntax.addFlag(
+        kTimeSampleTolerance,
+        UsdMayaJobExportArgsTokens->timeSampleTolerance.GetText(),
+        MSyntax::kDouble);
+    syntax.addFlag(
+        kStreamingChunkSize,
+        UsdMayaJobExportArgsTokens->streamingChunkSize.GetText(),
+        MSyntax::kDouble);
+    syntax.addFlag(
+        kPerfReportFlag, UsdMayaJobExportArgsTokens->perfReport.GetText(), MSyntax::kString);
     syntax.addFlag(
         kGeomSidednessFlag, UsdMayaJobExportArgsTokens->geomSidedness.GetText(), MSyntax::kString);
 
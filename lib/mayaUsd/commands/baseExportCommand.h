@@ -66,6 +66,7 @@ public:
     static constexpr auto kMaterialCollectionsPathFlag = "mcp";
     static constexpr auto kExportCollectionBasedBindingsFlag = "cbb";
     static constexpr auto kNormalizeNurbsFlag = "nnu";
+    static constexpr auto kParallelWriteFlag = "pw";
     static constexpr auto kPreserveUVSetNamesFlag = "puv";
     static constexpr auto kReferenceObjectModeFlag = "rom";
     static constexpr auto kExportRootsFlag = "ert";
@@ -87,6 +88,9 @@ public:
     static constexpr auto kPythonPostCallbackFlag = "ppc";
     static constexpr auto kVerboseFlag = "v";
     static constexpr auto kStaticSingleSample = "sss";
+    static constexpr auto kTimeSampleTolerance = "tst";
+    static constexpr auto kStreamingChunkSize = "scs";
+    static constexpr auto kPerfReportFlag = "prf";
     static constexpr auto kGeomSidednessFlag = "gs";
     static constexpr auto kApiSchemaFlag = "api";
     static constexpr auto kJobContextFlag = "jc";
@@ -109,6 +109,11 @@ MSyntax MayaUSDImportCommand::createSyntax()
         UsdMayaJobImportArgsTokens->applyEulerFilter.GetText(),
         MSyntax::kBoolean);
 
+    syntax.addFlag(
+        kParallelReadFlag, UsdMayaJobImportArgsTokens->parallelRead.GetText(), MSyntax::kBoolean);
+    syntax.addFlag(
+        kPerfReportFlag, UsdMayaJobImportArgsTokens->perfReport.GetText(), MSyntax::kString);
+
     // These are additional flags under our control.
     syntax.addFlag(kFileFlag, kFileFlagLong, MSyntax::kString);
     syntax.addFlag(kParentFlag, kParentFlagLong, MSyntax::kString);
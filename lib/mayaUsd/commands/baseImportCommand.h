@@ -55,6 +55,8 @@ public:
     static constexpr auto kImportChaserFlag = "chr";
     static constexpr auto kImportChaserArgsFlag = "cha";
     static constexpr auto kApplyEulerFilterFlag = "aef";
+    static constexpr auto kParallelReadFlag = "prd";
+    static constexpr auto kPerfReportFlag = "prf";
 
     // Short and Long forms of flags defined by this command itself:
     static constexpr auto kFileFlag = "f";
@@ -16,10 +16,153 @@
 
 #include "flexibleSparseValueWriter.h"
 
+#include <mayaUsdUtils/DiffCore.h>
+
+#include <pxr/base/gf/vec3d.h>
+#include <pxr/base/gf/vec3f.h>
+#include <pxr/base/vt/array.h>
+#include <pxr/base/vt/types.h>
+#include <pxr/usd/usdGeom/tokens.h>
+
+#include <algorithm>
+
 PXR_NAMESPACE_OPEN_SCOPE
 
-FlexibleSparseValueWriter::FlexibleSparseValueWriter(bool writeDefaults)
-    : _writeDefaults(writeDefaults)
+namespace {
+
+// Upper bound on the number of consecutive samples that can be dropped,
+// which bounds the memory held per attribute and the cost of re-validating
+// the dropped samples each time a new one comes in.
+constexpr size_t kMaxSkippedSamples = 64;
+
+// Retrieves the floating-point components of the value, if it holds a type
+// that USD interpolates linearly component by component.
+bool getComponents(const VtValue& value, const float** data, size_t* count)
+{
+    if (value.IsHolding<VtVec3fArray>()) {
+        const VtVec3fArray& array = value.UncheckedGet<VtVec3fArray>();
+        *data = array.empty() ? nullptr : array.cdata()->data();
+        *count = array.size() * 3;
+    } else if (value.IsHolding<VtFloatArray>()) {
+        const VtFloatArray& array = value.UncheckedGet<VtFloatArray>();
+        *data = array.cdata();
+        *count = array.size();
+    } else if (value.IsHolding<GfVec3f>()) {
+        *data = value.UncheckedGet<GfVec3f>().data();
+        *count = 3;
+    } else if (value.IsHolding<float>()) {
+        *data = &value.UncheckedGet<float>();
+        *count = 1;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+bool getComponents(const VtValue& value, const double** data, size_t* count)
+{
+    if (value.IsHolding<VtVec3dArray>()) {
+        const VtVec3dArray& array = value.UncheckedGet<VtVec3dArray>();
+        *data = array.empty() ? nullptr : array.cdata()->data();
+        *count = array.size() * 3;
+    } else if (value.IsHolding<VtDoubleArray>()) {
+        const VtDoubleArray& array = value.UncheckedGet<VtDoubleArray>();
+        *data = array.cdata();
+        *count = array.size();
+    } else if (value.IsHolding<GfVec3d>()) {
+        *data = value.UncheckedGet<GfVec3d>().data();
+        *count = 3;
+    } else if (value.IsHolding<double>()) {
+        *data = &value.UncheckedGet<double>();
+        *count = 1;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+// Extents must bound the geometry at every time. An interpolated extent is
+// not guaranteed to bound the interpolated points, so extents keep all the
+// samples that the points or transforms they bound may have kept.
+bool isExtent(const UsdAttribute& attr)
+{
+    const TfToken& name = attr.GetName();
+    return name == UsdGeomTokens->extent || name == UsdGeomTokens->extentsHint;
+}
+
+bool isInterpolatable(const UsdAttribute& attr, const VtValue& value)
+{
+    if (isExtent(attr)) {
+        return false;
+    }
+
+    const float*  floats = nullptr;
+    const double* doubles = nullptr;
+    size_t        count = 0;
+    return getComponents(value, &floats, &count) || getComponents(value, &doubles, &count);
+}
+
+template <typename Scalar>
+bool isLinearInterpolation(
+    const VtValue& start,
+    const VtValue& end,
+    const VtValue& value,
+    double         t,
+    double         tolerance)
+{
+    const Scalar* startData = nullptr;
+    const Scalar* endData = nullptr;
+    const Scalar* valueData = nullptr;
+    size_t        startCount = 0;
+    size_t        endCount = 0;
+    size_t        valueCount = 0;
+    if (!getComponents(start, &startData, &startCount) || !getComponents(end, &endData, &endCount)
+        || !getComponents(value, &valueData, &valueCount)) {
+        return false;
+    }
+
+    // USD only interpolates arrays of the same size, otherwise it holds the
+    // earlier sample.
+    if (startCount != endCount || startCount != valueCount) {
+        return false;
+    }
+
+    return MayaUsdUtils::isLinearInterpolation(
+        startData, endData, valueData, valueCount, Scalar(t), Scalar(tolerance));
+}
+
+// Whether the sample can be reconstructed by linearly interpolating between
+// the start and end samples.
+bool isLinearInterpolation(
+    const UsdTimeCode& startTime,
+    const VtValue&     start,
+    const UsdTimeCode& endTime,
+    const VtValue&     end,
+    const UsdTimeCode& time,
+    const VtValue&     value,
+    double             tolerance)
+{
+    if (start.GetType() != value.GetType() || end.GetType() != value.GetType()) {
+        return false;
+    }
+
+    const double span = endTime.GetValue() - startTime.GetValue();
+    if (span <= 0.0) {
+        return false;
+    }
+
+    const double t = (time.GetValue() - startTime.GetValue()) / span;
+    return isLinearInterpolation<float>(start, end, value, t, tolerance)
+        || isLinearInterpolation<double>(start, end, value, t, tolerance);
+}
+
+} // namespace
+
+FlexibleSparseValueWriter::FlexibleSparseValueWriter(
+    bool   writeDefaults,
+    double interpolationTolerance)
+    : _interpolationTolerance(interpolationTolerance)
+    , _writeDefaults(writeDefaults)
 {
 }
 
@@ -32,6 +175,10 @@ bool FlexibleSparseValueWriter::SetAttribute(
     // then write the value directly on the attribute, skipping the sparse writer.
     if (_writeDefaults && time.IsDefault()) {
         return attr.Set(value, time);
+    } else if (_interpolationTolerance > 0.0 && !time.IsDefault()
+               && isInterpolatable(attr, value)) {
+        VtValue heldValue = value;
+        return _SetInterpolatedAttribute(attr, &heldValue, time);
     } else {
         return _sparseWriter.SetAttribute(attr, value, time);
     }
@@ -46,9 +193,81 @@ bool FlexibleSparseValueWriter::SetAttribute(
     // then write the value directly on the attribute, skipping the sparse writer.
     if (_writeDefaults && time.IsDefault()) {
         return attr.Set(*value, time);
+    } else if (_interpolationTolerance > 0.0 && !time.IsDefault()
+               && isInterpolatable(attr, *value)) {
+        return _SetInterpolatedAttribute(attr, value, time);
     } else {
         return _sparseWriter.SetAttribute(attr, value, time);
     }
 }
 
+bool FlexibleSparseValueWriter::_SetInterpolatedAttribute(
+    const UsdAttribute& attr,
+    VtValue*            value,
+    UsdTimeCode         time)
+{
+    _HeldSamples& held = _heldSamples[attr.GetPath()];
+    held.attr = attr;
+
+    _TimeSample sample { time, VtValue() };
+    sample.value.Swap(*value);
+
+    // The first sample is always written.
+    if (!held.hasKey) {
+        held.key = std::move(sample);
+        held.hasKey = true;
+        return _sparseWriter.SetAttribute(attr, held.key.value, held.key.time);
+    }
+
+    if (!held.hasPending) {
+        held.pending = std::move(sample);
+        held.hasPending = true;
+        return true;
+    }
+
+    // The pending sample can be dropped if it, and all the samples dropped
+    // before it, are reproduced by interpolating between the key and the
+    // new sample.
+    const auto isReproduced = [&](const _TimeSample& skipped) {
+        return isLinearInterpolation(
+            held.key.time,
+            held.key.value,
+            sample.time,
+            sample.value,
+            skipped.time,
+            skipped.value,
+            _interpolationTolerance);
+    };
+    const bool canDropPending = held.skipped.size() < kMaxSkippedSamples
+        && isReproduced(held.pending)
+        && std::all_of(held.skipped.begin(), held.skipped.end(), isReproduced);
+
+    if (canDropPending) {
+        held.skipped.push_back(std::move(held.pending));
+        held.pending = std::move(sample);
+        return true;
+    }
+
+    // The pending sample becomes the new key. The key value is kept, so it is
+    // not swapped into the sparse writer.
+    held.skipped.clear();
+    held.key = std::move(held.pending);
+    held.pending = std::move(sample);
+    return _sparseWriter.SetAttribute(attr, held.key.value, held.key.time);
+}
+
+bool FlexibleSparseValueWriter::Flush()
+{
+    bool success = true;
+    for (auto& entry : _heldSamples) {
+        _HeldSamples& held = entry.second;
+        if (held.hasPending) {
+            success &= _sparseWriter.SetAttribute(
+                held.attr, &held.pending.value, held.pending.time);
+        }
+    }
+    _heldSamples.clear();
+    return success;
+}
+
 PXR_NAMESPACE_CLOSE_SCOPE
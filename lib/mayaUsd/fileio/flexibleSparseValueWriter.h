@@ -22,8 +22,12 @@
 #include <pxr/pxr.h>
 #include <pxr/usd/usd/attribute.h>
 #include <pxr/usd/usd/timeCode.h>
+#include <pxr/usd/sdf/path.h>
 #include <pxr/usd/usdUtils/sparseValueWriter.h>
 
+#include <unordered_map>
+#include <vector>
+
 PXR_NAMESPACE_OPEN_SCOPE
 
 /// Flexible spare value writer.
@@ -32,11 +36,18 @@ PXR_NAMESPACE_OPEN_SCOPE
 /// This is necessary in some cases, for example to author a layer that will override
 /// a value back to its default. Another example is during edit-as-Maya / merge-to-USD
 /// where we need to author default values in case the original value was not the default.
+///
+/// Optionally, time-samples of floating-point scalars, vectors and arrays that can be
+/// reconstructed within a tolerance by linearly interpolating their neighbouring samples
+/// are dropped as well. Since that can only be decided once the next sample is known,
+/// the last sample of each attribute is held back until Flush() is called.
 class MAYAUSD_CORE_PUBLIC FlexibleSparseValueWriter
 {
 public:
-    /// Constructor taking a flag to decide if default values at default time should be written.
-    FlexibleSparseValueWriter(bool writeDefaults = true);
+    /// Constructor taking a flag to decide if default values at default time should be written
+    /// and the tolerance used to drop interpolated time-samples. A tolerance of zero or less
+    /// disables the interpolation check.
+    FlexibleSparseValueWriter(bool writeDefaults = true, double interpolationTolerance = 0.0);
 
     FlexibleSparseValueWriter(const FlexibleSparseValueWriter&) = delete;
     FlexibleSparseValueWriter& operator=(const FlexibleSparseValueWriter&) = delete;
@@ -72,13 +83,46 @@ public:
         return SetAttribute(attr, &val, time);
     }
 
-    /// Clears the internal map, thereby releasing all the memory used by
-    /// the sparse value-writers.
-    void Clear() { _sparseWriter.Clear(); }
+    /// Writes the time-samples held back by the interpolation check. Must be
+    /// called once all time-samples have been set.
+    bool Flush();
+
+    /// Writes the held-back time-samples and clears the internal map, thereby
+    /// releasing all the memory used by the sparse value-writers.
+    void Clear()
+    {
+        Flush();
+        _sparseWriter.Clear();
+    }
 
 private:
-    UsdUtilsSparseValueWriter _sparseWriter;
-    bool                      _writeDefaults;
+    bool _SetInterpolatedAttribute(const UsdAttribute& attr, VtValue* value, UsdTimeCode time);
+
+    struct _TimeSample
+    {
+        UsdTimeCode time;
+        VtValue     value;
+    };
+
+    /// Samples of an attribute that have not been handed to the sparse writer.
+    struct _HeldSamples
+    {
+        UsdAttribute attr;
+        /// The last sample handed to the sparse writer.
+        _TimeSample key;
+        bool        hasKey = false;
+        /// Samples after the key that are reproduced by interpolating
+        /// between the key and the pending sample.
+        std::vector<_TimeSample> skipped;
+        /// The latest sample, written when the next one cannot replace it.
+        _TimeSample pending;
+        bool        hasPending = false;
+    };
+
+    UsdUtilsSparseValueWriter                                _sparseWriter;
+    std::unordered_map<SdfPath, _HeldSamples, SdfPath::Hash> _heldSamples;
+    double                                                   _interpolationTolerance;
+    bool                                                     _writeDefaults;
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE
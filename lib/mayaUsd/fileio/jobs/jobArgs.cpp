@@ -631,6 +631,7 @@ UsdMayaJobExportArgs::UsdMayaJobExportArgs(
     , mergeTransformAndShape(
           extractBoolean(userArgs, UsdMayaJobExportArgsTokens->mergeTransformAndShape))
     , normalizeNurbs(extractBoolean(userArgs, UsdMayaJobExportArgsTokens->normalizeNurbs))
+    , parallelWrite(extractBoolean(userArgs, UsdMayaJobExportArgsTokens->parallelWrite))
     , preserveUVSetNames(extractBoolean(userArgs, UsdMayaJobExportArgsTokens->preserveUVSetNames))
     , stripNamespaces(extractBoolean(userArgs, UsdMayaJobExportArgsTokens->stripNamespaces))
     , worldspace(extractBoolean(userArgs, UsdMayaJobExportArgsTokens->worldspace))
@@ -658,6 +659,11 @@ UsdMayaJobExportArgs::UsdMayaJobExportArgs(
           extractTokenSet(userArgs, UsdMayaJobExportArgsTokens->convertMaterialsTo))
     , verbose(extractBoolean(userArgs, UsdMayaJobExportArgsTokens->verbose))
     , staticSingleSample(extractBoolean(userArgs, UsdMayaJobExportArgsTokens->staticSingleSample))
+    , timeSampleTolerance(
+          extractDouble(userArgs, UsdMayaJobExportArgsTokens->timeSampleTolerance, 0.0))
+    , streamingChunkSize(
+          extractDouble(userArgs, UsdMayaJobExportArgsTokens->streamingChunkSize, 0.0))
+    , perfReport(extractString(userArgs, UsdMayaJobExportArgsTokens->perfReport))
     , geomSidedness(extractToken(
           userArgs,
           UsdMayaJobExportArgsTokens->geomSidedness,
@@ -733,6 +739,7 @@ std::ostream& operator<<(std::ostream& out, const UsdMayaJobExportArgs& exportAr
         << "materialsScopeName: " << exportArgs.materialsScopeName << std::endl
         << "mergeTransformAndShape: " << TfStringify(exportArgs.mergeTransformAndShape) << std::endl
         << "normalizeNurbs: " << TfStringify(exportArgs.normalizeNurbs) << std::endl
+        << "parallelWrite: " << TfStringify(exportArgs.parallelWrite) << std::endl
         << "preserveUVSetNames: " << TfStringify(exportArgs.preserveUVSetNames) << std::endl
         << "writeDefaults: " << TfStringify(exportArgs.writeDefaults) << std::endl
         << "parentScope: " << exportArgs.parentScope << std::endl
@@ -749,6 +756,9 @@ std::ostream& operator<<(std::ostream& out, const UsdMayaJobExportArgs& exportAr
         << "worldspace: " << TfStringify(exportArgs.worldspace) << std::endl
         << "timeSamples: " << exportArgs.timeSamples.size() << " sample(s)" << std::endl
         << "staticSingleSample: " << TfStringify(exportArgs.staticSingleSample) << std::endl
+        << "timeSampleTolerance: " << exportArgs.timeSampleTolerance << std::endl
+        << "streamingChunkSize: " << exportArgs.streamingChunkSize << std::endl
+        << "perfReport: " << exportArgs.perfReport << std::endl
         << "geomSidedness: " << TfStringify(exportArgs.geomSidedness) << std::endl
         << "usdModelRootOverridePath: " << exportArgs.usdModelRootOverridePath << std::endl;
 
@@ -995,6 +1005,7 @@ const VtDictionary& UsdMayaJobExportArgs::GetDefaultDictionary()
         d[UsdMayaJobExportArgsTokens->melPostCallback] = std::string();
         d[UsdMayaJobExportArgsTokens->mergeTransformAndShape] = true;
         d[UsdMayaJobExportArgsTokens->normalizeNurbs] = false;
+        d[UsdMayaJobExportArgsTokens->parallelWrite] = false;
         d[UsdMayaJobExportArgsTokens->preserveUVSetNames] = false;
         d[UsdMayaJobExportArgsTokens->writeDefaults] = false;
         d[UsdMayaJobExportArgsTokens->parentScope] = std::string();
@@ -1013,6 +1024,9 @@ const VtDictionary& UsdMayaJobExportArgs::GetDefaultDictionary()
         d[UsdMayaJobExportArgsTokens->worldspace] = false;
         d[UsdMayaJobExportArgsTokens->verbose] = false;
         d[UsdMayaJobExportArgsTokens->staticSingleSample] = false;
+        d[UsdMayaJobExportArgsTokens->timeSampleTolerance] = 0.0;
+        d[UsdMayaJobExportArgsTokens->streamingChunkSize] = 0.0;
+        d[UsdMayaJobExportArgsTokens->perfReport] = std::string();
         d[UsdMayaJobExportArgsTokens->geomSidedness]
             = UsdMayaJobExportArgsTokens->derived.GetString();
         d[UsdMayaJobExportArgsTokens->customLayerData] = std::vector<VtValue>();
@@ -1092,6 +1106,7 @@ const VtDictionary& UsdMayaJobExportArgs::GetGuideDictionary()
         d[UsdMayaJobExportArgsTokens->melPostCallback] = _string;
         d[UsdMayaJobExportArgsTokens->mergeTransformAndShape] = _boolean;
         d[UsdMayaJobExportArgsTokens->normalizeNurbs] = _boolean;
+        d[UsdMayaJobExportArgsTokens->parallelWrite] = _boolean;
         d[UsdMayaJobExportArgsTokens->preserveUVSetNames] = _boolean;
         d[UsdMayaJobExportArgsTokens->writeDefaults] = _boolean;
         d[UsdMayaJobExportArgsTokens->parentScope] = _string;
@@ -1107,6 +1122,9 @@ const VtDictionary& UsdMayaJobExportArgs::GetGuideDictionary()
         d[UsdMayaJobExportArgsTokens->worldspace] = _boolean;
         d[UsdMayaJobExportArgsTokens->verbose] = _boolean;
         d[UsdMayaJobExportArgsTokens->staticSingleSample] = _boolean;
+        d[UsdMayaJobExportArgsTokens->timeSampleTolerance] = _double;
+        d[UsdMayaJobExportArgsTokens->streamingChunkSize] = _double;
+        d[UsdMayaJobExportArgsTokens->perfReport] = _string;
         d[UsdMayaJobExportArgsTokens->geomSidedness] = _string;
         d[UsdMayaJobExportArgsTokens->excludeExportTypes] = _stringVector;
         d[UsdMayaJobExportArgsTokens->defaultPrim] = _string;
@@ -1174,6 +1192,8 @@ UsdMayaJobImportArgs::UsdMayaJobImportArgs(
     , importWithProxyShapes(importWithProxyShapes)
     , preserveTimeline(extractBoolean(userArgs, UsdMayaJobImportArgsTokens->preserveTimeline))
     , applyEulerFilter(extractBoolean(userArgs, UsdMayaJobImportArgsTokens->applyEulerFilter))
+    , parallelRead(extractBoolean(userArgs, UsdMayaJobImportArgsTokens->parallelRead))
+    , perfReport(extractString(userArgs, UsdMayaJobImportArgsTokens->perfReport))
     , pullImportStage(extractUsdStageRefPtr(userArgs, UsdMayaJobImportArgsTokens->pullImportStage))
     , timeInterval(timeInterval)
     , chaserNames(extractVector<std::string>(userArgs, UsdMayaJobImportArgsTokens->chaser))
@@ -1235,6 +1255,8 @@ const VtDictionary& UsdMayaJobImportArgs::GetDefaultDictionary()
         d[UsdMayaJobExportArgsTokens->chaser] = std::vector<VtValue>();
         d[UsdMayaJobExportArgsTokens->chaserArgs] = std::vector<VtValue>();
         d[UsdMayaJobImportArgsTokens->applyEulerFilter] = false;
+        d[UsdMayaJobImportArgsTokens->parallelRead] = false;
+        d[UsdMayaJobImportArgsTokens->perfReport] = std::string();
 
         // plugInfo.json site defaults.
         // The defaults dict should be correctly-typed, so enable
@@ -1316,6 +1338,8 @@ const VtDictionary& UsdMayaJobImportArgs::GetGuideDictionary()
         d[UsdMayaJobExportArgsTokens->chaser] = _stringVector;
         d[UsdMayaJobExportArgsTokens->chaserArgs] = _stringTripletVector;
         d[UsdMayaJobImportArgsTokens->applyEulerFilter] = _boolean;
+        d[UsdMayaJobImportArgsTokens->parallelRead] = _boolean;
+        d[UsdMayaJobImportArgsTokens->perfReport] = _string;
     });
 
     return d;
@@ -1405,7 +1429,9 @@ std::ostream& operator<<(std::ostream& out, const UsdMayaJobImportArgs& importAr
         << "useAsAnimationCache: " << TfStringify(importArgs.useAsAnimationCache) << std::endl
         << "preserveTimeline: " << TfStringify(importArgs.preserveTimeline) << std::endl
         << "importWithProxyShapes: " << TfStringify(importArgs.importWithProxyShapes) << std::endl
-        << "applyEulerFilter: " << importArgs.applyEulerFilter << std::endl;
+        << "applyEulerFilter: " << importArgs.applyEulerFilter << std::endl
+        << "parallelRead: " << TfStringify(importArgs.parallelRead) << std::endl
+        << "perfReport: " << importArgs.perfReport << std::endl;
 
     out << "jobContextNames (" << importArgs.jobContextNames.size() << ")" << std::endl;
     for (const std::string& jobContextName : importArgs.jobContextNames) {
@@ -96,6 +96,7 @@ TF_DECLARE_PUBLIC_TOKENS(
     (melPostCallback) \
     (mergeTransformAndShape) \
     (normalizeNurbs) \
+    (parallelWrite) \
     (preserveUVSetNames) \
     (parentScope) \
     (pythonPerFrameCallback) \
@@ -108,6 +109,9 @@ TF_DECLARE_PUBLIC_TOKENS(
     (stripNamespaces) \
     (verbose) \
     (staticSingleSample) \
+    (timeSampleTolerance) \
+    (streamingChunkSize) \
+    (perfReport) \
     (geomSidedness)   \
     (worldspace) \
     (writeDefaults) \
@@ -162,6 +166,8 @@ TF_DECLARE_PUBLIC_TOKENS(
     (importRelativeTextures) \
     (pullImportStage) \
     (preserveTimeline) \
+    (parallelRead) \
+    (perfReport) \
     /* values for import relative textures */ \
     (automatic) \
     (absolute) \
@@ -229,6 +235,9 @@ struct UsdMayaJobExportArgs
     /// a single node in the output USD.
     const bool mergeTransformAndShape;
     const bool normalizeNurbs;
+    /// Whether prim writers that support it compute their per-frame data
+    /// concurrently. See UsdMayaPrimWriter::SupportsParallelWrite().
+    const bool parallelWrite;
     const bool preserveUVSetNames;
     const bool stripNamespaces;
     // Export root prims using their worldspace transform instead of local transform.
@@ -247,6 +256,16 @@ struct UsdMayaJobExportArgs
     const TfToken::Set allMaterialConversions;
     const bool         verbose;
     const bool         staticSingleSample;
+    /// Time-samples reconstructible within this tolerance by linearly
+    /// interpolating their neighbours are not written. Zero or less disables it.
+    const double       timeSampleTolerance;
+    /// When greater than zero, the time samples of every chunk of this many
+    /// frames are written to their own value clip layer instead of the root
+    /// layer, bounding the memory used by long animated exports.
+    const double       streamingChunkSize;
+    /// When not empty, the file to which the time spent in each export phase,
+    /// prim writer type and chaser is written. See UsdMaya_JobPerfReport.
+    const std::string  perfReport;
     const TfToken      geomSidedness;
     const TfToken::Set includeAPINames;
     const TfToken::Set jobContextNames;
@@ -367,6 +386,10 @@ struct UsdMayaJobImportArgs
     const bool           importWithProxyShapes;
     const bool           preserveTimeline;
     const bool           applyEulerFilter;
+    const bool           parallelRead;
+    /// When not empty, the file to which the time spent in each import phase,
+    /// prim reader type and chaser is written. See UsdMaya_JobPerfReport.
+    const std::string    perfReport;
     const UsdStageRefPtr pullImportStage;
     /// The interval over which to import animated data.
     /// An empty interval (<tt>GfInterval::IsEmpty()</tt>) means that no
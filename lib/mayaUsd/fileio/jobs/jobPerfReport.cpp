@@ -0,0 +1,150 @@
+//
+// Copyright 2024 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "jobPerfReport.h"
+
+#include <pxr/base/arch/demangle.h>
+#include <pxr/base/js/json.h>
+#include <pxr/base/tf/diagnostic.h>
+#include <pxr/base/trace/collector.h>
+
+#include <cstdint>
+#include <fstream>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+UsdMaya_JobPerfReport::UsdMaya_JobPerfReport(const std::string& filePath)
+    : _filePath(filePath)
+    , _origin(std::chrono::steady_clock::now())
+{
+}
+
+UsdMaya_JobPerfReport::~UsdMaya_JobPerfReport() { }
+
+UsdMaya_JobPerfReport::Scope::Scope(UsdMaya_JobPerfReport& report, const char* phaseName)
+    : _report(report)
+    , _isPhase(true)
+{
+    if (_report.IsEnabled() || TraceCollector::IsEnabled()) {
+        _Begin(phaseName);
+    }
+}
+
+UsdMaya_JobPerfReport::Scope::Scope(
+    UsdMaya_JobPerfReport& report,
+    const std::type_info&  type,
+    const char*            methodName)
+    : _report(report)
+    , _isPhase(false)
+{
+    // Demangling is only worth it when someone looks at the result.
+    if (_report.IsEnabled() || TraceCollector::IsEnabled()) {
+        _Begin(_report._GetTypeName(type) + "::" + methodName);
+    }
+}
+
+void UsdMaya_JobPerfReport::Scope::_Begin(std::string&& name)
+{
+    _name = std::move(name);
+    if (TraceCollector::IsEnabled()) {
+        _trace.emplace(_name);
+    }
+    _start = std::chrono::steady_clock::now();
+}
+
+UsdMaya_JobPerfReport::Scope::~Scope()
+{
+    if (_name.empty() || !_report.IsEnabled()) {
+        return;
+    }
+
+    _report._Record(_name, _isPhase, _start, std::chrono::steady_clock::now());
+}
+
+std::string UsdMaya_JobPerfReport::_GetTypeName(const std::type_info& type)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    auto iter = _typeNames.find(std::type_index(type));
+    if (iter == _typeNames.end()) {
+        iter = _typeNames.emplace(std::type_index(type), ArchGetDemangled(type)).first;
+    }
+    return iter->second;
+}
+
+void UsdMaya_JobPerfReport::_Record(
+    const std::string&                    name,
+    bool                                  isPhase,
+    std::chrono::steady_clock::time_point start,
+    std::chrono::steady_clock::time_point end)
+{
+    using Seconds = std::chrono::duration<double>;
+    using Microseconds = std::chrono::duration<double, std::micro>;
+
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    _Total& total = _totals[name];
+    total.seconds += Seconds(end - start).count();
+    ++total.count;
+
+    if (isPhase) {
+        _phaseEvents.push_back(
+            { name, Microseconds(start - _origin).count(), Microseconds(end - start).count() });
+    }
+}
+
+bool UsdMaya_JobPerfReport::Write() const
+{
+    if (!IsEnabled()) {
+        return true;
+    }
+
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    JsArray traceEvents;
+    traceEvents.reserve(_phaseEvents.size());
+    for (const _PhaseEvent& phaseEvent : _phaseEvents) {
+        traceEvents.push_back(JsObject { { "name", JsValue(phaseEvent.name) },
+                                         { "cat", JsValue("phase") },
+                                         { "ph", JsValue("X") },
+                                         { "ts", JsValue(phaseEvent.startMicroseconds) },
+                                         { "dur", JsValue(phaseEvent.durationMicroseconds) },
+                                         { "pid", JsValue(0) },
+                                         { "tid", JsValue(0) } });
+    }
+
+    JsObject totals;
+    for (const auto& nameAndTotal : _totals) {
+        totals[nameAndTotal.first]
+            = JsObject { { "seconds", JsValue(nameAndTotal.second.seconds) },
+                         { "count", JsValue(static_cast<uint64_t>(nameAndTotal.second.count)) } };
+    }
+
+    std::ofstream out(_filePath);
+    if (!out) {
+        TF_RUNTIME_ERROR("Failed to write the performance report '%s'", _filePath.c_str());
+        return false;
+    }
+
+    JsWriteToStream(
+        JsObject { { "traceEvents", JsValue(traceEvents) },
+                   { "displayTimeUnit", JsValue("ms") },
+                   { "totals", JsValue(totals) } },
+        out);
+
+    return true;
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
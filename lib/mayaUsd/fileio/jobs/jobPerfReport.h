@@ -0,0 +1,154 @@
+//
+// Copyright 2024 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef PXRUSDMAYA_JOB_PERF_REPORT_H
+#define PXRUSDMAYA_JOB_PERF_REPORT_H
+
+#include <mayaUsd/base/api.h>
+
+#include <pxr/base/trace/trace.h>
+#include <pxr/pxr.h>
+
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <typeindex>
+#include <typeinfo>
+#include <unordered_map>
+#include <vector>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+/// Measures where the time of an import or export job goes, for the
+/// perfReport job option.
+///
+/// The job phases, and each method of the prim readers, prim writers and
+/// chasers, are timed by a Scope. The time of each scope is totalled by name
+/// over the whole job; for the prim readers, prim writers and chasers, the
+/// name is the translator type followed by the method name, so that slow
+/// translators stand out. Job phases are also kept individually to draw a
+/// timeline.
+///
+/// Scopes also emit a Trace event while the TraceCollector is enabled, so
+/// that they show up in external Trace captures.
+class UsdMaya_JobPerfReport
+{
+public:
+    /// Creates a report to be written to \p filePath. With an empty
+    /// \p filePath, nothing is measured and scopes only emit Trace events.
+    MAYAUSD_CORE_PUBLIC
+    explicit UsdMaya_JobPerfReport(const std::string& filePath);
+
+    MAYAUSD_CORE_PUBLIC
+    ~UsdMaya_JobPerfReport();
+
+    /// Times the enclosing C++ scope.
+    class Scope
+    {
+    public:
+        /// Times the job phase \p phaseName, which is also recorded on the
+        /// timeline of the report.
+        MAYAUSD_CORE_PUBLIC
+        Scope(UsdMaya_JobPerfReport& report, const char* phaseName);
+
+        /// Times the method \p methodName of the translator or chaser of
+        /// dynamic type \p type.
+        MAYAUSD_CORE_PUBLIC
+        Scope(UsdMaya_JobPerfReport& report, const std::type_info& type, const char* methodName);
+
+        MAYAUSD_CORE_PUBLIC
+        ~Scope();
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        void _Begin(std::string&& name);
+
+        UsdMaya_JobPerfReport&                _report;
+        std::string                           _name;
+        bool                                  _isPhase;
+        std::chrono::steady_clock::time_point _start;
+        std::optional<TraceAuto>              _trace;
+    };
+
+    /// Writes the report when the enclosing C++ scope exits, so that it is
+    /// also written when the job fails or returns early.
+    class WriteScope
+    {
+    public:
+        explicit WriteScope(const UsdMaya_JobPerfReport& report)
+            : _report(report)
+        {
+        }
+
+        ~WriteScope() { _report.Write(); }
+
+        WriteScope(const WriteScope&) = delete;
+        WriteScope& operator=(const WriteScope&) = delete;
+
+    private:
+        const UsdMaya_JobPerfReport& _report;
+    };
+
+    /// Whether the report measures anything.
+    bool IsEnabled() const { return !_filePath.empty(); }
+
+    /// Writes the report as a JSON file in the Chrome trace event format,
+    /// which can be loaded in chrome://tracing or Perfetto to see the job
+    /// phases on a timeline. The per-name totals are stored in the "totals"
+    /// object of the same file, sorted by name.
+    /// Does nothing if the report is not enabled.
+    /// Returns \c false if the file cannot be written.
+    MAYAUSD_CORE_PUBLIC
+    bool Write() const;
+
+private:
+    struct _Total
+    {
+        double seconds { 0.0 };
+        size_t count { 0 };
+    };
+
+    struct _PhaseEvent
+    {
+        std::string name;
+        double      startMicroseconds;
+        double      durationMicroseconds;
+    };
+
+    std::string _GetTypeName(const std::type_info& type);
+
+    void _Record(
+        const std::string&                    name,
+        bool                                  isPhase,
+        std::chrono::steady_clock::time_point start,
+        std::chrono::steady_clock::time_point end);
+
+    const std::string                     _filePath;
+    std::chrono::steady_clock::time_point _origin;
+
+    // Scopes may end on worker threads.
+    mutable std::mutex                                _mutex;
+    std::map<std::string, _Total>                     _totals;
+    std::vector<_PhaseEvent>                          _phaseEvents;
+    std::unordered_map<std::type_index, std::string> _typeNames;
+};
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif
@@ -29,6 +29,8 @@
 
 #include <pxr/base/tf/debug.h>
 #include <pxr/base/tf/token.h>
+#include <pxr/base/trace/trace.h>
+#include <pxr/base/work/loops.h>
 #include <pxr/usd/sdf/fileFormat.h>
 #include <pxr/usd/sdf/layer.h>
 #include <pxr/usd/sdf/path.h>
@@ -70,6 +72,13 @@
 PXR_NAMESPACE_OPEN_SCOPE
 
 namespace {
+// Maximum number of prim readers prefetched at once, which bounds the memory
+// held by their prefetched data.
+constexpr size_t kMaxPrefetchedReaders = 256;
+
+// Maximum number of prims traversed to find the prim readers to prefetch.
+constexpr size_t kMaxPrefetchedPrims = 4096;
+
 // Simple RAII class to ensure tracking does not extend past the scope.
 struct TempNodeTrackerScope
 {
@@ -188,6 +197,7 @@ UsdMaya_ReadJob::UsdMaya_ReadJob(
     , mMayaRootDagPath()
     , mDagModifierUndo()
     , mDagModifierSeeded(false)
+    , mPerfReport(iArgs.perfReport)
 {
 }
 
@@ -195,6 +205,11 @@ UsdMaya_ReadJob::~UsdMaya_ReadJob() { }
 
 bool UsdMaya_ReadJob::Read(std::vector<MDagPath>* addedDagPaths)
 {
+    TRACE_FUNCTION();
+
+    // Write the performance report however the import ends.
+    UsdMaya_JobPerfReport::WriteScope perfReportScope(mPerfReport);
+
     // When we are called from PrimUpdaterManager we should already have
     // a computation scope. If we are called from elsewhere don't show any
     // progress bar here.
@@ -472,6 +487,7 @@ bool UsdMaya_ReadJob::Read(std::vector<MDagPath>* addedDagPaths)
     progressBar.advance();
 
     for (const UsdMayaImportChaserRefPtr& chaser : this->mImportChasers) {
+        UsdMaya_JobPerfReport::Scope chaserScope(mPerfReport, typeid(*chaser), "PostImport");
         chaser->SetSdfToDagMap(sdfToDagMap);
         bool bStat
             = chaser->PostImport(predicate, stage, currentAddedDagPaths, fromSdfPaths, this->mArgs);
@@ -517,6 +533,8 @@ void UsdMaya_ReadJob::_DoImportPrimIt(
         // specified one.
         auto primReaderIt = primReaderMap.find(prim.GetPath());
         if (primReaderIt != primReaderMap.end()) {
+            UsdMaya_JobPerfReport::Scope readerScope(
+                mPerfReport, typeid(*primReaderIt->second), "PostReadSubtree");
             primReaderIt->second->PostReadSubtree(readCtx);
         }
     } else {
@@ -526,25 +544,93 @@ void UsdMaya_ReadJob::_DoImportPrimIt(
             return;
         }
 
-        TfToken typeName = prim.GetTypeName();
-        if (UsdMayaPrimReaderRegistry::ReaderFactoryFn factoryFn
-            = UsdMayaPrimReaderRegistry::FindOrFallback(typeName, mArgs, prim)) {
-            UsdMayaPrimReaderSharedPtr primReader = factoryFn(args);
-            if (primReader) {
-                TempNodeTrackerScope scope(readCtx);
-                primReader->Read(readCtx);
-                if (primReader->HasPostReadSubtree()) {
-                    primReaderMap[prim.GetPath()] = primReader;
-                }
-                if (readCtx.GetPruneChildren()) {
-                    primIt.PruneChildren();
-                }
-                UsdMayaReadUtil::ReadAPISchemaAttributesFromPrim(args, readCtx);
+        UsdMayaPrimReaderSharedPtr primReader;
+        auto                       prefetchedIt = mPrefetchedReaders.find(prim.GetPath());
+        if (prefetchedIt != mPrefetchedReaders.end()) {
+            primReader = std::move(prefetchedIt->second);
+            mPrefetchedReaders.erase(prefetchedIt);
+        } else {
+            primReader = _CreatePrimReader(prim);
+        }
+        if (primReader) {
+            TempNodeTrackerScope         scope(readCtx);
+            UsdMaya_JobPerfReport::Scope readerScope(mPerfReport, typeid(*primReader), "Read");
+            primReader->Read(readCtx);
+            if (primReader->HasPostReadSubtree()) {
+                primReaderMap[prim.GetPath()] = primReader;
             }
+            if (readCtx.GetPruneChildren()) {
+                primIt.PruneChildren();
+            }
+            UsdMayaReadUtil::ReadAPISchemaAttributesFromPrim(args, readCtx);
         }
     }
 }
 
+UsdMayaPrimReaderSharedPtr UsdMaya_ReadJob::_CreatePrimReader(const UsdPrim& prim)
+{
+    UsdMayaPrimReaderRegistry::ReaderFactoryFn factoryFn
+        = UsdMayaPrimReaderRegistry::FindOrFallback(prim.GetTypeName(), mArgs, prim);
+    if (!factoryFn) {
+        return nullptr;
+    }
+
+    // The reader arguments only refer to the prim, and dereferencing a prim
+    // range iterator returns a temporary prim, so the reader owns a copy of
+    // the prim for as long as it is used.
+    struct PrimAndReader
+    {
+        UsdPrim                    prim;
+        UsdMayaPrimReaderSharedPtr reader;
+    };
+    auto primAndReader = std::make_shared<PrimAndReader>();
+    primAndReader->prim = prim;
+    primAndReader->reader = factoryFn(UsdMayaPrimReaderArgs(primAndReader->prim, mArgs));
+    if (!primAndReader->reader) {
+        return nullptr;
+    }
+    return UsdMayaPrimReaderSharedPtr(primAndReader, primAndReader->reader.get());
+}
+
+void UsdMaya_ReadJob::_PrefetchPrimReaders(
+    UsdPrimRange::iterator        primIt,
+    const UsdPrimRange::iterator& end,
+    bool                          buildInstances)
+{
+    UsdMaya_JobPerfReport::Scope perfScope(mPerfReport, "UsdMaya_ReadJob::_PrefetchPrimReaders");
+
+    // Readers left from the previous batch belong to prims that were pruned
+    // or overridden, they will never be used.
+    mPrefetchedReaders.clear();
+    mPrefetchedPaths.clear();
+
+    // Creating the readers goes through the registry, so it stays on the
+    // main thread. Only the USD-side prefetching runs in parallel.
+    std::vector<UsdMayaPrimReader*> readers;
+    for (; primIt != end && readers.size() < kMaxPrefetchedReaders
+         && mPrefetchedPaths.size() < kMaxPrefetchedPrims;
+         ++primIt) {
+        if (primIt.IsPostVisit()) {
+            continue;
+        }
+
+        const UsdPrim prim = *primIt;
+        mPrefetchedPaths.insert(prim.GetPath());
+        if (buildInstances && prim.IsInstance()) {
+            continue;
+        }
+
+        UsdMayaPrimReaderSharedPtr primReader = _CreatePrimReader(prim);
+        if (primReader && primReader->SupportsParallelPrefetch()) {
+            readers.push_back(primReader.get());
+            mPrefetchedReaders[prim.GetPath()] = std::move(primReader);
+        }
+    }
+
+    WorkParallelForEach(
+        readers.begin(), readers.end(), [](UsdMayaPrimReader* reader) { reader->Prefetch(); });
+}
+
 void UsdMaya_ReadJob::_DoImportInstanceIt(
     UsdPrimRange::iterator&   primIt,
     const UsdPrim&            usdRootPrim,
@@ -620,6 +706,8 @@ void UsdMaya_ReadJob::_ImportPrototype(
 
 bool UsdMaya_ReadJob::_DoImport(UsdPrimRange& rootRange, const UsdPrim& usdRootPrim)
 {
+    UsdMaya_JobPerfReport::Scope perfScope(mPerfReport, "UsdMaya_ReadJob::_DoImport");
+
     const bool buildInstances = mArgs.importInstances;
 
     MayaUsd::ProgressBarScope progressBar(0);
@@ -640,7 +728,16 @@ bool UsdMaya_ReadJob::_DoImport(UsdPrimRange& rootRange, const UsdPrim& usdRootP
         const int                     loopSize = std::distance(range.begin(), range.end());
         MayaUsd::ProgressBarLoopScope instanceLoop(loopSize);
         for (auto primIt = range.begin(); primIt != range.end(); ++primIt) {
-            const UsdPrim&           prim = *primIt;
+            const UsdPrim& prim = *primIt;
+
+            // Prefetch the next batch once the traversal leaves the prims
+            // covered by the previous one. Starting each batch at the current
+            // prim skips the subtrees pruned so far.
+            if (mArgs.parallelRead && !primIt.IsPostVisit()
+                && mPrefetchedPaths.count(prim.GetPath()) == 0) {
+                _PrefetchPrimReaders(primIt, range.end(), buildInstances);
+            }
+
             UsdMayaPrimReaderContext readCtx(&mNewNodeRegistry);
             readCtx.SetTimeSampleMultiplier(mTimeSampleMultiplier);
 
@@ -651,6 +748,10 @@ bool UsdMaya_ReadJob::_DoImport(UsdPrimRange& rootRange, const UsdPrim& usdRootP
             }
             instanceLoop.loopAdvance();
         }
+
+        // Readers of prims that were pruned or overridden were never used.
+        mPrefetchedReaders.clear();
+        mPrefetchedPaths.clear();
     }
 
     if (buildInstances) {
@@ -19,10 +19,12 @@
 #include <mayaUsd/fileio/chaser/importChaser.h>
 #include <mayaUsd/fileio/importData.h>
 #include <mayaUsd/fileio/jobs/jobArgs.h>
+#include <mayaUsd/fileio/jobs/jobPerfReport.h>
 #include <mayaUsd/fileio/primReader.h>
 #include <mayaUsd/fileio/primReaderContext.h>
 
 #include <pxr/pxr.h>
+#include <pxr/usd/sdf/path.h>
 #include <pxr/usd/usd/prim.h>
 #include <pxr/usd/usd/primRange.h>
 
@@ -31,6 +33,7 @@
 
 #include <map>
 #include <string>
+#include <unordered_set>
 #include <vector>
 
 PXR_NAMESPACE_OPEN_SCOPE
@@ -129,16 +132,34 @@ private:
         const UsdPrim&            usdRootPrim,
         UsdMayaPrimReaderContext& readCtx);
 
+    // Creates the prim reader of the given prim, if any.
+    UsdMayaPrimReaderSharedPtr _CreatePrimReader(const UsdPrim& prim);
+
+    // Creates the prim readers supporting parallel prefetching for a bounded
+    // batch of prims, from primIt on, and runs their Prefetch() concurrently.
+    // The readers are kept in mPrefetchedReaders until _DoImportPrimIt() reads
+    // their prim on the main thread.
+    void _PrefetchPrimReaders(
+        UsdPrimRange::iterator        primIt,
+        const UsdPrimRange::iterator& end,
+        bool                          buildInstances);
+
     double _setTimeSampleMultiplierFrom(const double layerFPS);
 
     // Data
-    MDagModifier mDagModifierUndo;
-    bool         mDagModifierSeeded;
-    double       mTimeSampleMultiplier;
+    MDagModifier   mDagModifierUndo;
+    bool           mDagModifierSeeded;
+    double         mTimeSampleMultiplier;
+    _PrimReaderMap mPrefetchedReaders;
+
+    // Prims covered by the last batch of prefetched prim readers.
+    std::unordered_set<SdfPath, SdfPath::Hash> mPrefetchedPaths;
 
     /// Cache of import chasers that were run. Currently used to aid in redo/undo operations
     /// This cache is cleared for every new Read() operation.
     UsdMayaImportChaserRefPtrVector mImportChasers;
+
+    UsdMaya_JobPerfReport mPerfReport;
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE
@@ -15,15 +15,24 @@
 //
 #include "writeJob.h"
 
+#include <pxr/base/gf/vec2d.h>
 #include <pxr/base/tf/fileUtils.h>
 #include <pxr/base/tf/hash.h>
 #include <pxr/base/tf/hashset.h>
 #include <pxr/base/tf/pathUtils.h>
 #include <pxr/base/tf/stl.h>
 #include <pxr/base/tf/stringUtils.h>
+#include <pxr/base/trace/trace.h>
+#include <pxr/base/vt/array.h>
+#include <pxr/base/vt/types.h>
+#include <pxr/base/work/loops.h>
 #include <pxr/pxr.h>
 #include <pxr/usd/ar/resolver.h>
 #include <pxr/usd/kind/registry.h>
+#include <pxr/usd/sdf/assetPath.h>
+#include <pxr/usd/sdf/attributeSpec.h>
+#include <pxr/usd/sdf/changeBlock.h>
+#include <pxr/usd/sdf/copyUtils.h>
 #include <pxr/usd/sdf/layer.h>
 #include <pxr/usd/sdf/primSpec.h>
 
@@ -41,7 +50,9 @@
 
 #include <limits>
 #include <map>
+#include <memory>
 #include <unordered_set>
+#include <vector>
 // Needed for directly removing a UsdVariant via Sdf
 //   Remove when UsdVariantSet::RemoveVariant() is exposed
 //   XXX [bug 75864]
@@ -59,7 +70,9 @@
 
 #include <pxr/usd/sdf/variantSetSpec.h>
 #include <pxr/usd/sdf/variantSpec.h>
+#include <pxr/usd/usd/clipsAPI.h>
 #include <pxr/usd/usd/editContext.h>
+#include <pxr/usd/usd/editTarget.h>
 #include <pxr/usd/usd/modelAPI.h>
 #include <pxr/usd/usd/primRange.h>
 #include <pxr/usd/usd/usdcFileFormat.h>
@@ -74,6 +87,7 @@ PXR_NAMESPACE_OPEN_SCOPE
 UsdMaya_WriteJob::UsdMaya_WriteJob(const UsdMayaJobExportArgs& iArgs)
     : mJobCtx(iArgs)
     , _modelKindProcessor(new UsdMaya_ModelKindProcessor(iArgs))
+    , mPerfReport(iArgs.perfReport)
 {
 }
 
@@ -114,6 +128,14 @@ static TfToken _GetFallbackExtension(const TfToken& compatibilityMode)
 
 bool UsdMaya_WriteJob::Write(const std::string& fileName, bool append)
 {
+    TRACE_FUNCTION();
+
+    // Write the performance report however the export ends.
+    UsdMaya_JobPerfReport::WriteScope perfReportScope(mPerfReport);
+
+    // Take the value clips off the session layer if the export stops early.
+    _ClipScope clipScope(*this);
+
     const std::vector<double>& timeSamples = mJobCtx.mArgs.timeSamples;
 
     // Non-animated export doesn't show progress.
@@ -130,7 +152,8 @@ bool UsdMaya_WriteJob::Write(const std::string& fileName, bool append)
 
     // Time-sampled export.
     if (!timeSamples.empty()) {
-        const MTime oldCurTime = MAnimControl::currentTime();
+        const MTime  oldCurTime = MAnimControl::currentTime();
+        const double chunkSize = mJobCtx.mArgs.streamingChunkSize;
 
         for (double t : timeSamples) {
             if (mJobCtx.mArgs.verbose) {
@@ -139,11 +162,27 @@ bool UsdMaya_WriteJob::Write(const std::string& fileName, bool append)
             MGlobal::viewFrame(t);
             progressBar.advance();
 
+            // Switch to a new value clip once the current one holds a chunk.
+            if (chunkSize > 0.0
+                && (!mCurrentClipLayer || t >= mStreamedClips.back().startTime + chunkSize)) {
+                if (!_BeginClip(t)) {
+                    MGlobal::viewFrame(oldCurTime);
+                    return false;
+                }
+            }
+
             // Process per frame data.
             if (!_WriteFrame(t)) {
                 MGlobal::viewFrame(oldCurTime);
                 return false;
             }
+            if (mCurrentClipLayer) {
+                mStreamedClips.back().endTime = t;
+            }
+            if (mPreviousClipLayer && !_EndPreviousClip(t)) {
+                MGlobal::viewFrame(oldCurTime);
+                return false;
+            }
 
             // Allow user cancellation.
             if (progressBar.isInterruptRequested()) {
@@ -153,6 +192,10 @@ bool UsdMaya_WriteJob::Write(const std::string& fileName, bool append)
 
         // Set the time back.
         MGlobal::viewFrame(oldCurTime);
+
+        if (mCurrentClipLayer && !_EndClip()) {
+            return false;
+        }
     }
 
     // Finalize the export, close the stage.
@@ -160,11 +203,14 @@ bool UsdMaya_WriteJob::Write(const std::string& fileName, bool append)
         return false;
     }
     progressBar.advance();
+
     return true;
 }
 
 bool UsdMaya_WriteJob::_BeginWriting(const std::string& fileName, bool append)
 {
+    UsdMaya_JobPerfReport::Scope perfScope(mPerfReport, "UsdMaya_WriteJob::_BeginWriting");
+
     MayaUsd::ProgressBarScope progressBar(8);
 
     // Check for DAG nodes that are a child of an already specified DAG node to export
@@ -394,6 +440,8 @@ bool UsdMaya_WriteJob::_BeginWriting(const std::string& fileName, bool append)
                         return false;
                     }
 
+                    UsdMaya_JobPerfReport::Scope writerScope(
+                        mPerfReport, typeid(*primWriter), "Write");
                     primWriter->Write(UsdTimeCode::Default());
 
                     const UsdMayaUtil::MDagPathMap<SdfPath>& mapping
@@ -423,14 +471,22 @@ bool UsdMaya_WriteJob::_BeginWriting(const std::string& fileName, bool append)
     }
 
     // Writing Materials/Shading
-    UsdMayaTranslatorMaterial::ExportShadingEngines(mJobCtx, mDagPathToUsdPathMap);
+    {
+        UsdMaya_JobPerfReport::Scope shadingScope(
+            mPerfReport, "UsdMayaTranslatorMaterial::ExportShadingEngines");
+        UsdMayaTranslatorMaterial::ExportShadingEngines(mJobCtx, mDagPathToUsdPathMap);
+    }
     progressBar.advance();
 
     // Perform post-processing for instances, skel, etc.
     // We shouldn't be creating new instance masters after this point, and we
     // want to cleanup the MayaExportedInstanceSources prim before writing model hierarchy.
-    if (!mJobCtx._PostProcess()) {
-        return false;
+    {
+        UsdMaya_JobPerfReport::Scope postProcessScope(
+            mPerfReport, "UsdMayaWriteJobContext::_PostProcess");
+        if (!mJobCtx._PostProcess()) {
+            return false;
+        }
     }
     progressBar.advance();
 
@@ -455,6 +511,7 @@ bool UsdMaya_WriteJob::_BeginWriting(const std::string& fileName, bool append)
 
     MayaUsd::ProgressBarLoopScope chasersLoop(mChasers.size());
     for (const UsdMayaExportChaserRefPtr& chaser : mChasers) {
+        UsdMaya_JobPerfReport::Scope chaserScope(mPerfReport, typeid(*chaser), "ExportDefault");
         if (!chaser->ExportDefault()) {
             return false;
         }
@@ -466,16 +523,72 @@ bool UsdMaya_WriteJob::_BeginWriting(const std::string& fileName, bool append)
 
 bool UsdMaya_WriteJob::_WriteFrame(double iFrame)
 {
+    UsdMaya_JobPerfReport::Scope perfScope(mPerfReport, "UsdMaya_WriteJob::_WriteFrame");
+
     const UsdTimeCode usdTime(iFrame);
 
-    for (const UsdMayaPrimWriterSharedPtr& primWriter : mJobCtx.mMayaPrimWriterList) {
-        const UsdPrim& usdPrim = primWriter->GetUsdPrim();
-        if (usdPrim) {
-            primWriter->Write(usdTime);
+    // Writers splitting their frame write into stages, flagged in the order
+    // of mMayaPrimWriterList.
+    std::vector<bool>               isParallel;
+    std::vector<UsdMayaPrimWriter*> parallelWriters;
+    if (mJobCtx.mArgs.parallelWrite) {
+        isParallel.reserve(mJobCtx.mMayaPrimWriterList.size());
+        for (const UsdMayaPrimWriterSharedPtr& primWriter : mJobCtx.mMayaPrimWriterList) {
+            const bool parallel = primWriter->GetUsdPrim() && primWriter->SupportsParallelWrite();
+            isParallel.push_back(parallel);
+            if (parallel) {
+                // Maya is not thread-safe, so all Maya data is read here.
+                UsdMaya_JobPerfReport::Scope writerScope(
+                    mPerfReport, typeid(*primWriter), "GatherFrameData");
+                primWriter->GatherFrameData(usdTime);
+                parallelWriters.push_back(primWriter.get());
+            }
+        }
+    }
+
+    if (!parallelWriters.empty()) {
+        // Only timed as a whole: the per-type totals would add up the time of
+        // concurrent writers.
+        UsdMaya_JobPerfReport::Scope computeScope(
+            mPerfReport, "UsdMayaPrimWriter::ComputeFrameData");
+        WorkParallelForEach(
+            parallelWriters.begin(),
+            parallelWriters.end(),
+            [&usdTime](UsdMayaPrimWriter* primWriter) {
+                primWriter->ComputeFrameData(usdTime);
+            });
+    }
+
+    // Values are authored in the order of the writers, as in a serial write,
+    // since writers may accumulate data shared with other writers (e.g. skel
+    // binding extents). Authoring on a stage is not thread-safe either, but
+    // batching consecutive commits avoids sending a change notification for
+    // every attribute. Serial writers are kept out of the change block, as
+    // they may expect the stage to be up to date with their own edits.
+    std::unique_ptr<SdfChangeBlock> changeBlock;
+    for (size_t i = 0; i < mJobCtx.mMayaPrimWriterList.size(); ++i) {
+        const UsdMayaPrimWriterSharedPtr& primWriter = mJobCtx.mMayaPrimWriterList[i];
+        if (!isParallel.empty() && isParallel[i]) {
+            if (!changeBlock) {
+                changeBlock = std::make_unique<SdfChangeBlock>();
+            }
+            UsdMaya_JobPerfReport::Scope writerScope(
+                mPerfReport, typeid(*primWriter), "CommitFrameData");
+            primWriter->CommitFrameData(usdTime);
+            continue;
         }
+
+        changeBlock.reset();
+        if (!primWriter->GetUsdPrim()) {
+            continue;
+        }
+        UsdMaya_JobPerfReport::Scope writerScope(mPerfReport, typeid(*primWriter), "Write");
+        primWriter->Write(usdTime);
     }
+    changeBlock.reset();
 
     for (UsdMayaExportChaserRefPtr& chaser : mChasers) {
+        UsdMaya_JobPerfReport::Scope chaserScope(mPerfReport, typeid(*chaser), "ExportFrame");
         if (!chaser->ExportFrame(iFrame)) {
             return false;
         }
@@ -486,8 +599,283 @@ bool UsdMaya_WriteJob::_WriteFrame(double iFrame)
     return true;
 }
 
+/// Creates the layer \p fileName receiving streamed value clip data,
+/// replacing any layer already open at that path.
+static SdfLayerRefPtr _CreateClipLayer(const std::string& fileName)
+{
+    SdfLayerRefPtr layer = SdfLayer::Find(fileName);
+    if (layer) {
+        layer->Clear();
+    } else {
+        layer = SdfLayer::CreateNew(fileName);
+    }
+    if (!layer) {
+        TF_RUNTIME_ERROR("Failed to create layer '%s'", fileName.c_str());
+    }
+    return layer;
+}
+
+/// Declares in \p layer the attributes authored in \p clipLayer.
+///
+/// Value clips only provide time samples, so the prims, attributes and default
+/// values authored while writing a clip must also exist in the root layer,
+/// which holds the topology of the stage. The clip manifest, for which
+/// \p topologyLayer is given, only lists the attributes having time samples.
+static void _DeclareClipSpecs(
+    const SdfLayerHandle& clipLayer,
+    const SdfLayerHandle& layer,
+    const SdfLayerHandle& topologyLayer = SdfLayerHandle())
+{
+    const bool isManifest = static_cast<bool>(topologyLayer);
+    clipLayer->Traverse(SdfPath::AbsoluteRootPath(), [&](const SdfPath& path) {
+        if (path.IsPrimPath()) {
+            // Prims defined while writing the clip rather than at default time.
+            const SdfPrimSpecHandle clipPrim = clipLayer->GetPrimAtPath(path);
+            if (isManifest || !clipPrim || clipPrim->GetSpecifier() != SdfSpecifierDef) {
+                return;
+            }
+            const SdfPrimSpecHandle prim = SdfCreatePrimInLayer(layer, path);
+            if (prim && prim->GetTypeName().IsEmpty()) {
+                prim->SetSpecifier(SdfSpecifierDef);
+                prim->SetTypeName(clipPrim->GetTypeName());
+            }
+            return;
+        }
+        if (!path.IsPrimPropertyPath()) {
+            return;
+        }
+
+        const SdfAttributeSpecHandle clipAttr = clipLayer->GetAttributeAtPath(path);
+        if (!clipAttr) {
+            if (!isManifest && !layer->HasSpec(path)) {
+                SdfCreatePrimInLayer(layer, path.GetPrimPath());
+                SdfCopySpec(clipLayer, path, layer, path);
+            }
+            return;
+        }
+        if (isManifest && clipLayer->GetNumTimeSamplesForPath(path) == 0) {
+            return;
+        }
+
+        SdfAttributeSpecHandle attr = layer->GetAttributeAtPath(path);
+        if (!attr) {
+            const SdfPrimSpecHandle prim = SdfCreatePrimInLayer(layer, path.GetPrimPath());
+            if (!prim) {
+                return;
+            }
+            attr = SdfAttributeSpec::New(
+                prim,
+                path.GetName(),
+                clipAttr->GetTypeName(),
+                clipAttr->GetVariability(),
+                clipAttr->IsCustom());
+        }
+        if (!attr || attr->HasDefaultValue()) {
+            return;
+        }
+        if (!isManifest) {
+            if (clipAttr->HasDefaultValue()) {
+                attr->SetDefaultValue(clipAttr->GetDefaultValue());
+            }
+            return;
+        }
+
+        // The clips lacking time samples of an attribute of the manifest take
+        // its default value, instead of blocking the default of the topology.
+        const SdfAttributeSpecHandle topologyAttr = topologyLayer->GetAttributeAtPath(path);
+        if (topologyAttr && topologyAttr->HasDefaultValue()) {
+            attr->SetDefaultValue(topologyAttr->GetDefaultValue());
+        }
+    });
+}
+
+bool UsdMaya_WriteJob::_BeginClip(double iFrame)
+{
+    const SdfLayerHandle sessionLayer = mJobCtx.mStage->GetSessionLayer();
+    if (!sessionLayer) {
+        TF_RUNTIME_ERROR(
+            "Cannot stream the time samples of '%s' to value clips", _fileName.c_str());
+        return false;
+    }
+
+    if (mCurrentClipLayer) {
+        // Besides writing the held-back samples to this clip, this makes the
+        // writers forget the previous values, so that each clip starts with a
+        // sample of every animated attribute.
+        for (const UsdMayaPrimWriterSharedPtr& primWriter : mJobCtx.mMayaPrimWriterList) {
+            primWriter->FlushTimeSamples();
+        }
+        mPreviousClipLayer = mCurrentClipLayer;
+        mCurrentClipLayer = SdfLayerRefPtr();
+    }
+
+    const std::string baseName = TfStringGetBeforeSuffix(_fileName);
+    const char*       crateExt = UsdMayaTranslatorTokens->UsdFileExtensionCrate.GetText();
+    if (!mClipManifest) {
+        mClipManifest
+            = _CreateClipLayer(TfStringPrintf("%s.manifest.%s", baseName.c_str(), crateExt));
+        if (!mClipManifest) {
+            return false;
+        }
+    }
+
+    const std::string clipFileName
+        = TfStringPrintf("%s.clip%04zu.%s", baseName.c_str(), mStreamedClips.size(), crateExt);
+    mCurrentClipLayer = _CreateClipLayer(clipFileName);
+    if (!mCurrentClipLayer) {
+        return false;
+    }
+
+    // The edit target has to be part of the stage layer stack, so the clip is
+    // made the strongest sub-layer of the session layer while it is written.
+    sessionLayer->InsertSubLayerPath(mCurrentClipLayer->GetIdentifier(), 0);
+    mJobCtx.mStage->SetEditTarget(UsdEditTarget(mCurrentClipLayer));
+    if (mPreviousClipLayer) {
+        sessionLayer->RemoveSubLayerPath(1);
+    }
+    mStreamedClips.push_back({ clipFileName, iFrame, iFrame });
+
+    return true;
+}
+
+bool UsdMaya_WriteJob::_EndClip()
+{
+    UsdMaya_JobPerfReport::Scope perfScope(mPerfReport, "UsdMaya_WriteJob::_EndClip");
+
+    // Besides writing the held-back samples to this clip, this makes the
+    // writers forget the previous values, so that each clip starts with a
+    // sample of every animated attribute.
+    for (const UsdMayaPrimWriterSharedPtr& primWriter : mJobCtx.mMayaPrimWriterList) {
+        primWriter->FlushTimeSamples();
+    }
+
+    SdfLayerRefPtr clipLayer = mCurrentClipLayer;
+    mCurrentClipLayer = SdfLayerRefPtr();
+    mJobCtx.mStage->SetEditTarget(UsdEditTarget(mJobCtx.mStage->GetRootLayer()));
+    mJobCtx.mStage->GetSessionLayer()->RemoveSubLayerPath(0);
+
+    return _SaveClip(clipLayer);
+}
+
+bool UsdMaya_WriteJob::_EndPreviousClip(double iFrame)
+{
+    UsdMaya_JobPerfReport::Scope perfScope(mPerfReport, "UsdMaya_WriteJob::_EndPreviousClip");
+
+    SdfLayerRefPtr clipLayer = mPreviousClipLayer;
+    mPreviousClipLayer = SdfLayerRefPtr();
+
+    // Like usdstitchclips, each clip also holds the first time sample of the
+    // next one, so that values interpolate from one clip to the next instead
+    // of being held between the last sample of a clip and the next clip.
+    {
+        SdfChangeBlock changeBlock;
+        mCurrentClipLayer->Traverse(SdfPath::AbsoluteRootPath(), [&](const SdfPath& path) {
+            VtValue value;
+            if (path.IsPrimPropertyPath() && clipLayer->GetAttributeAtPath(path)
+                && mCurrentClipLayer->QueryTimeSample(path, iFrame, &value)) {
+                clipLayer->SetTimeSample(path, iFrame, value);
+            }
+        });
+    }
+    mStreamedClips[mStreamedClips.size() - 2].endTime = iFrame;
+
+    return _SaveClip(clipLayer);
+}
+
+void UsdMaya_WriteJob::_ReleaseClips()
+{
+    if (!mCurrentClipLayer && !mPreviousClipLayer) {
+        return;
+    }
+
+    if (mJobCtx.mStage) {
+        mJobCtx.mStage->SetEditTarget(UsdEditTarget(mJobCtx.mStage->GetRootLayer()));
+        const SdfLayerHandle sessionLayer = mJobCtx.mStage->GetSessionLayer();
+        for (const SdfLayerRefPtr& clipLayer : { mCurrentClipLayer, mPreviousClipLayer }) {
+            if (!clipLayer || !sessionLayer) {
+                continue;
+            }
+            const size_t index = sessionLayer->GetSubLayerPaths().Find(clipLayer->GetIdentifier());
+            if (index != static_cast<size_t>(-1)) {
+                sessionLayer->RemoveSubLayerPath(static_cast<int>(index));
+            }
+        }
+    }
+
+    mCurrentClipLayer = SdfLayerRefPtr();
+    mPreviousClipLayer = SdfLayerRefPtr();
+}
+
+bool UsdMaya_WriteJob::_SaveClip(const SdfLayerRefPtr& clipLayer)
+{
+    {
+        SdfChangeBlock changeBlock;
+        const SdfLayerHandle rootLayer = mJobCtx.mStage->GetRootLayer();
+        _DeclareClipSpecs(clipLayer, rootLayer);
+        _DeclareClipSpecs(clipLayer, mClipManifest, rootLayer);
+    }
+
+    if (!clipLayer->Save()) {
+        TF_RUNTIME_ERROR("Failed to save value clip '%s'", clipLayer->GetIdentifier().c_str());
+        return false;
+    }
+
+    // Releasing the last reference to the clip after this frees its time samples.
+    return true;
+}
+
+bool UsdMaya_WriteJob::_WriteClipMetadata()
+{
+    if (mStreamedClips.empty()) {
+        return true;
+    }
+
+    if (!mClipManifest->Save()) {
+        TF_RUNTIME_ERROR(
+            "Failed to save value clip manifest '%s'", mClipManifest->GetIdentifier().c_str());
+        return false;
+    }
+
+    // Clip asset paths are anchored to the root layer, next to which they
+    // were all written.
+    VtArray<SdfAssetPath> assetPaths;
+    VtVec2dArray          active;
+    for (size_t i = 0; i < mStreamedClips.size(); ++i) {
+        const _StreamedClip& clip = mStreamedClips[i];
+        assetPaths.push_back(SdfAssetPath("./" + TfGetBaseName(clip.fileName)));
+        active.push_back(GfVec2d(clip.startTime, static_cast<double>(i)));
+    }
+
+    // Clips are written in stage time, so they map to it with the identity.
+    const double startTime = mStreamedClips.front().startTime;
+    const double endTime = mStreamedClips.back().endTime;
+    VtVec2dArray times(1, GfVec2d(startTime, startTime));
+    if (endTime > startTime) {
+        times.push_back(GfVec2d(endTime, endTime));
+    }
+
+    const SdfAssetPath manifestPath("./" + TfGetBaseName(mClipManifest->GetRealPath()));
+    for (const SdfPrimSpecHandle& manifestPrim : mClipManifest->GetRootPrims()) {
+        const UsdPrim prim = mJobCtx.mStage->GetPrimAtPath(manifestPrim->GetPath());
+        if (!prim) {
+            continue;
+        }
+
+        UsdClipsAPI clipsAPI(prim);
+        clipsAPI.SetClipAssetPaths(assetPaths);
+        clipsAPI.SetClipPrimPath(prim.GetPath().GetString());
+        clipsAPI.SetClipActive(active);
+        clipsAPI.SetClipTimes(times);
+        clipsAPI.SetClipManifestAssetPath(manifestPath);
+    }
+
+    return true;
+}
+
 bool UsdMaya_WriteJob::_FinishWriting()
 {
+    UsdMaya_JobPerfReport::Scope perfScope(mPerfReport, "UsdMaya_WriteJob::_FinishWriting");
+
     MayaUsd::ProgressBarScope progressBar(6);
 
     UsdPrimSiblingRange usdRootPrims = mJobCtx.mStage->GetPseudoRoot().GetChildren();
@@ -570,6 +958,8 @@ bool UsdMaya_WriteJob::_FinishWriting()
     const int                     loopSize = mJobCtx.mMayaPrimWriterList.size();
     MayaUsd::ProgressBarLoopScope primWriterLoop(loopSize);
     for (auto& primWriter : mJobCtx.mMayaPrimWriterList) {
+        UsdMaya_JobPerfReport::Scope writerScope(mPerfReport, typeid(*primWriter), "PostExport");
+        primWriter->FlushTimeSamples();
         primWriter->PostExport();
         primWriterLoop.loopAdvance();
     }
@@ -577,17 +967,25 @@ bool UsdMaya_WriteJob::_FinishWriting()
     // Run post export function on the chasers.
     MayaUsd::ProgressBarLoopScope chasersLoop(mChasers.size());
     for (const UsdMayaExportChaserRefPtr& chaser : mChasers) {
+        UsdMaya_JobPerfReport::Scope chaserScope(mPerfReport, typeid(*chaser), "PostExport");
         if (!chaser->PostExport()) {
             return false;
         }
         chasersLoop.loopAdvance();
     }
 
+    // Done after the post export functions, which would otherwise load all
+    // the streamed clips back when querying time samples.
+    if (!_WriteClipMetadata()) {
+        return false;
+    }
+
     _PostCallback();
     progressBar.advance();
 
     TF_STATUS("Saving stage");
     if (mJobCtx.mStage->GetRootLayer()->PermissionToSave()) {
+        UsdMaya_JobPerfReport::Scope saveScope(mPerfReport, "SdfLayer::Save");
         mJobCtx.mStage->GetRootLayer()->Save();
     }
 
@@ -602,13 +1000,26 @@ bool UsdMaya_WriteJob::_FinishWriting()
     mJobCtx.mStage = UsdStageRefPtr();
     mJobCtx.mMayaPrimWriterList.clear(); // clear this so that no stage references are left around
 
+    const std::string manifestFileName
+        = mClipManifest ? mClipManifest->GetRealPath() : std::string();
+    mClipManifest = SdfLayerRefPtr();
+
     // In the usdz case, the layer at _fileName was just a temp file, so
     // clean it up now. Do this after mJobCtx.mStage is reset to ensure
     // there are no outstanding handles to the file, which will cause file
     // access issues on Windows.
     if (!_packageName.empty()) {
         TfDeleteFile(_fileName);
+
+        // Streamed value clips were packaged along with it.
+        for (const _StreamedClip& clip : mStreamedClips) {
+            TfDeleteFile(clip.fileName);
+        }
+        if (!manifestFileName.empty()) {
+            TfDeleteFile(manifestFileName);
+        }
     }
+    mStreamedClips.clear();
     progressBar.advance();
 
     return true;
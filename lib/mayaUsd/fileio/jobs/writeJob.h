@@ -18,15 +18,18 @@
 
 #include <mayaUsd/base/api.h>
 #include <mayaUsd/fileio/chaser/exportChaser.h>
+#include <mayaUsd/fileio/jobs/jobPerfReport.h>
 #include <mayaUsd/fileio/writeJobContext.h>
 #include <mayaUsd/utils/util.h>
 
 #include <pxr/base/tf/hashmap.h>
 #include <pxr/pxr.h>
+#include <pxr/usd/sdf/layer.h>
 
 #include <maya/MObjectHandle.h>
 
 #include <string>
+#include <vector>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
@@ -66,6 +69,52 @@ private:
     /// WriteFrame() call, internal code may generate errors.
     bool _WriteFrame(double iFrame);
 
+    /// When streaming time samples to value clips, flushes the held-back time
+    /// samples of all prim writers to the current clip if any, and starts
+    /// writing the time samples from \p iFrame on to a new one. The current
+    /// clip is kept until _EndPreviousClip() is called.
+    bool _BeginClip(double iFrame);
+
+    /// Copies the time samples written at \p iFrame to the new clip into the
+    /// previous one, so that consecutive clips overlap, then saves the previous
+    /// clip and releases it.
+    bool _EndPreviousClip(double iFrame);
+
+    /// Flushes the held-back time samples of all prim writers to the current
+    /// value clip, saves it to disk and releases it.
+    bool _EndClip();
+
+    /// Removes the value clips still being written from the session layer and
+    /// targets the root layer again, when the export fails or is cancelled
+    /// while streaming.
+    void _ReleaseClips();
+
+    /// Calls _ReleaseClips() however the export ends.
+    class _ClipScope
+    {
+    public:
+        explicit _ClipScope(UsdMaya_WriteJob& job)
+            : _job(job)
+        {
+        }
+
+        ~_ClipScope() { _job._ReleaseClips(); }
+
+        _ClipScope(const _ClipScope&) = delete;
+        _ClipScope& operator=(const _ClipScope&) = delete;
+
+    private:
+        UsdMaya_WriteJob& _job;
+    };
+
+    /// Declares the specs of \p clipLayer in the root layer and in the clip
+    /// manifest, and saves it to disk.
+    bool _SaveClip(const SdfLayerRefPtr& clipLayer);
+
+    /// Saves the clip manifest and authors the value clip metadata stitching
+    /// the streamed clips back onto the root prims of the stage.
+    bool _WriteClipMetadata();
+
     /// Runs any post-export processes, closes the USD stage, and writes it out
     /// to disk.
     bool _FinishWriting();
@@ -100,9 +149,30 @@ private:
 
     UsdMayaExportChaserRefPtrVector mChasers;
 
+    // Value clips written when streaming time samples, in frame order.
+    struct _StreamedClip
+    {
+        std::string fileName;
+        double      startTime;
+        double      endTime;
+    };
+    std::vector<_StreamedClip> mStreamedClips;
+
+    // Value clip layer receiving the time samples of the current chunk.
+    SdfLayerRefPtr mCurrentClipLayer;
+
+    // Value clip layer of the previous chunk, until it receives the first
+    // time samples of the current chunk.
+    SdfLayerRefPtr mPreviousClipLayer;
+
+    // Declares every attribute having time samples in one of the clips.
+    SdfLayerRefPtr mClipManifest;
+
     UsdMayaWriteJobContext mJobCtx;
 
     std::unique_ptr<UsdMaya_ModelKindProcessor> _modelKindProcessor;
+
+    UsdMaya_JobPerfReport mPerfReport;
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE
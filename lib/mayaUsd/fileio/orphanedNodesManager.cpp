@@ -41,13 +41,13 @@ namespace MAYAUSD_NS_DEF {
 // Class OrphanedNodesManager::Memento
 //------------------------------------------------------------------------------
 
-OrphanedNodesManager::Memento::Memento(PulledPrims&& pulledPrims)
-    : _pulledPrims(std::move(pulledPrims))
+OrphanedNodesManager::Memento::Memento(const std::shared_ptr<PulledPrims>& pulledPrims)
+    : _pulledPrims(pulledPrims)
 {
 }
 
 OrphanedNodesManager::Memento::Memento()
-    : _pulledPrims()
+    : _pulledPrims(std::make_shared<PulledPrims>())
 {
 }
 
@@ -62,7 +62,7 @@ OrphanedNodesManager::Memento& OrphanedNodesManager::Memento::operator=(Memento&
     return *this;
 }
 
-OrphanedNodesManager::PulledPrims OrphanedNodesManager::Memento::release()
+std::shared_ptr<OrphanedNodesManager::PulledPrims> OrphanedNodesManager::Memento::release()
 {
     return std::move(_pulledPrims);
 }
@@ -207,13 +207,13 @@ private:
 } // namespace
 
 OrphanedNodesManager::OrphanedNodesManager()
-    : _pulledPrims()
+    : _pulledPrims(std::make_shared<PulledPrims>())
 {
 }
 
 bool OrphanedNodesManager::has(const Ufe::Path& pulledPath, const MDagPath& editedAsMayaRoot) const
 {
-    PulledPrimNode::Ptr node = _pulledPrims.find(pulledPath);
+    PulledPrimNode::Ptr node = _pulledPrims->find(pulledPath);
     if (!node)
         return false;
 
@@ -227,7 +227,7 @@ bool OrphanedNodesManager::has(const Ufe::Path& pulledPath, const MDagPath& edit
 
 bool OrphanedNodesManager::has(const Ufe::Path& pulledPath) const
 {
-    PulledPrimNode::Ptr node = _pulledPrims.find(pulledPath);
+    PulledPrimNode::Ptr node = _pulledPrims->find(pulledPath);
     if (!node)
         return false;
 
@@ -248,7 +248,7 @@ void OrphanedNodesManager::add(const Ufe::Path& pulledPath, const MDagPath& edit
 {
     // Adding a node twice to the orphan manager is idem-potent. The manager was already
     // tracking that node.
-    if (_pulledPrims.containsDescendant(pulledPath))
+    if (_pulledPrims->containsDescendant(pulledPath))
         return;
 
     if (has(pulledPath, editedAsMayaRoot))
@@ -264,13 +264,14 @@ void OrphanedNodesManager::add(const Ufe::Path& pulledPath, const MDagPath& edit
     auto ancestorPath = pulledPath.pop();
     auto vsd = variantSetDescriptors(ancestorPath);
 
-    PulledPrimNode::Ptr node = _pulledPrims.find(pulledPath);
+    PulledPrims&        pulledPrims = modifiablePulledPrims();
+    PulledPrimNode::Ptr node = pulledPrims.find(pulledPath);
     if (node) {
         PullVariantInfos infos = node->data();
         infos.emplace_back(PullVariantInfo(editedAsMayaRoot, vsd));
         node->setData(infos);
     } else {
-        _pulledPrims.add(pulledPath, { PullVariantInfo(editedAsMayaRoot, vsd) });
+        pulledPrims.add(pulledPath, { PullVariantInfo(editedAsMayaRoot, vsd) });
     }
 }
 
@@ -278,21 +279,27 @@ OrphanedNodesManager::Memento
 OrphanedNodesManager::remove(const Ufe::Path& pulledPath, const MDagPath& editedAsMayaRoot)
 {
     Memento             oldPulledPrims(preserve());
-    PulledPrimNode::Ptr node = _pulledPrims.find(pulledPath);
-    if (node) {
-        PullVariantInfos infos = node->data();
-        for (size_t i = infos.size() - 1; i != size_t(0) - size_t(1); --i) {
-            if (infos[i].editedAsMayaRoot == editedAsMayaRoot) {
-                infos.erase(infos.begin() + i);
-            }
-        }
+    PulledPrimNode::Ptr node = _pulledPrims->find(pulledPath);
+    if (!node)
+        return oldPulledPrims;
 
-        if (infos.size() > 0) {
-            node->setData(infos);
-        } else {
-            _pulledPrims.remove(pulledPath);
+    PullVariantInfos infos = node->data();
+    for (size_t i = infos.size() - 1; i != size_t(0) - size_t(1); --i) {
+        if (infos[i].editedAsMayaRoot == editedAsMayaRoot) {
+            infos.erase(infos.begin() + i);
         }
     }
+
+    // Only copy the trie shared with the memento when something is removed.
+    if (infos.size() == node->data().size())
+        return oldPulledPrims;
+
+    PulledPrims& pulledPrims = modifiablePulledPrims();
+    if (infos.size() > 0) {
+        pulledPrims.find(pulledPath)->setData(infos);
+    } else {
+        pulledPrims.remove(pulledPath);
+    }
     return oldPulledPrims;
 }
 
@@ -308,11 +315,11 @@ void OrphanedNodesManager::operator()(const Ufe::Notification& n)
         const auto& sceneCompositeNotification
             = static_cast<const Ufe::SceneCompositeNotification&>(n);
         for (const auto& op : sceneCompositeNotification.opsList()) {
-            if (_pulledPrims.containsDescendant(op.path)) {
+            if (_pulledPrims->containsDescendant(op.path)) {
                 handleOp(op);
             }
         }
-    } else if (_pulledPrims.containsDescendant(changedPath)) {
+    } else if (_pulledPrims->containsDescendant(changedPath)) {
 #ifdef UFE_V4_FEATURES_AVAILABLE
         // Use UFE v4 notification to op conversion.
         handleOp(sceneNotification);
@@ -330,9 +337,10 @@ void OrphanedNodesManager::operator()(const Ufe::Notification& n)
             handleOp(Ufe::SceneCompositeNotification::Op(
                 Ufe::SceneCompositeNotification::OpType::SubtreeInvalidate, subtrInv->root()));
         } else if (auto objRename = dynamic_cast<const Ufe::ObjectRename*>(&sceneNotification)) {
-            handlePathChange(objRename->previousPath(), objRename->item(), _pulledPrims);
+            handlePathChange(
+                objRename->previousPath(), objRename->item(), modifiablePulledPrims());
         } else if (auto objRep = dynamic_cast<const Ufe::ObjectReparent*>(&sceneNotification)) {
-            handlePathChange(objRep->previousPath(), objRep->item(), _pulledPrims);
+            handlePathChange(objRep->previousPath(), objRep->item(), modifiablePulledPrims());
         }
 #endif
     }
@@ -352,7 +360,7 @@ void OrphanedNodesManager::handleOp(const Ufe::SceneCompositeNotification::Op& o
         // descendants of the argument path that have all the proper variants.
         // The trie node that corresponds to the added path is the starting
         // point.  It may be an internal node, without data.
-        auto ancestorNode = _pulledPrims.node(op.path);
+        auto ancestorNode = _pulledPrims->node(op.path);
         TF_VERIFY(ancestorNode);
         recursiveSwitch(ancestorNode, op.path, true);
         recursiveSwitch(ancestorNode, op.path, false);
@@ -372,7 +380,7 @@ void OrphanedNodesManager::handleOp(const Ufe::SceneCompositeNotification::Op& o
         // Traverse the trie, and hide pull parents that are descendants of
         // the argument path.  First, get the trie node that corresponds to
         // the path.  It may be an internal node, without data.
-        auto ancestorNode = _pulledPrims.node(op.path);
+        auto ancestorNode = _pulledPrims->node(op.path);
         TF_VERIFY(ancestorNode);
         recursiveSetOrphaned(ancestorNode, true);
     } break;
@@ -416,7 +424,7 @@ void OrphanedNodesManager::handleOp(const Ufe::SceneCompositeNotification::Op& o
                 + Ufe::PathSegment(
                             child.GetPath().GetAsString(), MayaUsd::ufe::getUsdRunTimeId(), '/');
 
-            auto ancestorNode = _pulledPrims.node(childPath);
+            auto ancestorNode = _pulledPrims->node(childPath);
             // If there is no ancestor node in the trie, this means that
             // the new hierarchy is completely different from the one when
             // the pull occurred, which means that the pulled object must
@@ -434,7 +442,7 @@ void OrphanedNodesManager::handleOp(const Ufe::SceneCompositeNotification::Op& o
         // different variant or it was a payload that got unloaded,
         // so everything below that path should be hidden.
         if (!foundChild) {
-            auto ancestorNode = _pulledPrims.node(op.path);
+            auto ancestorNode = _pulledPrims->node(op.path);
             if (ancestorNode) {
                 recursiveSetOrphaned(ancestorNode, true);
             }
@@ -444,7 +452,7 @@ void OrphanedNodesManager::handleOp(const Ufe::SceneCompositeNotification::Op& o
     case Ufe::SceneCompositeNotification::OpType::ObjectPathChange: {
         if (op.subOpType == Ufe::ObjectPathChange::ObjectRename
             || op.subOpType == Ufe::ObjectPathChange::ObjectReparent) {
-            handlePathChange(op.path, op.item, _pulledPrims);
+            handlePathChange(op.path, op.item, modifiablePulledPrims());
         }
     } break;
 #endif
@@ -454,21 +462,41 @@ void OrphanedNodesManager::handleOp(const Ufe::SceneCompositeNotification::Op& o
     }
 }
 
-void OrphanedNodesManager::clear() { _pulledPrims.clear(); }
+void OrphanedNodesManager::clear()
+{
+    _pulledPrims = std::make_shared<PulledPrims>();
+    _pulledDescendants.reset();
+}
 
-bool OrphanedNodesManager::empty() const { return _pulledPrims.root()->empty(); }
+bool OrphanedNodesManager::empty() const { return _pulledPrims->root()->empty(); }
 
 OrphanedNodesManager::Memento OrphanedNodesManager::preserve() const
 {
-    return Memento(deepCopy(_pulledPrims));
+    return Memento(_pulledPrims);
 }
 
-void OrphanedNodesManager::restore(Memento&& previous) { _pulledPrims = previous.release(); }
+void OrphanedNodesManager::restore(Memento&& previous)
+{
+    _pulledPrims = previous.release();
+    if (!_pulledPrims)
+        _pulledPrims = std::make_shared<PulledPrims>();
+    _pulledDescendants.reset();
+}
+
+OrphanedNodesManager::PulledPrims& OrphanedNodesManager::modifiablePulledPrims()
+{
+    // Mementos never modify the trie, so it only needs to be copied while they
+    // refer to it.
+    if (_pulledPrims.use_count() > 1)
+        _pulledPrims = std::make_shared<PulledPrims>(deepCopy(*_pulledPrims));
+    _pulledDescendants.reset();
+    return *_pulledPrims;
+}
 
 bool OrphanedNodesManager::isOrphaned(const Ufe::Path& pulledPath, const MDagPath& editedAsMayaRoot)
     const
 {
-    auto trieNode = _pulledPrims.node(pulledPath);
+    auto trieNode = _pulledPrims->node(pulledPath);
     if (!trieNode) {
         // If the argument path has not been pulled, it can't be orphaned.
         return false;
@@ -488,17 +516,79 @@ bool OrphanedNodesManager::isOrphaned(const Ufe::Path& pulledPath, const MDagPat
         }
 
         // If the pull parent is visible, the pulled path is not orphaned.
-        MDagPath pullParentPath = editedAsMayaRoot;
-        pullParentPath.pop();
-
-        MFnDagNode fn(pullParentPath);
-        auto       visibilityPlug = fn.findPlug("visibility", /* tryNetworked */ true);
-        return !visibilityPlug.asBool();
+        return !isPullParentVisible(editedAsMayaRoot);
     }
 
     return false;
 }
 
+bool OrphanedNodesManager::hasPulledDescendant(const Ufe::Path& path) const
+{
+    const auto node = pulledDescendants().node(path);
+    if (!node || !node->hasData())
+        return false;
+
+    // Visibility is read here rather than cached, as pull parents can be
+    // shown or hidden without the trie of pulled prims changing.
+    for (const MDagPath& editedAsMayaRoot : node->data()) {
+        if (editedAsMayaRoot.isValid() && isPullParentVisible(editedAsMayaRoot))
+            return true;
+    }
+    return false;
+}
+
+const OrphanedNodesManager::PulledDescendants& OrphanedNodesManager::pulledDescendants() const
+{
+    if (!_pulledDescendants) {
+        _pulledDescendants = std::make_unique<PulledDescendants>();
+        Ufe::PathSegment::Components components;
+        recursiveAddPulledDescendants(_pulledPrims->root(), components, *_pulledDescendants);
+    }
+    return *_pulledDescendants;
+}
+
+/* static */
+bool OrphanedNodesManager::isPullParentVisible(const MDagPath& editedAsMayaRoot)
+{
+    MDagPath pullParentPath = editedAsMayaRoot;
+    pullParentPath.pop();
+
+    MFnDagNode fn(pullParentPath);
+    auto       visibilityPlug = fn.findPlug("visibility", /* tryNetworked */ true);
+    return visibilityPlug.asBool();
+}
+
+/* static */
+std::vector<MDagPath> OrphanedNodesManager::recursiveAddPulledDescendants(
+    const PulledPrimNode::Ptr&    trieNode,
+    Ufe::PathSegment::Components& components,
+    PulledDescendants&            pulledDescendants)
+{
+    std::vector<MDagPath> editedAsMayaRoots;
+    if (trieNode->hasData()) {
+        for (const PullVariantInfo& variantInfo : trieNode->data()) {
+            editedAsMayaRoots.push_back(variantInfo.editedAsMayaRoot);
+        }
+    }
+
+    for (const Ufe::PathComponent& childComp : trieNode->childrenComponents()) {
+        components.push_back(childComp);
+        const std::vector<MDagPath> childRoots
+            = recursiveAddPulledDescendants((*trieNode)[childComp], components, pulledDescendants);
+        editedAsMayaRoots.insert(editedAsMayaRoots.end(), childRoots.begin(), childRoots.end());
+        components.pop_back();
+    }
+
+    // The trie only uses the path components, so a single segment is enough
+    // to record the path.
+    if (!components.empty() && !editedAsMayaRoots.empty()) {
+        pulledDescendants.add(
+            Ufe::Path(Ufe::PathSegment(components, ufe::getUsdRunTimeId(), '/')),
+            editedAsMayaRoots);
+    }
+    return editedAsMayaRoots;
+}
+
 namespace {
 
 Ufe::PathSegment::Components trieNodeToPathComponents(PulledPrimNode::Ptr trieNode)
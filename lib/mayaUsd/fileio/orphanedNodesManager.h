@@ -24,6 +24,9 @@
 #include <ufe/sceneNotification.h>
 #include <ufe/trie.h>
 
+#include <memory>
+#include <vector>
+
 namespace MAYAUSD_NS_DEF {
 
 /// \class OrphanedNodesManager
@@ -101,6 +104,10 @@ public:
     using PulledPrimNode = Ufe::TrieNode<PullVariantInfos>;
 
     /// \brief Entire state of the OrphanedNodesManager at a point in time, used for undo/redo.
+    ///
+    /// The memento shares the trie of pulled prims with the manager: the manager copies
+    /// the trie before modifying it when a memento still refers to it, so preserving the
+    /// state of the manager is cheap.
     class MAYAUSD_CORE_PUBLIC Memento
     {
     public:
@@ -121,11 +128,12 @@ public:
         // Private, for opacity.
         friend class OrphanedNodesManager;
 
-        Memento(PulledPrims&& pulledPrims);
+        Memento(const std::shared_ptr<PulledPrims>& pulledPrims);
 
-        PulledPrims release();
+        std::shared_ptr<PulledPrims> release();
 
-        PulledPrims _pulledPrims;
+        // Never modified while shared.
+        std::shared_ptr<PulledPrims> _pulledPrims;
     };
 
     // Construct an empty orphan manager.
@@ -167,9 +175,18 @@ public:
     // orphaned.
     bool isOrphaned(const Ufe::Path& pulledPath, const MDagPath& editedAsMayaRoot) const;
 
-    const PulledPrims& getPulledPrims() const { return _pulledPrims; }
+    // Return true if the argument path or one of its descendants is pulled
+    // and its Dag hierarchy is not orphaned.  Only walks down the argument
+    // path in the trie of pulled descendants, then reads the visibility of
+    // their pull parents until one is visible.
+    bool hasPulledDescendant(const Ufe::Path& path) const;
+
+    const PulledPrims& getPulledPrims() const { return *_pulledPrims; }
 
 private:
+    // Edited as Maya roots of the pulled paths at or below each path.
+    using PulledDescendants = Ufe::Trie<std::vector<MDagPath>>;
+
     void handleOp(const Ufe::SceneCompositeNotification::Op& op);
 
     static void recursiveSetOrphaned(const PulledPrimNode::Ptr& trieNode, bool orphaned);
@@ -179,6 +196,11 @@ private:
         const bool                 processOrphans);
 
     static bool setOrphaned(const PulledPrimNode::Ptr& trieNode, bool orphaned);
+    static bool isPullParentVisible(const MDagPath& editedAsMayaRoot);
+    static std::vector<MDagPath> recursiveAddPulledDescendants(
+        const PulledPrimNode::Ptr&    trieNode,
+        Ufe::PathSegment::Components& components,
+        PulledDescendants&            pulledDescendants);
     static bool setOrphaned(
         const PulledPrimNode::Ptr& trieNode,
         const PullVariantInfo&     variantInfo,
@@ -187,13 +209,28 @@ private:
     // Member function to access private nested classes.
     static std::list<VariantSetDescriptor> variantSetDescriptors(const Ufe::Path& path);
 
+    // Return the trie of pulled prims for modification, copying it first if
+    // it is shared with a memento.
+    PulledPrims& modifiablePulledPrims();
+
+    // Return the trie of pulled descendants, rebuilding it if it was
+    // invalidated.
+    const PulledDescendants& pulledDescendants() const;
+
     static PulledPrims deepCopy(const PulledPrims& src);
     static void        deepCopy(const PulledPrimNode::Ptr& src, const PulledPrimNode::Ptr& dst);
 
     // Trie for fast lookup of descendant pulled prims.  The Trie key is the
     // UFE pulled path, and the Trie value is the corresponding Dag pull parent
-    // and all ancestor variant set selections.
-    PulledPrims _pulledPrims;
+    // and all ancestor variant set selections.  Shared with the mementos
+    // preserving it, see modifiablePulledPrims().
+    std::shared_ptr<PulledPrims> _pulledPrims;
+
+    // Trie for fast lookup of the pull parents below a path.  Only depends on
+    // the trie of pulled prims, not on the visibility of the pull parents,
+    // which is read at lookup.  Reset when the trie of pulled prims changes,
+    // and rebuilt on the next lookup, see pulledDescendants().
+    mutable std::unique_ptr<PulledDescendants> _pulledDescendants;
 
     // Flag to tell that the orphaned nodes manager is currently orphaning
     // nodes and should not react to its own actions.
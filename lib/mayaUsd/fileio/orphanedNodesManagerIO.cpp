@@ -321,7 +321,9 @@ PullInfoTrie convertToPullInfoTrie(const PXR_NS::JsObject& allPullInfoJson)
 std::string Memento::convertToJson(const Memento& memento)
 {
     try {
-        return PXR_NS::JsWriteToString(convertToObject(memento._pulledPrims));
+        if (!memento._pulledPrims)
+            return PXR_NS::JsWriteToString(PXR_NS::JsObject());
+        return PXR_NS::JsWriteToString(convertToObject(*memento._pulledPrims));
     } catch (const std::exception& e) {
         // Note: the TF_RUNTIME_ERROR macro needs to be used within the PXR_NS.
         PXR_NAMESPACE_USING_DIRECTIVE
@@ -337,7 +339,8 @@ Memento Memento::convertFromJson(const std::string& json)
     Memento memento;
 
     try {
-        memento._pulledPrims = convertToPullInfoTrie(convertToObject(PXR_NS::JsParseString(json)));
+        memento._pulledPrims = std::make_shared<PullInfoTrie>(
+            convertToPullInfoTrie(convertToObject(PXR_NS::JsParseString(json))));
     } catch (const std::exception& e) {
         // Note: the TF_RUNTIME_ERROR macro needs to be used within the PXR_NS.
         PXR_NAMESPACE_USING_DIRECTIVE
@@ -35,6 +35,10 @@ bool UsdMayaPrimReader::HasPostReadSubtree() const { return false; }
 
 void UsdMayaPrimReader::PostReadSubtree(UsdMayaPrimReaderContext&) { }
 
+bool UsdMayaPrimReader::SupportsParallelPrefetch() const { return false; }
+
+void UsdMayaPrimReader::Prefetch() { }
+
 const UsdMayaPrimReaderArgs& UsdMayaPrimReader::_GetArgs() { return _args; }
 
 PXR_NAMESPACE_CLOSE_SCOPE
@@ -69,6 +69,26 @@ public:
     MAYAUSD_CORE_PUBLIC
     virtual void PostReadSubtree(UsdMayaPrimReaderContext& context);
 
+    /// Whether this prim reader implements Prefetch(), allowing the read job
+    /// to run it concurrently with the Prefetch() of other readers when the
+    /// parallelRead import option is enabled.
+    ///
+    /// Base implementation returns \c false.
+    MAYAUSD_CORE_PUBLIC
+    virtual bool SupportsParallelPrefetch() const;
+
+    /// Optional first stage of an import, possibly run on a worker thread
+    /// concurrently with the Prefetch() of other readers, before any Maya
+    /// node is created. Reads and decodes the USD data needed by Read() into
+    /// the reader. Implementations must only read from the USD stage and
+    /// must neither create nor query Maya nodes; Read() is still called on
+    /// the main thread afterwards and must work whether or not Prefetch()
+    /// ran.
+    ///
+    /// Base implementation does nothing.
+    MAYAUSD_CORE_PUBLIC
+    virtual void Prefetch();
+
 protected:
     /// Input arguments. Read data about the input USD prim from here.
     MAYAUSD_CORE_PUBLIC
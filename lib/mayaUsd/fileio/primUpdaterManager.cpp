@@ -130,8 +130,12 @@ bool PrimUpdaterManager::hasEditedDescendant(const Ufe::Path& ufeQueryPath) cons
 #ifdef HAS_ORPHANED_NODES_MANAGER
     if (_orphanedNodesManager->has(ufeQueryPath))
         return true;
-#endif
 
+    // The trie of pulled prims of the orphaned nodes manager indexes the
+    // members of the pull set by pulled path, so only the pulled prims under
+    // the query path need to be looked at.
+    return _orphanedNodesManager->hasPulledDescendant(ufeQueryPath);
+#else
     MObject pullSetObj;
     auto    status = UsdMayaUtil::GetMObjectByName(kPullSetName, pullSetObj);
     if (status != MStatus::kSuccess)
@@ -149,20 +153,12 @@ bool PrimUpdaterManager::hasEditedDescendant(const Ufe::Path& ufeQueryPath) cons
         if (!readPullInformation(pulledDagPath, pulledUfePath))
             continue;
 
-#ifdef HAS_ORPHANED_NODES_MANAGER
-        // If the alread-edited node is orphaned, don't take it into consideration.
-        if (_orphanedNodesManager) {
-            if (_orphanedNodesManager->isOrphaned(pulledUfePath, pulledDagPath)) {
-                continue;
-            }
-        }
-#endif
-
         if (pulledUfePath.startsWith(ufeQueryPath))
             return true;
     }
 
     return false;
+#endif
 }
 
 namespace {
@@ -1989,16 +1985,42 @@ void PrimUpdaterManager::loadOrphanedNodesManagerData()
 
     beginManagePulledPrims();
 
-    if (!hasDynamicAttribute(pullRoot, orphanedNodesManagerDynAttrName))
-        return;
-
     MString json;
-    if (!getDynamicAttribute(pullRoot, orphanedNodesManagerDynAttrName, json))
+    if (!hasDynamicAttribute(pullRoot, orphanedNodesManagerDynAttrName)
+        || !getDynamicAttribute(pullRoot, orphanedNodesManagerDynAttrName, json)) {
+        // Scenes saved before the orphaned nodes manager state was stored
+        // only have the pull set: index its members so that queries on
+        // pulled prims do not miss them.
+        recordPullSetMembers();
         return;
+    }
 
     _orphanedNodesManager->restore(OrphanedNodesManager::Memento::convertFromJson(json.asChar()));
 }
 
+void PrimUpdaterManager::recordPullSetMembers()
+{
+    MObject pullSetObj;
+    auto    status = UsdMayaUtil::GetMObjectByName(kPullSetName, pullSetObj);
+    if (status != MStatus::kSuccess)
+        return;
+
+    MFnSet         fnPullSet(pullSetObj);
+    MSelectionList members;
+    const bool     flatten = true;
+    fnPullSet.getMembers(members, flatten);
+
+    for (unsigned int i = 0; i < members.length(); ++i) {
+        MDagPath pulledDagPath;
+        if (members.getDagPath(i, pulledDagPath) != MStatus::kSuccess)
+            continue;
+        Ufe::Path pulledUfePath;
+        if (!readPullInformation(pulledDagPath, pulledUfePath))
+            continue;
+        _orphanedNodesManager->add(pulledUfePath, pulledDagPath);
+    }
+}
+
 void PrimUpdaterManager::saveOrphanedNodesManagerData()
 {
     MObject pullRoot = findPullRoot();
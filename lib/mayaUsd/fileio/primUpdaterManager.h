@@ -135,6 +135,9 @@ private:
 
     void loadOrphanedNodesManagerData();
     void saveOrphanedNodesManagerData();
+
+    // Add the members of the pull set to the orphaned nodes manager.
+    void recordPullSetMembers();
 #endif
 
     friend class TfSingleton<PrimUpdaterManager>;
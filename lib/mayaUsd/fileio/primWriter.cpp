@@ -77,7 +77,7 @@ UsdMayaPrimWriter::UsdMayaPrimWriter(
     , _mayaObject(depNodeFn.object())
     , _usdPath(usdPath)
     , _baseDagToUsdPaths(UsdMayaUtil::getDagPathMap(depNodeFn, usdPath))
-    , _valueWriter(jobCtx.GetArgs().writeDefaults)
+    , _valueWriter(jobCtx.GetArgs().writeDefaults, jobCtx.GetArgs().timeSampleTolerance)
     , _exportVisibility(jobCtx.GetArgs().exportVisibility)
     , _hasAnimCurves(_IsAnimated(jobCtx.GetArgs(), depNodeFn.object()))
 {
@@ -213,6 +213,18 @@ void UsdMayaPrimWriter::Write(const UsdTimeCode& usdTime)
         GetMayaObject(), _usdPrim, usdTime, _GetSparseValueWriter());
 }
 
+/* virtual */
+bool UsdMayaPrimWriter::SupportsParallelWrite() const { return false; }
+
+/* virtual */
+void UsdMayaPrimWriter::GatherFrameData(const UsdTimeCode&) { }
+
+/* virtual */
+void UsdMayaPrimWriter::ComputeFrameData(const UsdTimeCode&) { }
+
+/* virtual */
+void UsdMayaPrimWriter::CommitFrameData(const UsdTimeCode&) { }
+
 /* virtual */
 bool UsdMayaPrimWriter::ExportsGprims() const { return false; }
 
@@ -222,6 +234,9 @@ bool UsdMayaPrimWriter::ShouldPruneChildren() const { return false; }
 /* virtual */
 void UsdMayaPrimWriter::PostExport() { MakeSingleSamplesStatic(); }
 
+/* virtual */
+void UsdMayaPrimWriter::FlushTimeSamples() { _valueWriter.Clear(); }
+
 void UsdMayaPrimWriter::SetExportVisibility(const bool exportVis) { _exportVisibility = exportVis; }
 
 bool UsdMayaPrimWriter::GetExportVisibility() const { return _exportVisibility; }
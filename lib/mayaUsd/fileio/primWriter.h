@@ -91,12 +91,62 @@ public:
     MAYAUSD_CORE_PUBLIC
     virtual void Write(const UsdTimeCode& usdTime);
 
+    /// Whether this prim writer splits its per-frame work into the
+    /// GatherFrameData(), ComputeFrameData() and CommitFrameData() stages,
+    /// allowing the write job to run ComputeFrameData() concurrently with
+    /// other writers when the parallelWrite export option is enabled.
+    ///
+    /// Base implementation returns \c false; such writers are always run
+    /// serially through Write().
+    MAYAUSD_CORE_PUBLIC
+    virtual bool SupportsParallelWrite() const;
+
+    /// First stage of a parallel frame write, always run on the main thread.
+    /// Reads all the Maya data needed for \p usdTime into the writer.
+    /// This is the only stage allowed to evaluate or query Maya nodes.
+    ///
+    /// Base implementation does nothing.
+    MAYAUSD_CORE_PUBLIC
+    virtual void GatherFrameData(const UsdTimeCode& usdTime);
+
+    /// Second stage of a parallel frame write, possibly run on a worker
+    /// thread concurrently with the ComputeFrameData() of other writers.
+    /// Converts the gathered data into USD values. Implementations must
+    /// neither evaluate nor query Maya nodes, nor author anything on the USD
+    /// stage.
+    ///
+    /// Base implementation does nothing.
+    MAYAUSD_CORE_PUBLIC
+    virtual void ComputeFrameData(const UsdTimeCode& usdTime);
+
+    /// Last stage of a parallel frame write, always run on the main thread,
+    /// at the position of this writer among the Write() calls of the serial
+    /// writers, inside an SdfChangeBlock shared with the adjacent parallel
+    /// writers. Authors the values computed by ComputeFrameData() on the USD
+    /// stage.
+    ///
+    /// Base implementation does nothing.
+    MAYAUSD_CORE_PUBLIC
+    virtual void CommitFrameData(const UsdTimeCode& usdTime);
+
     /// Post export function that runs before saving the stage.
     ///
     /// Base implementation handles optional optimization of data.
     MAYAUSD_CORE_PUBLIC
     virtual void PostExport();
 
+    /// Writes the time samples held back by the sparse value writer while
+    /// it decides whether they can be dropped, and releases the values it
+    /// remembers, so that the next time sample of each attribute is written.
+    /// Run by the write job after the last frame has been written, before
+    /// PostExport(), and after each chunk of frames when streaming to value
+    /// clips.
+    ///
+    /// Writers owning other prim writers should override it to flush those
+    /// as well.
+    MAYAUSD_CORE_PUBLIC
+    virtual void FlushTimeSamples();
+
     /// Whether this prim writer directly create one or more gprims on the
     /// current model on the USD stage. (Excludes cases where the prim writer
     /// introduces gprims via a reference or by adding a sub-model, such as in
@@ -333,6 +333,7 @@ private:
         }
 
         for (auto&& writerEntry : shaderWriterMap) {
+            writerEntry.second->FlushTimeSamples();
             writerEntry.second->PostExport();
         }
 
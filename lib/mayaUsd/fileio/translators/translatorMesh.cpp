@@ -50,25 +50,9 @@
 
 namespace MAYAUSD_NS_DEF {
 
-TranslatorMeshRead::TranslatorMeshRead(
-    const UsdGeomMesh&        mesh,
-    const UsdPrim&            prim,
-    const MObject&            transformObj,
-    const MObject&            stageNode,
-    const GfInterval&         frameRange,
-    bool                      wantCacheAnimation,
-    UsdMayaPrimReaderContext* context,
-    MStatus*                  status)
-    : m_wantCacheAnimation(wantCacheAnimation)
-    , m_pointsNumTimeSamples(0u)
+bool TranslatorMeshReadData::fetch(const UsdGeomMesh& mesh, const GfInterval& frameRange)
 {
-    MStatus stat { MS::kSuccess };
-
-    // ==============================================
-    // construct a Maya mesh
-    // ==============================================
-    VtIntArray faceVertexCounts;
-    VtIntArray faceVertexIndices;
+    const UsdPrim& prim = mesh.GetPrim();
 
     const UsdAttribute fvc = mesh.GetFaceVertexCountsAttr();
     if (fvc.ValueMightBeTimeVarying()) {
@@ -108,7 +92,7 @@ TranslatorMeshRead::TranslatorMeshRead(
 
     // If the USD mesh was left-handed, then the faces had their vertices in left-handed order.
     // Fix them to be in right-handed order, as expected by Maya.
-    if (isPrimitiveLeftHanded(mesh)) {
+    if (TranslatorMeshRead::isPrimitiveLeftHanded(mesh)) {
         size_t firstIndex = 0;
         for (int vertexCount : faceVertexCounts) {
             std::reverse(
@@ -121,17 +105,12 @@ TranslatorMeshRead::TranslatorMeshRead(
     // Gather points and normals
     // If timeInterval is non-empty, pick the first available sample in the
     // timeInterval or default.
-    VtVec3fArray        points;
-    VtVec3fArray        normals;
-    TfToken             normalsInterpolation;
-    UsdTimeCode         pointsTimeSample = UsdTimeCode::EarliestTime();
-    UsdTimeCode         normalsTimeSample = UsdTimeCode::EarliestTime();
-    std::vector<double> pointsTimeSamples;
+    UsdTimeCode pointsTimeSample = UsdTimeCode::EarliestTime();
+    UsdTimeCode normalsTimeSample = UsdTimeCode::EarliestTime();
 
     if (!frameRange.IsEmpty()) {
         mesh.GetPointsAttr().GetTimeSamplesInInterval(frameRange, &pointsTimeSamples);
         if (!pointsTimeSamples.empty()) {
-            m_pointsNumTimeSamples = pointsTimeSamples.size();
             pointsTimeSample = pointsTimeSamples.front();
         }
 
@@ -161,16 +140,55 @@ TranslatorMeshRead::TranslatorMeshRead(
     }
 
     std::string reason;
-    if (!UsdGeomMesh::ValidateTopology(
-            faceVertexIndices, faceVertexCounts, points.size(), &reason)) {
+    validTopology = UsdGeomMesh::ValidateTopology(
+        faceVertexIndices, faceVertexCounts, points.size(), &reason);
+    if (!validTopology) {
         TF_RUNTIME_ERROR(
             "Skipping Mesh <%s> with invalid topology: %s",
             prim.GetPath().GetText(),
             reason.c_str());
+    }
+
+    return validTopology;
+}
+
+TranslatorMeshRead::TranslatorMeshRead(
+    const UsdGeomMesh&            mesh,
+    const UsdPrim&                prim,
+    const MObject&                transformObj,
+    const MObject&                stageNode,
+    const GfInterval&             frameRange,
+    bool                          wantCacheAnimation,
+    UsdMayaPrimReaderContext*     context,
+    MStatus*                      status,
+    const TranslatorMeshReadData* prefetchedData)
+    : m_wantCacheAnimation(wantCacheAnimation)
+    , m_pointsNumTimeSamples(0u)
+{
+    MStatus stat { MS::kSuccess };
+
+    // ==============================================
+    // construct a Maya mesh
+    // ==============================================
+    TranslatorMeshReadData fetchedData;
+    if (!prefetchedData) {
+        fetchedData.fetch(mesh, frameRange);
+        prefetchedData = &fetchedData;
+    }
+
+    if (!prefetchedData->validTopology) {
         *status = MS::kFailure;
         return;
     }
 
+    const VtIntArray&          faceVertexCounts = prefetchedData->faceVertexCounts;
+    const VtIntArray&          faceVertexIndices = prefetchedData->faceVertexIndices;
+    const TfToken&             normalsInterpolation = prefetchedData->normalsInterpolation;
+    const std::vector<double>& pointsTimeSamples = prefetchedData->pointsTimeSamples;
+    VtVec3fArray               points = prefetchedData->points;
+    VtVec3fArray               normals = prefetchedData->normals;
+    m_pointsNumTimeSamples = pointsTimeSamples.size();
+
     // == Convert data to Maya ( vertices, faces, indices )
     const size_t mayaNumVertices = points.size();
     MPointArray  mayaPoints(mayaNumVertices);
@@ -27,24 +27,48 @@
 #include <maya/MObject.h>
 #include <maya/MString.h>
 
+#include <vector>
+
 PXR_NAMESPACE_USING_DIRECTIVE
 
 namespace MAYAUSD_NS_DEF {
 
+/// The USD data needed to build a Maya mesh, decoded into plain buffers.
+/// Fetching it only reads from the USD stage, so it can be done on a worker
+/// thread ahead of the creation of the Maya nodes.
+struct MAYAUSD_CORE_PUBLIC TranslatorMeshReadData
+{
+    /// Reads the topology, points and normals of \p mesh, using the first
+    /// time sample found in \p frameRange. Returns false if the topology
+    /// is invalid.
+    bool fetch(const UsdGeomMesh& mesh, const GfInterval& frameRange);
+
+    VtIntArray          faceVertexCounts;
+    VtIntArray          faceVertexIndices; // Always in right-handed order.
+    VtVec3fArray        points;
+    VtVec3fArray        normals;
+    TfToken             normalsInterpolation;
+    std::vector<double> pointsTimeSamples;
+    bool                validTopology = false;
+};
+
 /// Provides helper functions for translating UsdGeomMesh prims into Maya
 /// meshes.
 class MAYAUSD_CORE_PUBLIC TranslatorMeshRead
 {
 public:
+    /// When \p prefetchedData is null, the USD data of the mesh is fetched
+    /// by the constructor itself.
     TranslatorMeshRead(
-        const UsdGeomMesh&        mesh,
-        const UsdPrim&            prim,
-        const MObject&            transformObj,
-        const MObject&            stageNode,
-        const GfInterval&         frameRange,
-        bool                      wantCacheAnimation,
-        UsdMayaPrimReaderContext* context,
-        MStatus*                  status = nullptr);
+        const UsdGeomMesh&            mesh,
+        const UsdPrim&                prim,
+        const MObject&                transformObj,
+        const MObject&                stageNode,
+        const GfInterval&             frameRange,
+        bool                          wantCacheAnimation,
+        UsdMayaPrimReaderContext*     context,
+        MStatus*                      status = nullptr,
+        const TranslatorMeshReadData* prefetchedData = nullptr);
 
     ~TranslatorMeshRead() = default;
 
@@ -63,6 +87,8 @@ public:
     SdfPath shapePath() const;
 
 private:
+    friend struct TranslatorMeshReadData;
+
     MStatus setPointBasedDeformerForMayaNode(const MObject&, const MObject&, const UsdPrim&);
 
     static bool isPrimitiveLeftHanded(const UsdGeomGprim& prim);
@@ -46,6 +46,10 @@
 #include <maya/MPlug.h>
 #include <maya/MPlugArray.h>
 
+#include <algorithm>
+#include <utility>
+#include <vector>
+
 PXR_NAMESPACE_OPEN_SCOPE
 
 // There are a lot of nodes and connections that go into a basic skinning rig.
@@ -889,13 +893,86 @@ MObject UsdMayaTranslatorSkel::GetBindPose(
 
 namespace {
 
-bool _SetVaryingJointInfluences(
+/// Scope during which the weights set on a skinCluster are not normalized.
+///
+/// Note that weights are expected to be pre-normalized in USD.
+/// In order to faithfully transfer our source data, we do not perform
+/// any normalization on import. Maya's weight normalization also seems
+/// finicky w.r.t. precision, and tends to throw warnings even when the
+/// weights have been properly normalized, so this also saves us from
+/// unnecessary warning spam.
+///
+/// If the 'normalizeWeights' attribute of the skinCluster is set to
+/// 'interactive' -- and by default, it is -- then weights are still
+/// normalized even if we set normalize=false on
+/// MFnSkinCluster::normalize(). This fact is unfortunately not made
+/// clear in the MFnSkinCluster documentation...
+/// So the attr is temporarily set to 'none'.
+class _WeightNormalizationDisabler
+{
+public:
+    _WeightNormalizationDisabler(MFnSkinCluster& skinClusterFn)
+    {
+        MStatus status;
+        _normalizeWeights = skinClusterFn.findPlug(_MayaTokens->normalizeWeights, &status);
+        if (!_normalizeWeights.isNull()) {
+            _initialNormalizeWeights = _normalizeWeights.asString();
+            _normalizeWeights.setString(_MayaTokens->none);
+        }
+    }
+
+    ~_WeightNormalizationDisabler()
+    {
+        // Reset the normalization flag to its previous value.
+        if (!_normalizeWeights.isNull()) {
+            _normalizeWeights.setString(_initialNormalizeWeights);
+        }
+    }
+
+private:
+    MPlug   _normalizeWeights;
+    MString _initialNormalizeWeights;
+};
+
+/// Sum the weights of the \p numInfluences influences starting at
+/// \p influenceOffset per valid joint index, skipping zero weights.
+/// There may be multiple influences referencing the same joint for a point,
+/// eg., 'unweighted' points are assigned index 0 and weight 0.
+void _SumJointWeights(
+    const VtIntArray&                    indices,
+    const VtFloatArray&                  weights,
+    size_t                               influenceOffset,
+    int                                  numInfluences,
+    unsigned int                         numJoints,
+    std::vector<std::pair<int, double>>* jointWeights)
+{
+    jointWeights->clear();
+    for (int c = 0; c < numInfluences; ++c) {
+        const int   jointIdx = indices[influenceOffset + c];
+        const float w = weights[influenceOffset + c];
+        if (jointIdx < 0 || static_cast<unsigned int>(jointIdx) >= numJoints || w == 0.0f) {
+            continue;
+        }
+        auto found = std::find_if(
+            jointWeights->begin(), jointWeights->end(), [jointIdx](const auto& jointWeight) {
+                return jointWeight.first == jointIdx;
+            });
+        if (found != jointWeights->end()) {
+            found->second += w;
+        } else {
+            jointWeights->emplace_back(jointIdx, w);
+        }
+    }
+}
+
+/// Set the weights of the skinCluster for every point of the mesh when
+/// all the points have the same joint influences.
+bool _SetConstantJointInfluences(
     const MFnMesh&          meshFn,
     const MObject&          skinCluster,
     const VtArray<MObject>& joints,
     const VtIntArray&       indices,
     const VtFloatArray&     weights,
-    int                     numInfluencesPerPoint,
     unsigned int            numPoints)
 {
     if (joints.empty())
@@ -910,58 +987,39 @@ bool _SetVaryingJointInfluences(
     MFnSkinCluster skinClusterFn(skinCluster, &status);
     CHECK_MSTATUS_AND_RETURN(status, false);
 
-    const unsigned int numJoints = static_cast<unsigned int>(joints.size());
+    std::vector<std::pair<int, double>> jointWeights;
+    _SumJointWeights(
+        indices,
+        weights,
+        0,
+        static_cast<int>(indices.size()),
+        static_cast<unsigned int>(joints.size()),
+        &jointWeights);
+    if (jointWeights.empty())
+        return true;
 
-    // Compute a vertex-ordered weight arrays. Weights are stored as:
-    //   vert_0_joint_0 ... vert_0_joint_n ... vert_n_joint_0 ... vert_n_joint_n
-    MDoubleArray vertOrderedWeights(numPoints * numJoints, 0.0f);
-    for (unsigned int pt = 0; pt < numPoints; ++pt) {
-        for (int c = 0; c < numInfluencesPerPoint; ++c) {
-            int jointIdx = indices[pt * numInfluencesPerPoint + c];
-            if (jointIdx >= 0 && static_cast<unsigned int>(jointIdx) < numJoints) {
-                float w = weights[pt * numInfluencesPerPoint + c];
-                // There may be multiple influences referencing the same joint
-                // for this point. eg., 'unweighted' points are assigned
-                // index 0 and weight 0. Sum the weight contributions to ensure
-                // that we properly account for this.
-                vertOrderedWeights[pt * numJoints + jointIdx] += w;
-            }
-        }
+    // Only the influencing joints are set, the weights of the other joints
+    // are left to their default value of zero.
+    const unsigned int numInfluences = static_cast<unsigned int>(jointWeights.size());
+    MIntArray          influenceIndices(numInfluences);
+    for (unsigned int i = 0; i < numInfluences; ++i) {
+        influenceIndices[i] = jointWeights[i].first;
     }
 
-    MIntArray influenceIndices(numJoints);
-    for (unsigned int i = 0; i < numJoints; ++i) {
-        influenceIndices[i] = i;
+    // Weights are stored as:
+    //   vert_0_influence_0 ... vert_0_influence_n ... vert_n_influence_0 ... vert_n_influence_n
+    MDoubleArray vertOrderedWeights(numPoints * numInfluences);
+    for (unsigned int pt = 0; pt < numPoints; ++pt) {
+        for (unsigned int i = 0; i < numInfluences; ++i) {
+            vertOrderedWeights[pt * numInfluences + i] = jointWeights[i].second;
+        }
     }
 
-    // Set all weights in one batch
     MFnSingleIndexedComponent components;
     components.create(MFn::kMeshVertComponent);
     components.setCompleteData(numPoints);
 
-    // XXX: Note that weights are expected to be pre-normalized in USD.
-    // In order to faithfully transfer our source data, we do not perform
-    // any normalization on import. Maya's weight normalization also seems
-    // finicky w.r.t. precision, and tends to throw warnings even when the
-    // weights have been properly normalized, so this also saves us from
-    // unnecessary warning spam.
-
-    // If the 'normalizeWeights' attribute of the skinCluster is set to
-    // 'interactive' -- and by default, it is -- then weights are still
-    // normalized even if we set normalize=false on
-    // MFnSkinCluster::normalize(). This fact is unfortunately not made
-    // clear in the MFnSkinCluster documentation...
-    // Temporarily set the attr to 'none'
-
-    MPlug   normalizeWeights = skinClusterFn.findPlug(_MayaTokens->normalizeWeights, &status);
-    MString initialNormalizeWeights;
-    if (!normalizeWeights.isNull()) {
-        initialNormalizeWeights = normalizeWeights.asString();
-        normalizeWeights.setString(_MayaTokens->none);
-    }
-
-    status = skinClusterFn.setObject(skinCluster);
-    CHECK_MSTATUS_AND_RETURN(status, false);
+    _WeightNormalizationDisabler normalizationDisabler(skinClusterFn);
 
     // Apply the weights. Note that this fails with kInvalidParameter
     // if the influenceIndices are invalid. Validity is based on the
@@ -974,9 +1032,85 @@ bool _SetVaryingJointInfluences(
         /*normalize*/ false);
     CHECK_MSTATUS_AND_RETURN(status, false);
 
-    // Reset the normalization flag to its previous value.
-    if (!normalizeWeights.isNull()) {
-        normalizeWeights.setString(initialNormalizeWeights);
+    return true;
+}
+
+/// Set the weights of the skinCluster from per-point joint influences.
+///
+/// Rather than expanding the influences to a dense numPoints * numJoints
+/// array of weights, the weights are set joint by joint, only for the points
+/// the joint influences. Memory and time then scale with the number of
+/// influences.
+bool _SetVaryingJointInfluences(
+    const MFnMesh&          meshFn,
+    const MObject&          skinCluster,
+    const VtArray<MObject>& joints,
+    const VtIntArray&       indices,
+    const VtFloatArray&     weights,
+    int                     numInfluencesPerPoint,
+    unsigned int            numPoints)
+{
+    if (joints.empty())
+        return true;
+
+    MStatus status;
+
+    MDagPath dagPath;
+    status = meshFn.getPath(dagPath);
+    CHECK_MSTATUS_AND_RETURN(status, false);
+
+    MFnSkinCluster skinClusterFn(skinCluster, &status);
+    CHECK_MSTATUS_AND_RETURN(status, false);
+
+    const unsigned int numJoints = static_cast<unsigned int>(joints.size());
+
+    // Gather the points influenced by each joint, with their weight.
+    std::vector<MIntArray>              jointPoints(numJoints);
+    std::vector<MDoubleArray>           jointPointWeights(numJoints);
+    std::vector<std::pair<int, double>> pointJointWeights;
+    for (unsigned int pt = 0; pt < numPoints; ++pt) {
+        _SumJointWeights(
+            indices,
+            weights,
+            static_cast<size_t>(pt) * numInfluencesPerPoint,
+            numInfluencesPerPoint,
+            numJoints,
+            &pointJointWeights);
+        for (const auto& jointWeight : pointJointWeights) {
+            jointPoints[jointWeight.first].append(static_cast<int>(pt));
+            jointPointWeights[jointWeight.first].append(jointWeight.second);
+        }
+    }
+
+    _WeightNormalizationDisabler normalizationDisabler(skinClusterFn);
+
+    // The weights of the points a joint does not influence are left to their
+    // default value of zero.
+    MIntArray influenceIndices(1);
+    for (unsigned int joint = 0; joint < numJoints; ++joint) {
+        if (jointPoints[joint].length() == 0) {
+            continue;
+        }
+
+        MFnSingleIndexedComponent components;
+        components.create(MFn::kMeshVertComponent);
+        components.addElements(jointPoints[joint]);
+
+        // Apply the weights. Note that this fails with kInvalidParameter
+        // if the influenceIndices are invalid. Validity is based on the
+        // set of joints wired up to the skinCluster.
+        influenceIndices[0] = static_cast<int>(joint);
+        status = skinClusterFn.setWeights(
+            dagPath,
+            components.object(),
+            influenceIndices,
+            jointPointWeights[joint],
+            /*normalize*/ false);
+        CHECK_MSTATUS_AND_RETURN(status, false);
+
+        // Release the memory of the joint as soon as its weights are set.
+        jointPoints[joint].clear();
+        jointPointWeights[joint].clear();
     }
 
     return true;
@@ -998,6 +1132,16 @@ bool _ComputeAndSetJointInfluences(
 
     VtIntArray   indices;
     VtFloatArray weights;
+
+    // Constant influences are not expanded to every point.
+    if (skinningQuery.IsRigidlyDeformed()) {
+        if (skinningQuery.ComputeJointInfluences(&indices, &weights)) {
+            return _SetConstantJointInfluences(
+                meshFn, skinCluster, joints, indices, weights, numPoints);
+        }
+        return false;
+    }
+
     if (skinningQuery.ComputeVaryingJointInfluences(numPoints, &indices, &weights)) {
 
         return _SetVaryingJointInfluences(
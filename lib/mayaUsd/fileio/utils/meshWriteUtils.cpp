@@ -41,6 +41,7 @@
 #include <pxr/usd/usdUtils/pipeline.h>
 
 #include <maya/MBoundingBox.h>
+#include <maya/MDoubleArray.h>
 #include <maya/MFnAttribute.h>
 #include <maya/MFnGeometryData.h>
 #include <maya/MFnMesh.h>
@@ -57,6 +58,8 @@
 #include <maya/MUintArray.h>
 #include <maya/MVector.h>
 
+#include <cstring>
+
 static constexpr char kMayaAttrNameInMesh[] = "inMesh";
 
 PXR_NAMESPACE_OPEN_SCOPE
@@ -351,6 +354,59 @@ GfVec3f LinearColorFromColorSet(const MColor& mayaColor, bool shouldConvertToLin
     return c;
 }
 
+// MIntArray only gives access to its storage through its non-const operator[].
+const int* _intArrayData(const MIntArray& mayaArray)
+{
+    return &const_cast<MIntArray&>(mayaArray)[0];
+}
+
+// Whether the Maya array holds the same values as the cached one.
+bool _isSameIntArray(const MIntArray& mayaArray, const VtIntArray& cached)
+{
+    const unsigned int count = mayaArray.length();
+    if (count != cached.size()) {
+        return false;
+    }
+    return count == 0u
+        || memcmp(_intArrayData(mayaArray), cached.cdata(), count * sizeof(int)) == 0;
+}
+
+bool _isSameIntArray(const MIntArray& mayaArray, const MIntArray& cached)
+{
+    const unsigned int count = mayaArray.length();
+    if (count != cached.length()) {
+        return false;
+    }
+    return count == 0u
+        || memcmp(_intArrayData(mayaArray), _intArrayData(cached), count * sizeof(int))
+        == 0;
+}
+
+// Same for the Maya arrays holding crease and hole data, which are small.
+template <typename MArray> bool _isSameMArray(const MArray& mayaArray, const MArray& cached)
+{
+    const unsigned int count = mayaArray.length();
+    if (count != cached.length()) {
+        return false;
+    }
+    for (unsigned int i = 0u; i < count; ++i) {
+        if (mayaArray[i] != cached[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+VtIntArray _toVtIntArray(const MIntArray& mayaArray)
+{
+    const unsigned int count = mayaArray.length();
+    VtIntArray         result(count);
+    if (count > 0u) {
+        memcpy(result.data(), _intArrayData(mayaArray), count * sizeof(int));
+    }
+    return result;
+}
+
 } // anonymous namespace
 
 MStatus
@@ -479,21 +535,31 @@ bool UsdMayaMeshWriteUtils::getMeshNormals(
         return false;
     }
 
-    normalsArray->resize(numFaceVertices);
     *interpolation = UsdGeomTokens->faceVarying;
 
     // get normal indices for all vertices of faces
     MIntArray normalCounts, normalIndices;
     mesh.getNormalIds(normalCounts, normalIndices);
 
-    for (size_t i = 0; i < normalIndices.length(); ++i) {
-        MFloatVector normal = mayaNormals[normalIndices[i]];
+    getFaceVaryingNormals(mayaNormals, normalIndices, numFaceVertices, normalsArray);
+
+    return true;
+}
+
+void UsdMayaMeshWriteUtils::getFaceVaryingNormals(
+    const MFloatVectorArray& normals,
+    const MIntArray&         normalIds,
+    unsigned int             numFaceVertices,
+    VtVec3fArray*            normalsArray)
+{
+    normalsArray->resize(numFaceVertices);
+
+    for (size_t i = 0; i < normalIds.length(); ++i) {
+        MFloatVector normal = normals[normalIds[i]];
         (*normalsArray)[i][0] = normal[0];
         (*normalsArray)[i][1] = normal[1];
         (*normalsArray)[i][2] = normal[2];
     }
-
-    return true;
 }
 
 // This can be customized for specific pipelines.
@@ -829,23 +895,30 @@ void UsdMayaMeshWriteUtils::writeFaceVertexIndicesData(
     const MFnMesh&             meshFn,
     UsdGeomMesh&               primSchema,
     const UsdTimeCode&         usdTime,
-    FlexibleSparseValueWriter* valueWriter)
+    FlexibleSparseValueWriter* valueWriter,
+    MeshTopologyCache*         topologyCache)
 {
-    const int numFaceVertices = meshFn.numFaceVertices();
-    const int numPolygons = meshFn.numPolygons();
-
-    VtIntArray   faceVertexCounts(numPolygons);
-    VtIntArray   faceVertexIndices(numFaceVertices);
-    MIntArray    mayaFaceVertexIndices; // used in loop below
-    unsigned int curFaceVertexIndex = 0;
-    for (int i = 0; i < numPolygons; i++) {
-        meshFn.getPolygonVertices(i, mayaFaceVertexIndices);
-        faceVertexCounts[i] = mayaFaceVertexIndices.length();
-        for (unsigned int j = 0; j < mayaFaceVertexIndices.length(); j++) {
-            faceVertexIndices[curFaceVertexIndex] = mayaFaceVertexIndices[j]; // push_back
-            curFaceVertexIndex++;
+    MIntArray mayaFaceVertexCounts;
+    MIntArray mayaFaceVertexIndices;
+    meshFn.getVertices(mayaFaceVertexCounts, mayaFaceVertexIndices);
+
+    VtIntArray faceVertexCounts;
+    VtIntArray faceVertexIndices;
+    if (topologyCache && _isSameIntArray(mayaFaceVertexCounts, topologyCache->faceVertexCounts)
+        && _isSameIntArray(mayaFaceVertexIndices, topologyCache->faceVertexIndices)) {
+        topologyCache->topologyChanged = false;
+        faceVertexCounts = topologyCache->faceVertexCounts;
+        faceVertexIndices = topologyCache->faceVertexIndices;
+    } else {
+        faceVertexCounts = _toVtIntArray(mayaFaceVertexCounts);
+        faceVertexIndices = _toVtIntArray(mayaFaceVertexIndices);
+        if (topologyCache) {
+            topologyCache->topologyChanged = true;
+            topologyCache->faceVertexCounts = faceVertexCounts;
+            topologyCache->faceVertexIndices = faceVertexIndices;
         }
     }
+
     UsdMayaWriteUtil::SetAttribute(
         primSchema.GetFaceVertexCountsAttr(), &faceVertexCounts, usdTime, valueWriter);
     UsdMayaWriteUtil::SetAttribute(
@@ -857,6 +930,36 @@ void UsdMayaMeshWriteUtils::writeFaceVertexIndicesData(
         VtValue(isLeftHanded ? UsdGeomTokens->leftHanded : UsdGeomTokens->rightHanded), true);
 }
 
+bool UsdMayaMeshWriteUtils::subdivTagsChanged(MFnMesh& meshFn, MeshTopologyCache* topologyCache)
+{
+    MUintArray   creaseVertexIds;
+    MDoubleArray creaseVertexValues;
+    meshFn.getCreaseVertices(creaseVertexIds, creaseVertexValues);
+
+    MUintArray   creaseEdgeIds;
+    MDoubleArray creaseEdgeValues;
+    meshFn.getCreaseEdges(creaseEdgeIds, creaseEdgeValues);
+
+    MUintArray holes = meshFn.getInvisibleFaces();
+
+    // Edge ids are only meaningful for a given topology, so a topology
+    // change is enough to author everything again.
+    const bool changed = topologyCache->topologyChanged
+        || !_isSameMArray(creaseVertexIds, topologyCache->creaseVertexIds)
+        || !_isSameMArray(creaseVertexValues, topologyCache->creaseVertexValues)
+        || !_isSameMArray(creaseEdgeIds, topologyCache->creaseEdgeIds)
+        || !_isSameMArray(creaseEdgeValues, topologyCache->creaseEdgeValues)
+        || !_isSameMArray(holes, topologyCache->holes);
+    if (changed) {
+        topologyCache->creaseVertexIds = creaseVertexIds;
+        topologyCache->creaseVertexValues = creaseVertexValues;
+        topologyCache->creaseEdgeIds = creaseEdgeIds;
+        topologyCache->creaseEdgeValues = creaseEdgeValues;
+        topologyCache->holes = holes;
+    }
+    return changed;
+}
+
 void UsdMayaMeshWriteUtils::writeInvisibleFacesData(
     const MFnMesh&             meshFn,
     UsdGeomMesh&               primSchema,
@@ -876,11 +979,12 @@ void UsdMayaMeshWriteUtils::writeInvisibleFacesData(
 }
 
 bool UsdMayaMeshWriteUtils::getMeshUVSetData(
-    const MFnMesh& mesh,
-    const MString& uvSetName,
-    VtVec2fArray*  uvArray,
-    TfToken*       interpolation,
-    VtIntArray*    assignmentIndices)
+    const MFnMesh&     mesh,
+    const MString&     uvSetName,
+    VtVec2fArray*      uvArray,
+    TfToken*           interpolation,
+    VtIntArray*        assignmentIndices,
+    MeshTopologyCache* topologyCache)
 {
     // Check first to make sure this UV set even has assigned values before we
     // attempt to do anything with the data. We cannot directly use this data
@@ -912,29 +1016,57 @@ bool UsdMayaMeshWriteUtils::getMeshUVSetData(
         uvArray->emplace_back(uArray[uvId], vArray[uvId]);
     }
 
-    // Now iterate through all the face vertices and fill in the faceVarying
-    // assignmentIndices array, again in the same order as in the Maya mesh.
+    *interpolation = UsdGeomTokens->faceVarying;
+
+    MeshTopologyCache::UVSetIndices* cachedIndices = nullptr;
+    if (topologyCache) {
+        cachedIndices = &topologyCache->uvSetIndices[uvSetName.asChar()];
+        if (!topologyCache->topologyChanged && _isSameIntArray(uvCounts, cachedIndices->uvCounts)
+            && _isSameIntArray(uvIds, cachedIndices->uvIds)) {
+            *assignmentIndices = cachedIndices->assignmentIndices;
+            return true;
+        }
+    }
+
+    // Now fill in the faceVarying assignmentIndices array, again in the same
+    // order as in the Maya mesh. A polygon either has a UV for each of its
+    // face vertices or none at all.
     const unsigned int numFaceVertices = mesh.numFaceVertices(&status);
     CHECK_MSTATUS_AND_RETURN(status, false);
 
     assignmentIndices->assign(static_cast<size_t>(numFaceVertices), -1);
-    *interpolation = UsdGeomTokens->faceVarying;
 
-    MItMeshFaceVertex itFV(mesh.object());
-    unsigned int      fvi = 0u;
-    for (itFV.reset(); !itFV.isDone(); itFV.next(), ++fvi) {
-        if (!itFV.hasUVs(uvSetName)) {
-            // No UVs for this faceVertex, so leave it unassigned.
+    const unsigned int numPolygons = uvCounts.length();
+    const unsigned int numUVIds = uvIds.length();
+    const unsigned int numUVs = uArray.length();
+    unsigned int       fvi = 0u;
+    unsigned int       uvi = 0u;
+    for (unsigned int polygon = 0u; polygon < numPolygons; ++polygon) {
+        const int uvCount = uvCounts[polygon];
+        if (uvCount <= 0) {
+            // No UVs for this face, so leave its face vertices unassigned.
+            fvi += mesh.polygonVertexCount(polygon);
             continue;
         }
 
-        int uvIndex;
-        itFV.getUVIndex(uvIndex, &uvSetName);
-        if (uvIndex < 0 || static_cast<unsigned int>(uvIndex) >= uArray.length()) {
+        if (fvi + uvCount > numFaceVertices || uvi + uvCount > numUVIds) {
             return false;
         }
 
-        (*assignmentIndices)[fvi] = uvIndex;
+        for (int i = 0; i < uvCount; ++i, ++fvi, ++uvi) {
+            const int uvIndex = uvIds[uvi];
+            if (uvIndex < 0 || static_cast<unsigned int>(uvIndex) >= numUVs) {
+                return false;
+            }
+
+            (*assignmentIndices)[fvi] = uvIndex;
+        }
+    }
+
+    if (cachedIndices) {
+        cachedIndices->uvCounts = uvCounts;
+        cachedIndices->uvIds = uvIds;
+        cachedIndices->assignmentIndices = *assignmentIndices;
     }
 
     // We do not merge indexed values or compress indices here in an effort to
@@ -950,7 +1082,8 @@ bool UsdMayaMeshWriteUtils::writeUVSetsAsVec2fPrimvars(
     const UsdTimeCode&                        usdTime,
     FlexibleSparseValueWriter*                valueWriter,
     bool                                      preserveSetNames,
-    const std::map<std::string, std::string>& uvSetRemaps)
+    const std::map<std::string, std::string>& uvSetRemaps,
+    MeshTopologyCache*                        topologyCache)
 {
     MStatus status { MS::kSuccess };
 
@@ -968,7 +1101,12 @@ bool UsdMayaMeshWriteUtils::writeUVSetsAsVec2fPrimvars(
         VtIntArray   assignmentIndices;
 
         if (!UsdMayaMeshWriteUtils::getMeshUVSetData(
-                meshFn, uvSetNames[i], &uvValues, &interpolation, &assignmentIndices)) {
+                meshFn,
+                uvSetNames[i],
+                &uvValues,
+                &interpolation,
+                &assignmentIndices,
+                topologyCache)) {
             continue;
         }
 
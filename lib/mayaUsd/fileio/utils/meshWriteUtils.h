@@ -31,9 +31,16 @@
 
 #include <maya/MBoundingBox.h>
 #include <maya/MDagPath.h>
+#include <maya/MDoubleArray.h>
+#include <maya/MFloatVectorArray.h>
 #include <maya/MFnMesh.h>
+#include <maya/MIntArray.h>
 #include <maya/MObject.h>
 #include <maya/MString.h>
+#include <maya/MUintArray.h>
+
+#include <map>
+#include <string>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
@@ -41,6 +48,40 @@ class UsdGeomMesh;
 
 // Utilities for dealing with writing USD from Maya mesh/subdiv tags.
 namespace UsdMayaMeshWriteUtils {
+
+/// Topology and UV index data of a mesh kept between time samples.
+///
+/// When the topology of an animated mesh does not change, the cached arrays are
+/// written again instead of new ones. Since the sparse value writer compares
+/// identical VtArrays in constant time, only the deforming data then costs a
+/// full comparison on each frame.
+struct MeshTopologyCache
+{
+    /// Whether the face-vertex topology changed during the last call to
+    /// writeFaceVertexIndicesData(). Always true for the first sample.
+    bool topologyChanged { true };
+
+    VtIntArray faceVertexCounts;
+    VtIntArray faceVertexIndices;
+
+    struct UVSetIndices
+    {
+        MIntArray  uvCounts;
+        MIntArray  uvIds;
+        VtIntArray assignmentIndices;
+    };
+    std::map<std::string, UVSetIndices> uvSetIndices;
+
+    /// Crease and hole data of the last call to subdivTagsChanged(). They
+    /// are only authored at the default time, so they are authored again
+    /// when either they or the face-vertex topology change.
+    MUintArray   creaseVertexIds;
+    MDoubleArray creaseVertexValues;
+    MUintArray   creaseEdgeIds;
+    MDoubleArray creaseEdgeValues;
+    MUintArray   holes;
+};
+
 /**
  * Finds a skinCluster directly connected upstream in the DG to the given mesh.
  *
@@ -80,6 +121,16 @@ MBoundingBox calcBBoxOfMeshes(const MObjectArray& meshes);
 MAYAUSD_CORE_PUBLIC
 bool getMeshNormals(const MFnMesh& mesh, VtVec3fArray* normalsArray, TfToken* interpolation);
 
+/// Fills \p normalsArray with \p numFaceVertices face-varying normals from
+/// the \p normals and \p normalIds read from a Maya mesh. Does not access the
+/// mesh, so it can be called from any thread.
+MAYAUSD_CORE_PUBLIC
+void getFaceVaryingNormals(
+    const MFloatVectorArray& normals,
+    const MIntArray&         normalIds,
+    unsigned int             numFaceVertices,
+    VtVec3fArray*            normalsArray);
+
 /// Gets the subdivision scheme tagged for the Maya mesh by consulting the
 /// adaptor for \c UsdGeomMesh.subdivisionSurface, and then falling back to
 /// the RenderMan for Maya attribute.
@@ -124,12 +175,23 @@ void writePointsData(
     const double               distanceUnitsScalar,
     FlexibleSparseValueWriter* valueWriter);
 
+/// Writes the face vertex counts and indices of the mesh. If \p topologyCache
+/// is given, the cached arrays are reused when the topology did not change
+/// since the previous call and the cache's topologyChanged flag is updated.
 MAYAUSD_CORE_PUBLIC
 void writeFaceVertexIndicesData(
     const MFnMesh&             meshFn,
     UsdGeomMesh&               primSchema,
     const UsdTimeCode&         usdTime,
-    FlexibleSparseValueWriter* valueWriter);
+    FlexibleSparseValueWriter* valueWriter,
+    MeshTopologyCache*         topologyCache = nullptr);
+
+/// Whether the crease and hole data of \p meshFn or its face-vertex
+/// topology changed since the previous call, updating \p topologyCache with
+/// the current crease and hole data. Always true for the first sample.
+/// Must be called after writeFaceVertexIndicesData().
+MAYAUSD_CORE_PUBLIC
+bool subdivTagsChanged(MFnMesh& meshFn, MeshTopologyCache* topologyCache);
 
 MAYAUSD_CORE_PUBLIC
 void writeInvisibleFacesData(
@@ -137,13 +199,17 @@ void writeInvisibleFacesData(
     UsdGeomMesh&               primSchema,
     FlexibleSparseValueWriter* valueWriter);
 
+/// Gets the UV values and face-varying assignment indices of a UV set. If
+/// \p topologyCache is given, the cached assignment indices of the set are
+/// reused when the UV assignment did not change since the previous call.
 MAYAUSD_CORE_PUBLIC
 bool getMeshUVSetData(
-    const MFnMesh& mesh,
-    const MString& uvSetName,
-    VtVec2fArray*  uvArray,
-    TfToken*       interpolation,
-    VtIntArray*    assignmentIndices);
+    const MFnMesh&     mesh,
+    const MString&     uvSetName,
+    VtVec2fArray*      uvArray,
+    TfToken*           interpolation,
+    VtIntArray*        assignmentIndices,
+    MeshTopologyCache* topologyCache = nullptr);
 
 MAYAUSD_CORE_PUBLIC
 bool writeUVSetsAsVec2fPrimvars(
@@ -152,7 +218,8 @@ bool writeUVSetsAsVec2fPrimvars(
     const UsdTimeCode&                        usdTime,
     FlexibleSparseValueWriter*                valueWriter,
     bool                                      preserveSetNames,
-    const std::map<std::string, std::string>& uvSetRemaps);
+    const std::map<std::string, std::string>& uvSetRemaps,
+    MeshTopologyCache*                        topologyCache = nullptr);
 
 MAYAUSD_CORE_PUBLIC
 void writeSubdivInterpBound(
@@ -27,6 +27,9 @@
 #include <mayaUsd/utils/utilSerialization.h>
 
 #include <pxr/base/arch/env.h>
+#include <pxr/base/arch/fileSystem.h>
+#include <pxr/base/tf/fastCompression.h>
+#include <pxr/base/tf/fileUtils.h>
 #include <pxr/base/tf/instantiateType.h>
 #include <pxr/base/tf/weakBase.h>
 #include <pxr/usd/ar/resolver.h>
@@ -57,8 +60,12 @@
 #include <ufe/observableSelection.h>
 #include <ufe/selectionNotification.h>
 
+#include <algorithm>
+#include <cstdint>
 #include <cstdio>
+#include <fstream>
 #include <iostream>
+#include <iterator>
 #include <set>
 
 namespace {
@@ -112,6 +119,204 @@ MStatus disconnectCompoundArrayPlug(MPlug arrayPlug)
     return dgmod.doIt();
 }
 
+// Values of the serializedFormat attribute. The empty value is the usda text
+// serialization that was the only one available before the attribute existed,
+// so scenes saved by older versions still load.
+const std::string kSerializedFormatText;
+const std::string kSerializedFormatCrate("usdc");
+const std::string kSerializedFormatCrateLZ4("usdc-lz4");
+
+const char kBase64Chars[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+// Maya string attributes cannot hold arbitrary bytes, so binary layers are
+// stored base64-encoded.
+std::string encodeBase64(const std::string& input)
+{
+    std::string output;
+    output.reserve(((input.size() + 2) / 3) * 4);
+
+    size_t i = 0;
+    for (; i + 2 < input.size(); i += 3) {
+        const uint32_t n = (uint32_t(uint8_t(input[i])) << 16)
+            | (uint32_t(uint8_t(input[i + 1])) << 8) | uint32_t(uint8_t(input[i + 2]));
+        output.push_back(kBase64Chars[(n >> 18) & 63]);
+        output.push_back(kBase64Chars[(n >> 12) & 63]);
+        output.push_back(kBase64Chars[(n >> 6) & 63]);
+        output.push_back(kBase64Chars[n & 63]);
+    }
+
+    const size_t remaining = input.size() - i;
+    if (remaining > 0) {
+        uint32_t n = uint32_t(uint8_t(input[i])) << 16;
+        if (remaining == 2)
+            n |= uint32_t(uint8_t(input[i + 1])) << 8;
+        output.push_back(kBase64Chars[(n >> 18) & 63]);
+        output.push_back(kBase64Chars[(n >> 12) & 63]);
+        output.push_back(remaining == 2 ? kBase64Chars[(n >> 6) & 63] : '=');
+        output.push_back('=');
+    }
+
+    return output;
+}
+
+bool decodeBase64(const std::string& input, std::string* output)
+{
+    int8_t decodeTable[256];
+    std::fill(std::begin(decodeTable), std::end(decodeTable), int8_t(-1));
+    for (int i = 0; i < 64; ++i)
+        decodeTable[uint8_t(kBase64Chars[i])] = int8_t(i);
+
+    output->clear();
+    output->reserve((input.size() / 4) * 3);
+
+    uint32_t bits = 0;
+    int      bitCount = 0;
+    for (const char c : input) {
+        if (c == '=')
+            break;
+        const int8_t value = decodeTable[uint8_t(c)];
+        if (value < 0)
+            return false;
+        bits = (bits << 6) | uint32_t(value);
+        bitCount += 6;
+        if (bitCount >= 8) {
+            bitCount -= 8;
+            output->push_back(char((bits >> bitCount) & 0xFF));
+        }
+    }
+
+    return true;
+}
+
+// Crate files cannot be written to or read from memory, so layers go through
+// a temporary usdc file.
+bool exportLayerToCrate(const SdfLayerHandle& layer, std::string* crate)
+{
+    const std::string tmpFileName = ArchMakeTmpFileName("mayaUsdLayer", ".usdc");
+    bool              success = layer->Export(tmpFileName);
+    if (success) {
+        std::ifstream tmpFile(tmpFileName, std::ios::binary);
+        crate->assign(std::istreambuf_iterator<char>(tmpFile), std::istreambuf_iterator<char>());
+        success = !tmpFile.bad();
+    }
+    TfDeleteFile(tmpFileName);
+    return success;
+}
+
+bool importLayerFromCrate(const SdfLayerRefPtr& layer, const std::string& crate)
+{
+    const std::string tmpFileName = ArchMakeTmpFileName("mayaUsdLayer", ".usdc");
+    bool              success = false;
+    {
+        std::ofstream tmpFile(tmpFileName, std::ios::binary);
+        tmpFile.write(crate.data(), crate.size());
+        success = tmpFile.good();
+    }
+    SdfLayerRefPtr crateLayer;
+    if (success) {
+        crateLayer = SdfLayer::OpenAsAnonymous(tmpFileName);
+        success = bool(crateLayer);
+        if (success)
+            layer->TransferContent(crateLayer);
+    }
+    // The temporary layer maps the file, which cannot be deleted on Windows
+    // while it is mapped, so release the layer first.
+    crateLayer = SdfLayerRefPtr();
+    if (!TfDeleteFile(tmpFileName)) {
+        MGlobal::displayWarning(
+            MString("Could not delete the temporary layer file ") + tmpFileName.c_str());
+    }
+    return success;
+}
+
+// The compressed blob is prefixed with the uncompressed size, stored as a
+// little-endian 64-bit integer.
+std::string compressBlob(const std::string& input)
+{
+    const size_t maxSize = TfFastCompression::GetCompressionBufferSize(input.size());
+    std::string  output(sizeof(uint64_t) + maxSize, '\0');
+
+    uint64_t inputSize = input.size();
+    for (size_t i = 0; i < sizeof(uint64_t); ++i) {
+        output[i] = char((inputSize >> (8 * i)) & 0xFF);
+    }
+
+    const size_t compressedSize
+        = TfFastCompression::CompressToBuffer(input.data(), &output[sizeof(uint64_t)], input.size());
+    output.resize(sizeof(uint64_t) + compressedSize);
+    return output;
+}
+
+bool decompressBlob(const std::string& input, std::string* output)
+{
+    if (input.size() < sizeof(uint64_t))
+        return false;
+
+    uint64_t outputSize = 0;
+    for (size_t i = 0; i < sizeof(uint64_t); ++i) {
+        outputSize |= uint64_t(uint8_t(input[i])) << (8 * i);
+    }
+
+    output->assign(outputSize, '\0');
+    const size_t decompressedSize = TfFastCompression::DecompressFromBuffer(
+        input.data() + sizeof(uint64_t), &(*output)[0], input.size() - sizeof(uint64_t), outputSize);
+    return decompressedSize == outputSize;
+}
+
+/// Returns the serializedFormat value matching the user's serialization option.
+const std::string& serializedFormatFromOption()
+{
+    switch (MayaUsd::utils::serializedUsdEditsFormatOption()) {
+    case MayaUsd::utils::kSerializeAsBinary: return kSerializedFormatCrate;
+    case MayaUsd::utils::kSerializeAsCompressedBinary: return kSerializedFormatCrateLZ4;
+    default: return kSerializedFormatText;
+    }
+}
+
+bool serializeLayer(const SdfLayerHandle& layer, const std::string& format, std::string* result)
+{
+    if (format == kSerializedFormatText)
+        return layer->ExportToString(result);
+
+    std::string crate;
+    if (!exportLayerToCrate(layer, &crate))
+        return false;
+
+    if (format == kSerializedFormatCrateLZ4)
+        crate = compressBlob(crate);
+
+    *result = encodeBase64(crate);
+    return true;
+}
+
+bool deserializeLayer(
+    const SdfLayerRefPtr& layer,
+    const std::string&    format,
+    const std::string&    serialized)
+{
+    if (format == kSerializedFormatText)
+        return layer->ImportFromString(serialized);
+
+    if (format != kSerializedFormatCrate && format != kSerializedFormatCrateLZ4) {
+        MGlobal::displayError(
+            MString("Unknown serialized layer format: ") + UsdMayaUtil::convert(format));
+        return false;
+    }
+
+    std::string crate;
+    if (!decodeBase64(serialized, &crate))
+        return false;
+
+    if (format == kSerializedFormatCrateLZ4) {
+        std::string compressed;
+        compressed.swap(crate);
+        if (!decompressBlob(compressed, &crate))
+            return false;
+    }
+
+    return importLayerFromCrate(layer, crate);
+}
+
 MayaUsd::LayerManager* findNode()
 {
     // Check for cached layer manager before searching
@@ -695,6 +900,7 @@ MStatus addLayerToBuilder(
     MDataHandle idHandle = layersElemHandle.child(lm->identifier);
     MDataHandle fileFormatIdHandle = layersElemHandle.child(lm->fileFormatId);
     MDataHandle serializedHandle = layersElemHandle.child(lm->serialized);
+    MDataHandle serializedFormatHandle = layersElemHandle.child(lm->serializedFormat);
     MDataHandle anonHandle = layersElemHandle.child(lm->anonymous);
 
     idHandle.setString(UsdMayaUtil::convert(layer->GetIdentifier()));
@@ -703,14 +909,16 @@ MStatus addLayerToBuilder(
     auto fileFormatIdToken = layer->GetFileFormat()->GetFormatId();
     fileFormatIdHandle.setString(UsdMayaUtil::convert(fileFormatIdToken.GetString()));
 
-    std::string temp;
+    std::string        temp;
+    const std::string& format = serializedFormatFromOption();
     if (!stubOnly && ((exportOnlyIfDirty && layer->IsDirty()) || !exportOnlyIfDirty)) {
-        if (!layer->ExportToString(&temp)) {
+        if (!serializeLayer(layer, format, &temp)) {
             status = MS::kFailure;
         }
     }
 
     serializedHandle.setString(UsdMayaUtil::convert(temp));
+    serializedFormatHandle.setString(UsdMayaUtil::convert(format));
 
     return status;
 }
@@ -965,9 +1173,11 @@ void LayerDatabase::loadLayersPostRead(void*)
     MPlug                       fileFormatIdPlug;
     MPlug                       anonymousPlug;
     MPlug                       serializedPlug;
+    MPlug                       serializedFormatPlug;
     std::string                 identifierVal;
     std::string                 fileFormatIdVal;
     std::string                 serializedVal;
+    std::string                 serializedFormatVal;
     SdfLayerRefPtr              layer;
     std::vector<SdfLayerRefPtr> createdLayers;
 
@@ -980,6 +1190,7 @@ void LayerDatabase::loadLayersPostRead(void*)
         fileFormatIdPlug = singleLayerPlug.child(lm->fileFormatId, &status);
         anonymousPlug = singleLayerPlug.child(lm->anonymous, &status);
         serializedPlug = singleLayerPlug.child(lm->serialized, &status);
+        serializedFormatPlug = singleLayerPlug.child(lm->serializedFormat, &status);
 
         identifierVal = idPlug.asString(MDGContext::fsNormal, &status).asChar();
         if (identifierVal.empty()) {
@@ -1000,6 +1211,7 @@ void LayerDatabase::loadLayersPostRead(void*)
         if (serializedVal.empty()) {
             layerContainsEdits = false;
         }
+        serializedFormatVal = serializedFormatPlug.asString(MDGContext::fsNormal, &status).asChar();
 
         bool isAnon = anonymousPlug.asBool(MDGContext::fsNormal, &status);
         if (isAnon) {
@@ -1054,9 +1266,15 @@ void LayerDatabase::loadLayersPostRead(void*)
 
         if (layer) {
             if (layerContainsEdits) {
-                if (!layer->ImportFromString(serializedVal)) {
-                    MGlobal::displayError(
-                        MString("Failed to import serialized layer: ") + serializedVal.c_str());
+                if (!deserializeLayer(layer, serializedFormatVal, serializedVal)) {
+                    if (serializedFormatVal == kSerializedFormatText) {
+                        MGlobal::displayError(
+                            MString("Failed to import serialized layer: ") + serializedVal.c_str());
+                    } else {
+                        MGlobal::displayError(
+                            MString("Failed to import serialized layer: ")
+                            + UsdMayaUtil::convert(identifierVal));
+                    }
                     continue;
                 }
             }
@@ -1204,6 +1422,7 @@ MObject LayerManager::layers = MObject::kNullObj;
 MObject LayerManager::identifier = MObject::kNullObj;
 MObject LayerManager::fileFormatId = MObject::kNullObj;
 MObject LayerManager::serialized = MObject::kNullObj;
+MObject LayerManager::serializedFormat = MObject::kNullObj;
 MObject LayerManager::anonymous = MObject::kNullObj;
 MObject LayerManager::selectedStage = MObject::kNullObj;
 
@@ -1276,6 +1495,16 @@ MStatus LayerManager::initialize()
         stat = addAttribute(serialized);
         CHECK_MSTATUS_AND_RETURN_IT(stat);
 
+        serializedFormat
+            = fn_str.create("serializedFormat", "szf", MFnData::kString, MObject::kNullObj, &stat);
+        CHECK_MSTATUS_AND_RETURN_IT(stat);
+        fn_str.setCached(true);
+        fn_str.setReadable(true);
+        fn_str.setStorable(true);
+        fn_str.setHidden(true);
+        stat = addAttribute(serializedFormat);
+        CHECK_MSTATUS_AND_RETURN_IT(stat);
+
         MFnNumericAttribute fn_bool;
         anonymous = fn_bool.create("anonymous", "ann", MFnNumericData::kBoolean, false, &stat);
         CHECK_MSTATUS_AND_RETURN_IT(stat);
@@ -1299,6 +1528,9 @@ MStatus LayerManager::initialize()
         stat = fn_cmp.addChild(serialized);
         CHECK_MSTATUS_AND_RETURN_IT(stat);
 
+        stat = fn_cmp.addChild(serializedFormat);
+        CHECK_MSTATUS_AND_RETURN_IT(stat);
+
         stat = fn_cmp.addChild(anonymous);
         CHECK_MSTATUS_AND_RETURN_IT(stat);
 
@@ -90,7 +90,9 @@ using BatchSaveDelegate = std::function<BatchSaveResult(const std::vector<StageS
     node will be created that stores the Usd identifiers of all layers under the parent Proxy Shape
     as well as the dirty Usd layer itself exported to a string.  Dirty layers will include any
     anonymous layers, a Session layer with edits, and any file-backed Usd layers with edits that
-   have not been saved to disk.
+   have not been saved to disk. Layers are exported as usda text by default, or as base64-encoded
+   (and optionally LZ4-compressed) usdc data depending on the mayaUsd_SerializedUsdEditsFormat
+   optionVar; the serializedFormat attribute records which one was used.
 
     3. Ignore all Usd edits.
     With this option, Maya will not attempt to save any dirty Usd layers, assuming the user is
@@ -139,6 +141,7 @@ public:
     static MObject identifier;
     static MObject fileFormatId;
     static MObject serialized;
+    static MObject serializedFormat;
     static MObject anonymous;
     static MObject selectedStage;
 
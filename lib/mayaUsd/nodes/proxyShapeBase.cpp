@@ -57,6 +57,7 @@
 #include <pxr/usd/sdf/path.h>
 #include <pxr/usd/usd/editContext.h>
 #include <pxr/usd/usd/prim.h>
+#include <pxr/usd/usd/primRange.h>
 #include <pxr/usd/usd/stage.h>
 #include <pxr/usd/usd/stageCacheContext.h>
 #include <pxr/usd/usd/timeCode.h>
@@ -64,6 +65,7 @@
 #include <pxr/usd/usdGeom/boundable.h>
 #include <pxr/usd/usdGeom/gprim.h>
 #include <pxr/usd/usdGeom/imageable.h>
+#include <pxr/usd/usdGeom/mesh.h>
 #include <pxr/usd/usdGeom/tokens.h>
 #include <pxr/usd/usdUtils/stageCache.h>
 
@@ -119,7 +121,7 @@ PXR_NAMESPACE_OPEN_SCOPE
 TF_DEFINE_PUBLIC_TOKENS(MayaUsdProxyShapeBaseTokens, MAYAUSD_PROXY_SHAPE_BASE_TOKENS);
 
 MayaUsdProxyShapeBase::ClosestPointDelegate MayaUsdProxyShapeBase::_sharedClosestPointDelegate
-    = nullptr;
+    = MayaUsdProxyShapeBase::_ClosestPointOnStage;
 
 const std::string  kAnonymousLayerName { "anonymousLayer1" };
 const std::string  kSessionLayerPostfix { "-session" };
@@ -1245,6 +1247,8 @@ MStatus MayaUsdProxyShapeBase::computeOutStageData(MDataBlock& dataBlock)
     const bool isNormalContext = dataBlock.context().isNormal();
     if (isNormalContext) {
         TfReset(_boundingBoxCache);
+        _primBoundsCache.Clear();
+        _rayCaster.Clear();
 
         // Reset the stage listener until we determine that everything is valid.
         _stageNoticeListener.SetStage(UsdStageWeakPtr());
@@ -1540,22 +1544,11 @@ MBoundingBox MayaUsdProxyShapeBase::boundingBox() const
         return MBoundingBox();
     }
 
-    const UsdGeomImageable imageablePrim(prim);
-
-    bool drawRenderPurpose = false;
-    bool drawProxyPurpose = true;
-    bool drawGuidePurpose = false;
-    _GetDrawPurposeToggles(dataBlock, &drawRenderPurpose, &drawProxyPurpose, &drawGuidePurpose);
-
-    const TfToken purpose1 = UsdGeomTokens->default_;
-    const TfToken purpose2 = drawRenderPurpose ? UsdGeomTokens->render : TfToken();
-    const TfToken purpose3 = drawProxyPurpose ? UsdGeomTokens->proxy : TfToken();
-    const TfToken purpose4 = drawGuidePurpose ? UsdGeomTokens->guide : TfToken();
+    const TfTokenVector purposes = _GetDrawPurposes(dataBlock);
 
+    // The bounds of the prims that did not change since the last computation are reused.
     GfBBox3d allBox
-        = imageablePrim.ComputeUntransformedBound(currTime, purpose1, purpose2, purpose3, purpose4);
-
-    UsdMayaUtil::AddMayaExtents(allBox, prim, currTime);
+        = nonConstThis->_primBoundsCache.ComputeUntransformedBound(prim, currTime, purposes);
 
     Ufe::BBox3d pulledUfeBBox = ufe::getPulledPrimsBoundingBox(ufePath());
     if (!pulledUfeBBox.empty()) {
@@ -1582,7 +1575,11 @@ MBoundingBox MayaUsdProxyShapeBase::boundingBox() const
     return retval;
 }
 
-void MayaUsdProxyShapeBase::clearBoundingBoxCache() { _boundingBoxCache.clear(); }
+void MayaUsdProxyShapeBase::clearBoundingBoxCache()
+{
+    _boundingBoxCache.clear();
+    _primBoundsCache.Clear();
+}
 
 bool MayaUsdProxyShapeBase::isStageValid() const
 {
@@ -1924,6 +1921,55 @@ bool MayaUsdProxyShapeBase::_GetDrawPurposeToggles(
     return true;
 }
 
+TfTokenVector MayaUsdProxyShapeBase::_GetDrawPurposes(MDataBlock dataBlock) const
+{
+    bool drawRenderPurpose = false;
+    bool drawProxyPurpose = true;
+    bool drawGuidePurpose = false;
+    _GetDrawPurposeToggles(dataBlock, &drawRenderPurpose, &drawProxyPurpose, &drawGuidePurpose);
+
+    TfTokenVector purposes { UsdGeomTokens->default_ };
+    if (drawRenderPurpose) {
+        purposes.push_back(UsdGeomTokens->render);
+    }
+    if (drawProxyPurpose) {
+        purposes.push_back(UsdGeomTokens->proxy);
+    }
+    if (drawGuidePurpose) {
+        purposes.push_back(UsdGeomTokens->guide);
+    }
+    return purposes;
+}
+
+/* static */
+bool MayaUsdProxyShapeBase::_ClosestPointOnStage(
+    const MayaUsdProxyShapeBase& shape,
+    const GfRay&                 ray,
+    GfVec3d*                     outClosestPoint,
+    GfVec3d*                     outClosestNormal)
+{
+    TRACE_FUNCTION();
+
+    // Make live and snapping query the shape through a const interface, but the
+    // data block and the ray caster hierarchies are evaluated lazily.
+    MayaUsdProxyShapeBase* nonConstShape = const_cast<MayaUsdProxyShapeBase*>(&shape);
+    MDataBlock             dataBlock = nonConstShape->forceCache();
+
+    const UsdPrim usdPrim = nonConstShape->_GetUsdPrim(dataBlock);
+    if (!usdPrim) {
+        return false;
+    }
+
+    return nonConstShape->_rayCaster.Intersect(
+        usdPrim,
+        nonConstShape->GetOutputTime(dataBlock),
+        nonConstShape->_GetDrawPurposes(dataBlock),
+        nonConstShape->getExcludePrimPaths(),
+        ray,
+        outClosestPoint,
+        outClosestNormal);
+}
+
 bool MayaUsdProxyShapeBase::GetAllRenderAttributes(
     UsdPrim*       usdPrimOut,
     SdfPathVector* excludePrimPathsOut,
@@ -2087,10 +2133,11 @@ void MayaUsdProxyShapeBase::_OnStageObjectsChanged(const UsdNotice::ObjectsChang
     case UsdMayaStageNoticeListener::ChangeType::kUpdate: ++_UsdStageUpdateCounter; break;
     }
 
-    // This will definitely force a BBox recomputation on "Frame All" or when framing a selected
-    // stage. Computing bounds in USD is expensive, so if it pops up in other frequently used
-    // scenarios we will have to investigate ways to make this cache clearing less expensive.
-    clearBoundingBoxCache();
+    // This will force a BBox recomputation on "Frame All" or when framing a selected stage.
+    // Only the bounds of the changed prims and of their ancestors are recomputed.
+    _boundingBoxCache.clear();
+    _primBoundsCache.Invalidate(notice);
+    _rayCaster.Invalidate(notice);
 
     ProxyAccessor::stageChanged(_usdAccessor, thisMObject(), notice);
     MayaUsdProxyStageObjectsChangedNotice(*this, notice).Send();
@@ -2186,7 +2233,32 @@ bool MayaUsdProxyShapeBase::closestPoint(
     return false;
 }
 
-bool MayaUsdProxyShapeBase::canMakeLive() const { return (bool)_sharedClosestPointDelegate; }
+bool MayaUsdProxyShapeBase::canMakeLive() const
+{
+    if (!_sharedClosestPointDelegate) {
+        return false;
+    }
+    // Custom delegates decide what they intersect.
+    using ClosestPointFunction
+        = bool (*)(const MayaUsdProxyShapeBase&, const GfRay&, GfVec3d*, GfVec3d*);
+    const ClosestPointFunction* function
+        = _sharedClosestPointDelegate.target<ClosestPointFunction>();
+    if (!function || *function != _ClosestPointOnStage) {
+        return true;
+    }
+
+    // The ray caster only intersects meshes, so there must be one under the root prim.
+    const UsdPrim prim = usdPrim();
+    if (!prim) {
+        return false;
+    }
+    for (const UsdPrim& descendant : UsdPrimRange(prim, UsdTraverseInstanceProxies())) {
+        if (descendant.IsA<UsdGeomMesh>()) {
+            return true;
+        }
+    }
+    return false;
+}
 
 void _proxyShapeAncestorPlugDirty(MObject& node, MPlug& plug, void* clientData)
 {
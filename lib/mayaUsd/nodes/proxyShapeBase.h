@@ -47,6 +47,8 @@ UFE_NS_DEF { class Path; }
 #include <mayaUsd/base/api.h>
 #include <mayaUsd/listeners/stageNoticeListener.h>
 #include <mayaUsd/nodes/proxyAccessor.h>
+#include <mayaUsd/nodes/proxyShapeBoundsCache.h>
+#include <mayaUsd/nodes/proxyShapeRayCaster.h>
 #include <mayaUsd/nodes/proxyStageProvider.h>
 #include <mayaUsd/nodes/usdPrimProvider.h>
 
@@ -393,6 +395,13 @@ private:
         bool*      drawRenderPurpose,
         bool*      drawProxyPurpose,
         bool*      drawGuidePurpose) const;
+    TfTokenVector _GetDrawPurposes(MDataBlock dataBlock) const;
+
+    static bool _ClosestPointOnStage(
+        const MayaUsdProxyShapeBase& shape,
+        const GfRay&                 ray,
+        GfVec3d*                     outClosestPoint,
+        GfVec3d*                     outClosestNormal);
 
     void _OnStageContentsChanged(const UsdNotice::StageContentsChanged& notice);
     void _OnStageObjectsChanged(const UsdNotice::ObjectsChanged& notice);
@@ -404,6 +413,8 @@ private:
     UsdMayaStageNoticeListener _stageNoticeListener;
 
     std::map<UsdTimeCode, MBoundingBox> _boundingBoxCache;
+    MayaUsdProxyShapeBoundsCache        _primBoundsCache;
+    MayaUsdProxyShapeRayCaster          _rayCaster;
     size_t                              _excludePrimPathsVersion { 1 };
     size_t                              _UsdStageVersion { 1 };
 
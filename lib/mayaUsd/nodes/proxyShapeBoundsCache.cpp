@@ -0,0 +1,263 @@
+//
+// Copyright 2024 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "proxyShapeBoundsCache.h"
+
+#include <mayaUsd/utils/util.h>
+
+#include <pxr/base/gf/matrix4d.h>
+#include <pxr/base/gf/range3d.h>
+#include <pxr/base/tf/hashmap.h>
+#include <pxr/base/trace/trace.h>
+#include <pxr/usd/usdGeom/bboxCache.h>
+#include <pxr/usd/usdGeom/boundable.h>
+#include <pxr/usd/usdGeom/pointInstancer.h>
+#include <pxr/usd/usdGeom/tokens.h>
+#include <pxr/usd/usdGeom/xformCache.h>
+#include <pxr/usd/usdGeom/xformOp.h>
+
+#include <algorithm>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+namespace {
+
+// Bounds of animated stages are cached per frame. Keep the most recently used frames
+// only, so that scrubbing back and forth stays fast without growing the cache for every
+// frame.
+const size_t kMaxCachedTimes = 8;
+
+// The bounds of instance prototypes are shared by all their instances, whose paths are
+// not in the notice.
+bool isPrototypePath(const SdfPath& path)
+{
+    return UsdPrim::IsPathInPrototype(path.GetPrimPath());
+}
+
+// Properties whose value is inherited by the whole subtree of the prim.
+bool isInheritedProperty(const TfToken& propertyName)
+{
+    return propertyName == UsdGeomTokens->visibility || propertyName == UsdGeomTokens->purpose;
+}
+
+// Properties only affecting the bound of the prim as seen from its parent.
+bool isTransformProperty(const TfToken& propertyName)
+{
+    return propertyName == UsdGeomTokens->xformOpOrder || UsdGeomXformOp::IsXformOp(propertyName);
+}
+
+} // namespace
+
+GfBBox3d MayaUsdProxyShapeBoundsCache::ComputeUntransformedBound(
+    const UsdPrim&       prim,
+    const UsdTimeCode&   time,
+    const TfTokenVector& purposes)
+{
+    TRACE_FUNCTION();
+
+    if (purposes != _purposes) {
+        Clear();
+        _purposes = purposes;
+    }
+
+    auto boundsIter = std::find_if(
+        _boundsPerTime.begin(), _boundsPerTime.end(), [&time](const _TimeBounds& timeBounds) {
+            return timeBounds.time == time;
+        });
+    if (boundsIter != _boundsPerTime.end()) {
+        _boundsPerTime.splice(_boundsPerTime.begin(), _boundsPerTime, boundsIter);
+    } else {
+        if (_boundsPerTime.size() >= kMaxCachedTimes) {
+            _boundsPerTime.pop_back();
+        }
+        _boundsPerTime.emplace_front();
+        _boundsPerTime.front().time = time;
+    }
+
+    // The visibility and purpose of the prim may be inherited from its ancestors.
+    UsdGeomImageable::PurposeInfo parentPurposeInfo(UsdGeomTokens->default_, false);
+    const UsdPrim                 parent = prim.GetParent();
+    if (parent && parent.IsA<UsdGeomImageable>()) {
+        const UsdGeomImageable parentImageable(parent);
+        if (parentImageable.ComputeVisibility(time) == UsdGeomTokens->invisible) {
+            return GfBBox3d();
+        }
+        parentPurposeInfo = parentImageable.ComputePurposeInfo();
+    }
+
+    UsdGeomBBoxCache  bboxCache(time, purposes);
+    UsdGeomXformCache xformCache(time);
+    return _ComputeBound(
+        prim, parentPurposeInfo, _boundsPerTime.front().bounds, bboxCache, xformCache);
+}
+
+GfBBox3d MayaUsdProxyShapeBoundsCache::_ComputeBound(
+    const UsdPrim&                       prim,
+    const UsdGeomImageable::PurposeInfo& parentPurposeInfo,
+    _BoundsTable&                        bounds,
+    UsdGeomBBoxCache&                    bboxCache,
+    UsdGeomXformCache&                   xformCache)
+{
+    const SdfPath& primPath = prim.GetPath();
+
+    auto cached = bounds.find(primPath);
+    if (cached != bounds.end() && cached->second.valid) {
+        return cached->second.bound;
+    }
+
+    GfBBox3d bound;
+
+    // Invisible prims hide their whole subtree. The purpose is inherited by the children
+    // without an authored purpose, which may still have an included one.
+    UsdGeomImageable::PurposeInfo purposeInfo = parentPurposeInfo;
+    if (prim.IsA<UsdGeomImageable>()) {
+        const UsdGeomImageable imageable(prim);
+        TfToken                visibility;
+        if (imageable.GetVisibilityAttr().Get(&visibility, xformCache.GetTime())
+            && visibility == UsdGeomTokens->invisible) {
+            _Bound& entry = bounds[primPath];
+            entry.bound = bound;
+            entry.valid = true;
+            return bound;
+        }
+        purposeInfo = imageable.ComputePurposeInfo(parentPurposeInfo);
+    }
+    const bool isPurposeIncluded
+        = std::find(_purposes.begin(), _purposes.end(), purposeInfo.purpose) != _purposes.end();
+
+    // Point instancers own their prototypes: leave their whole subtree to the bbox cache.
+    // Instances have no children and are computed by the bbox cache from their prototype.
+    bool       hasOwnBound = prim.IsInstance() || prim.IsA<UsdGeomBoundable>();
+    SdfPathSet childrenBoundSeparately;
+    if (!prim.IsA<UsdGeomPointInstancer>()) {
+        for (const UsdPrim& child : prim.GetChildren()) {
+            bool             resetsXformStack = false;
+            const GfMatrix4d childXform
+                = xformCache.GetLocalTransformation(child, &resetsXformStack);
+            if (resetsXformStack) {
+                // The child bound is not relative to this prim: let the bbox cache handle
+                // the whole child subtree, which also checks its visibility and purpose,
+                // and add the Maya extents it would miss.
+                GfBBox3d childBound = bboxCache.ComputeUntransformedBound(child);
+                UsdMayaUtil::AddMayaExtents(childBound, child, xformCache.GetTime());
+                childBound.Transform(childXform);
+                bound = GfBBox3d::Combine(bound, childBound);
+                childrenBoundSeparately.insert(child.GetPath());
+                continue;
+            }
+
+            GfBBox3d childBound
+                = _ComputeBound(child, purposeInfo, bounds, bboxCache, xformCache);
+            childBound.Transform(childXform);
+            bound = GfBBox3d::Combine(bound, childBound);
+            childrenBoundSeparately.insert(child.GetPath());
+        }
+    }
+
+    if (hasOwnBound && isPurposeIncluded) {
+        static const TfHashMap<SdfPath, GfMatrix4d, SdfPath::Hash> noCtmOverrides;
+        bound = GfBBox3d::Combine(
+            bound,
+            bboxCache.ComputeUntransformedBound(prim, childrenBoundSeparately, noCtmOverrides));
+    }
+
+    GfRange3d mayaExtent;
+    if (isPurposeIncluded && UsdMayaUtil::GetMayaExtent(prim, mayaExtent)) {
+        bound = GfBBox3d::Combine(bound, GfBBox3d(mayaExtent));
+    }
+
+    // Look the entry up again: computing the children may have added entries to the table.
+    _Bound& entry = bounds[primPath];
+    entry.bound = bound;
+    entry.valid = true;
+
+    return bound;
+}
+
+void MayaUsdProxyShapeBoundsCache::Invalidate(const UsdNotice::ObjectsChanged& notice)
+{
+    if (_boundsPerTime.empty()) {
+        return;
+    }
+
+    for (const SdfPath& path : notice.GetResyncedPaths()) {
+        if (path.IsAbsoluteRootPath() || isPrototypePath(path)) {
+            Clear();
+            return;
+        }
+
+        const SdfPath primPath = path.GetPrimPath();
+        _InvalidateSubtree(primPath);
+        _InvalidateAncestors(primPath.GetParentPath());
+    }
+
+    for (const SdfPath& path : notice.GetChangedInfoOnlyPaths()) {
+        // Stage metadata does not affect bounds.
+        if (path.IsAbsoluteRootPath()) {
+            continue;
+        }
+
+        if (isPrototypePath(path)) {
+            Clear();
+            return;
+        }
+
+        const SdfPath primPath = path.GetPrimPath();
+        if (path.IsPropertyPath()) {
+            const TfToken& propertyName = path.GetNameToken();
+            if (isInheritedProperty(propertyName)) {
+                _InvalidateSubtree(primPath);
+                _InvalidateAncestors(primPath.GetParentPath());
+                continue;
+            }
+            if (isTransformProperty(propertyName)) {
+                // The bound of the prim is untransformed: only its ancestors change.
+                _InvalidateAncestors(primPath.GetParentPath());
+                continue;
+            }
+        }
+
+        _InvalidateAncestors(primPath);
+    }
+}
+
+void MayaUsdProxyShapeBoundsCache::Clear() { _boundsPerTime.clear(); }
+
+void MayaUsdProxyShapeBoundsCache::_InvalidateSubtree(const SdfPath& primPath)
+{
+    for (_TimeBounds& timeBounds : _boundsPerTime) {
+        _BoundsTable& bounds = timeBounds.bounds;
+        auto          iter = bounds.find(primPath);
+        if (iter != bounds.end()) {
+            bounds.erase(iter);
+        }
+    }
+}
+
+void MayaUsdProxyShapeBoundsCache::_InvalidateAncestors(const SdfPath& primPath)
+{
+    for (_TimeBounds& timeBounds : _boundsPerTime) {
+        _BoundsTable& bounds = timeBounds.bounds;
+        // Includes the pseudo-root, used as root prim by proxy shapes without a prim path.
+        for (SdfPath path = primPath; !path.IsEmpty(); path = path.GetParentPath()) {
+            auto iter = bounds.find(path);
+            if (iter != bounds.end()) {
+                iter->second.valid = false;
+            }
+        }
+    }
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
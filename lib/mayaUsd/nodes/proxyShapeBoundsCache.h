@@ -0,0 +1,101 @@
+//
+// Copyright 2024 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef MAYAUSD_PROXY_SHAPE_BOUNDS_CACHE_H
+#define MAYAUSD_PROXY_SHAPE_BOUNDS_CACHE_H
+
+#include <mayaUsd/base/api.h>
+
+#include <pxr/base/gf/bbox3d.h>
+#include <pxr/base/tf/token.h>
+#include <pxr/pxr.h>
+#include <pxr/usd/sdf/path.h>
+#include <pxr/usd/sdf/pathTable.h>
+#include <pxr/usd/usd/notice.h>
+#include <pxr/usd/usd/prim.h>
+#include <pxr/usd/usd/timeCode.h>
+#include <pxr/usd/usdGeom/imageable.h>
+
+#include <list>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+class UsdGeomBBoxCache;
+class UsdGeomXformCache;
+
+/// \class MayaUsdProxyShapeBoundsCache
+/// \brief Caches the untransformed bounds of every prim under the proxy shape root prim,
+/// so that a change to a single prim only recomputes the bounds of that prim and of its
+/// ancestors instead of the bounds of the whole stage.
+///
+/// Each prim bound is the union of its own geometry, of the Maya-specific extents added
+/// by UsdMayaUtil::GetMayaExtent() and of the bounds of its children, transformed by their
+/// local transformation. Invisible prims and prims whose purpose is not included do not
+/// contribute to the bounds. Bounds are kept for the most recently used time codes only.
+///
+/// Invalidate() must be called with every ObjectsChanged notice sent by the stage.
+class MayaUsdProxyShapeBoundsCache
+{
+public:
+    /// \brief Returns the bound of \p prim at \p time, in the space of \p prim, including only
+    /// the geometry of the given \p purposes. Equivalent to
+    /// UsdGeomImageable::ComputeUntransformedBound() followed by UsdMayaUtil::AddMayaExtents().
+    MAYAUSD_CORE_PUBLIC
+    GfBBox3d ComputeUntransformedBound(
+        const UsdPrim&       prim,
+        const UsdTimeCode&   time,
+        const TfTokenVector& purposes);
+
+    /// \brief Discards the cached bounds affected by the changes described by \p notice.
+    MAYAUSD_CORE_PUBLIC
+    void Invalidate(const UsdNotice::ObjectsChanged& notice);
+
+    /// \brief Discards all cached bounds.
+    MAYAUSD_CORE_PUBLIC
+    void Clear();
+
+private:
+    struct _Bound
+    {
+        GfBBox3d bound;
+        bool     valid { false };
+    };
+
+    using _BoundsTable = SdfPathTable<_Bound>;
+
+    struct _TimeBounds
+    {
+        UsdTimeCode  time;
+        _BoundsTable bounds;
+    };
+
+    GfBBox3d _ComputeBound(
+        const UsdPrim&                       prim,
+        const UsdGeomImageable::PurposeInfo& parentPurposeInfo,
+        _BoundsTable&                        bounds,
+        UsdGeomBBoxCache&                    bboxCache,
+        UsdGeomXformCache&                   xformCache);
+
+    void _InvalidateSubtree(const SdfPath& primPath);
+    void _InvalidateAncestors(const SdfPath& primPath);
+
+    // Most recently used time code first.
+    std::list<_TimeBounds> _boundsPerTime;
+    TfTokenVector          _purposes;
+};
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif
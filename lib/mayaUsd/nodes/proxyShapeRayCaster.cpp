@@ -0,0 +1,709 @@
+//
+// Copyright 2024 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "proxyShapeRayCaster.h"
+
+#include <mayaUsdUtils/SIMD.h>
+
+#include <pxr/base/gf/matrix4d.h>
+#include <pxr/base/gf/range3f.h>
+#include <pxr/base/gf/vec3f.h>
+#include <pxr/base/gf/vec3i.h>
+#include <pxr/base/trace/trace.h>
+#include <pxr/usd/usdGeom/mesh.h>
+#include <pxr/usd/usdGeom/pointInstancer.h>
+#include <pxr/usd/usdGeom/tokens.h>
+#include <pxr/usd/usdGeom/xformCache.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+namespace {
+
+// Number of triangles intersected together. Leaves hold a single pack.
+const size_t kPackSize = 4;
+
+// Properties whose change requires rebuilding the hierarchy of a mesh.
+bool isMeshGeometryProperty(const TfToken& propertyName)
+{
+    return propertyName == UsdGeomTokens->points
+        || propertyName == UsdGeomTokens->faceVertexCounts
+        || propertyName == UsdGeomTokens->faceVertexIndices
+        || propertyName == UsdGeomTokens->holeIndices
+        || propertyName == UsdGeomTokens->orientation;
+}
+
+GfVec3f inverse(const GfVec3f& direction)
+{
+    // Infinite for null components, which the slab test handles.
+    return GfVec3f(1.0f / direction[0], 1.0f / direction[1], 1.0f / direction[2]);
+}
+
+// Slab test of a ray against a box, returns the distance at which the ray enters the box.
+bool intersectBox(
+    const GfRange3f& box,
+    const GfVec3f&   origin,
+    const GfVec3f&   invDirection,
+    float            maxDistance,
+    float*           entryDistance)
+{
+    float tMin = 0.0f;
+    float tMax = maxDistance;
+    for (size_t axis = 0; axis < 3; ++axis) {
+        float t0 = (box.GetMin()[axis] - origin[axis]) * invDirection[axis];
+        float t1 = (box.GetMax()[axis] - origin[axis]) * invDirection[axis];
+        if (t0 > t1) {
+            std::swap(t0, t1);
+        }
+        tMin = std::max(tMin, t0);
+        tMax = std::min(tMax, t1);
+        if (tMin > tMax) {
+            return false;
+        }
+    }
+    *entryDistance = tMin;
+    return true;
+}
+
+} // namespace
+
+/// The triangles of a mesh at a time code, in a bounding volume hierarchy built by median
+/// splits of the triangle centroids. The nodes are stored depth first, so that the first
+/// child of an inner node immediately follows it.
+class MayaUsdProxyShapeRayCaster::_MeshBVH
+{
+public:
+    _MeshBVH(const UsdGeomMesh& mesh, const UsdTimeCode& time);
+
+    /// Brings the hierarchy of a time-varying mesh to \p time. The hierarchy is kept as is
+    /// when the geometry is the same at both times, and refit to the new points when only
+    /// they changed. Returns false when the topology changed and the hierarchy must be rebuilt.
+    bool Update(const UsdGeomMesh& mesh, const UsdTimeCode& time);
+
+    /// Finds the closest intersection of the ray nearer than \p distance, in the space of the
+    /// mesh, and returns its distance and its unnormalized geometric normal.
+    bool Intersect(
+        const GfVec3f& origin,
+        const GfVec3f& direction,
+        float*         distance,
+        GfVec3f*       normal) const;
+
+private:
+    struct _Node
+    {
+        GfRange3f bound;
+        // The second child of inner nodes, or the triangle pack of leaves.
+        uint32_t index { 0 };
+        // Zero for inner nodes.
+        uint32_t triangleCount { 0 };
+    };
+
+    // The first vertex and the two edges of the triangles, per coordinate, so that the
+    // triangles of a pack are intersected together. Unused triangles are degenerate.
+    struct _TrianglePack
+    {
+        float v0[3][kPackSize] {};
+        float e1[3][kPackSize] {};
+        float e2[3][kPackSize] {};
+    };
+
+    struct _TriangleRef
+    {
+        GfRange3f bound;
+        GfVec3f   centroid;
+        uint32_t  triangle;
+    };
+
+    // The geometry the hierarchy was built from.
+    struct _Geometry
+    {
+        VtVec3fArray points;
+        VtIntArray   faceVertexCounts;
+        VtIntArray   faceVertexIndices;
+        VtIntArray   holeIndices;
+
+        void Read(const UsdGeomMesh& mesh, const UsdTimeCode& time)
+        {
+            mesh.GetPointsAttr().Get(&points, time);
+            mesh.GetFaceVertexCountsAttr().Get(&faceVertexCounts, time);
+            mesh.GetFaceVertexIndicesAttr().Get(&faceVertexIndices, time);
+            mesh.GetHoleIndicesAttr().Get(&holeIndices, time);
+        }
+
+        bool HasSameTopology(const _Geometry& other) const
+        {
+            return points.size() == other.points.size()
+                && faceVertexCounts == other.faceVertexCounts
+                && faceVertexIndices == other.faceVertexIndices
+                && holeIndices == other.holeIndices;
+        }
+    };
+
+    uint32_t _BuildNode(std::vector<_TriangleRef>& refs, size_t begin, size_t end);
+
+    // Fills the pack with the current points of its triangles and returns its bound.
+    GfRange3f _FillPack(uint32_t packIndex, size_t triangleCount);
+
+    void _Refit();
+
+    bool _IntersectPack(
+        const _TrianglePack& pack,
+        const GfVec3f&       origin,
+        const GfVec3f&       direction,
+        float*               distance,
+        GfVec3f*             normal) const;
+
+    std::vector<_Node>                           _nodes;
+    std::vector<_TrianglePack>                   _packs;
+    std::vector<std::array<uint32_t, kPackSize>> _packTriangles;
+    std::vector<GfVec3i>                         _triangles;
+    _Geometry                                    _geometry;
+    UsdTimeCode                                  _time;
+    bool                                         _timeVarying { false };
+    bool                                         _leftHanded { false };
+};
+
+MayaUsdProxyShapeRayCaster::_MeshBVH::_MeshBVH(const UsdGeomMesh& mesh, const UsdTimeCode& time)
+    : _time(time)
+{
+    TRACE_FUNCTION();
+
+    _timeVarying = mesh.GetPointsAttr().ValueMightBeTimeVarying()
+        || mesh.GetFaceVertexCountsAttr().ValueMightBeTimeVarying()
+        || mesh.GetFaceVertexIndicesAttr().ValueMightBeTimeVarying();
+
+    TfToken orientation;
+    mesh.GetOrientationAttr().Get(&orientation);
+    _leftHanded = (orientation == UsdGeomTokens->leftHanded);
+
+    _geometry.Read(mesh, time);
+    const VtVec3fArray& points = _geometry.points;
+    const VtIntArray&   faceVertexCounts = _geometry.faceVertexCounts;
+    const VtIntArray&   faceVertexIndices = _geometry.faceVertexIndices;
+    std::vector<int>    holeIndices(_geometry.holeIndices.begin(), _geometry.holeIndices.end());
+    std::sort(holeIndices.begin(), holeIndices.end());
+
+    // Fan triangulation of the faces, skipping holes and invalid indices.
+    const int             pointCount = static_cast<int>(points.size());
+    std::vector<GfVec3i>& triangles = _triangles;
+    size_t                faceStart = 0;
+    for (size_t face = 0; face < faceVertexCounts.size(); ++face) {
+        const int vertexCount = faceVertexCounts[face];
+        if (vertexCount < 0 || faceStart + vertexCount > faceVertexIndices.size()) {
+            break;
+        }
+        if (!std::binary_search(holeIndices.begin(), holeIndices.end(), static_cast<int>(face))) {
+            for (int i = 1; i + 1 < vertexCount; ++i) {
+                const GfVec3i triangle(
+                    faceVertexIndices[faceStart],
+                    faceVertexIndices[faceStart + i],
+                    faceVertexIndices[faceStart + i + 1]);
+                if (triangle[0] >= 0 && triangle[0] < pointCount && triangle[1] >= 0
+                    && triangle[1] < pointCount && triangle[2] >= 0 && triangle[2] < pointCount) {
+                    triangles.push_back(triangle);
+                }
+            }
+        }
+        faceStart += vertexCount;
+    }
+
+    if (triangles.empty()) {
+        _geometry = _Geometry();
+        return;
+    }
+
+    std::vector<_TriangleRef> refs(triangles.size());
+    for (size_t i = 0; i < triangles.size(); ++i) {
+        _TriangleRef& ref = refs[i];
+        for (size_t corner = 0; corner < 3; ++corner) {
+            ref.bound.UnionWith(points[triangles[i][corner]]);
+        }
+        ref.centroid = ref.bound.GetMidpoint();
+        ref.triangle = static_cast<uint32_t>(i);
+    }
+
+    _nodes.reserve(2 * (triangles.size() / kPackSize + 1));
+    _packs.reserve(triangles.size() / kPackSize + 1);
+    _packTriangles.reserve(triangles.size() / kPackSize + 1);
+    _BuildNode(refs, 0, refs.size());
+
+    // Only time-varying meshes need their geometry to be updated later on.
+    if (!_timeVarying) {
+        _packTriangles = {};
+        _triangles = {};
+        _geometry = _Geometry();
+    }
+}
+
+bool MayaUsdProxyShapeRayCaster::_MeshBVH::Update(
+    const UsdGeomMesh& mesh,
+    const UsdTimeCode& time)
+{
+    if (!_timeVarying || time == _time) {
+        return true;
+    }
+
+    _Geometry geometry;
+    geometry.Read(mesh, time);
+    if (_nodes.empty() || !geometry.HasSameTopology(_geometry)) {
+        return false;
+    }
+
+    _time = time;
+    if (geometry.points != _geometry.points) {
+        TRACE_FUNCTION_SCOPE("refit");
+        _geometry.points = geometry.points;
+        _Refit();
+    }
+    return true;
+}
+
+uint32_t MayaUsdProxyShapeRayCaster::_MeshBVH::_BuildNode(
+    std::vector<_TriangleRef>& refs,
+    size_t                     begin,
+    size_t                     end)
+{
+    const uint32_t nodeIndex = static_cast<uint32_t>(_nodes.size());
+    _nodes.emplace_back();
+
+    GfRange3f bound;
+    GfRange3f centroidBound;
+    for (size_t i = begin; i < end; ++i) {
+        bound.UnionWith(refs[i].bound);
+        centroidBound.UnionWith(refs[i].centroid);
+    }
+    _nodes[nodeIndex].bound = bound;
+
+    if (end - begin <= kPackSize) {
+        const uint32_t packIndex = static_cast<uint32_t>(_packs.size());
+        _packs.emplace_back();
+        _packTriangles.emplace_back();
+        for (size_t lane = 0; lane < end - begin; ++lane) {
+            _packTriangles[packIndex][lane] = refs[begin + lane].triangle;
+        }
+        _FillPack(packIndex, end - begin);
+        _nodes[nodeIndex].index = packIndex;
+        _nodes[nodeIndex].triangleCount = static_cast<uint32_t>(end - begin);
+        return nodeIndex;
+    }
+
+    const GfVec3f size = centroidBound.GetSize();
+    const size_t  axis
+        = (size[0] > size[1]) ? (size[0] > size[2] ? 0 : 2) : (size[1] > size[2] ? 1 : 2);
+    const size_t middle = begin + (end - begin) / 2;
+    std::nth_element(
+        refs.begin() + begin,
+        refs.begin() + middle,
+        refs.begin() + end,
+        [axis](const _TriangleRef& a, const _TriangleRef& b) {
+            return a.centroid[axis] < b.centroid[axis];
+        });
+
+    _BuildNode(refs, begin, middle);
+    const uint32_t secondChild = _BuildNode(refs, middle, end);
+    _nodes[nodeIndex].index = secondChild;
+    return nodeIndex;
+}
+
+GfRange3f MayaUsdProxyShapeRayCaster::_MeshBVH::_FillPack(uint32_t packIndex, size_t triangleCount)
+{
+    const VtVec3fArray& points = _geometry.points;
+    _TrianglePack&      pack = _packs[packIndex];
+    GfRange3f           bound;
+    for (size_t lane = 0; lane < triangleCount; ++lane) {
+        const GfVec3i& triangle = _triangles[_packTriangles[packIndex][lane]];
+        const GfVec3f& p0 = points[triangle[0]];
+        const GfVec3f  e1 = points[triangle[1]] - p0;
+        const GfVec3f  e2 = points[triangle[2]] - p0;
+        for (size_t axis = 0; axis < 3; ++axis) {
+            pack.v0[axis][lane] = p0[axis];
+            pack.e1[axis][lane] = e1[axis];
+            pack.e2[axis][lane] = e2[axis];
+        }
+        for (size_t corner = 0; corner < 3; ++corner) {
+            bound.UnionWith(points[triangle[corner]]);
+        }
+    }
+    return bound;
+}
+
+void MayaUsdProxyShapeRayCaster::_MeshBVH::_Refit()
+{
+    // Children are stored after their parent, so a reverse pass updates them first.
+    for (size_t i = _nodes.size(); i-- > 0;) {
+        _Node& node = _nodes[i];
+        if (node.triangleCount) {
+            node.bound = _FillPack(node.index, node.triangleCount);
+        } else {
+            node.bound = GfRange3f::GetUnion(_nodes[i + 1].bound, _nodes[node.index].bound);
+        }
+    }
+}
+
+bool MayaUsdProxyShapeRayCaster::_MeshBVH::Intersect(
+    const GfVec3f& origin,
+    const GfVec3f& direction,
+    float*         distance,
+    GfVec3f*       normal) const
+{
+    if (_nodes.empty()) {
+        return false;
+    }
+
+    struct _Visit
+    {
+        uint32_t node;
+        float    entryDistance;
+    };
+
+    const GfVec3f invDirection = inverse(direction);
+
+    // Median splits keep the hierarchy balanced: its depth is below 32 for any mesh.
+    _Visit stack[64];
+    size_t stackSize = 0;
+    float  entryDistance;
+    if (!intersectBox(_nodes[0].bound, origin, invDirection, *distance, &entryDistance)) {
+        return false;
+    }
+    stack[stackSize++] = { 0, entryDistance };
+
+    bool hit = false;
+    while (stackSize) {
+        const _Visit visit = stack[--stackSize];
+        if (visit.entryDistance > *distance) {
+            continue;
+        }
+
+        const _Node& node = _nodes[visit.node];
+        if (node.triangleCount) {
+            hit |= _IntersectPack(_packs[node.index], origin, direction, distance, normal);
+            continue;
+        }
+
+        // Visit the nearest child first, so that its hits prune the other one.
+        _Visit children[2] = { { visit.node + 1, 0.0f }, { node.index, 0.0f } };
+        bool   childHits[2];
+        for (size_t c = 0; c < 2; ++c) {
+            childHits[c] = intersectBox(
+                _nodes[children[c].node].bound,
+                origin,
+                invDirection,
+                *distance,
+                &children[c].entryDistance);
+        }
+        if (childHits[0] && childHits[1] && children[0].entryDistance < children[1].entryDistance) {
+            std::swap(children[0], children[1]);
+            std::swap(childHits[0], childHits[1]);
+        }
+        for (size_t c = 0; c < 2; ++c) {
+            if (childHits[c]) {
+                stack[stackSize++] = children[c];
+            }
+        }
+    }
+    return hit;
+}
+
+bool MayaUsdProxyShapeRayCaster::_MeshBVH::_IntersectPack(
+    const _TrianglePack& pack,
+    const GfVec3f&       origin,
+    const GfVec3f&       direction,
+    float*               distance,
+    GfVec3f*             normal) const
+{
+    // Moller-Trumbore test of the ray against the triangles of the pack.
+    float t[kPackSize];
+    int   hitMask = 0;
+
+#if defined(__SSE__)
+    using namespace MayaUsdUtils;
+
+    const f128 dx = splat4f(direction[0]);
+    const f128 dy = splat4f(direction[1]);
+    const f128 dz = splat4f(direction[2]);
+    const f128 e1x = loadu4f(pack.e1[0]);
+    const f128 e1y = loadu4f(pack.e1[1]);
+    const f128 e1z = loadu4f(pack.e1[2]);
+    const f128 e2x = loadu4f(pack.e2[0]);
+    const f128 e2y = loadu4f(pack.e2[1]);
+    const f128 e2z = loadu4f(pack.e2[2]);
+
+    const f128 px = sub4f(mul4f(dy, e2z), mul4f(dz, e2y));
+    const f128 py = sub4f(mul4f(dz, e2x), mul4f(dx, e2z));
+    const f128 pz = sub4f(mul4f(dx, e2y), mul4f(dy, e2x));
+    const f128 det = add4f(add4f(mul4f(e1x, px), mul4f(e1y, py)), mul4f(e1z, pz));
+    const f128 invDet = div4f(splat4f(1.0f), det);
+
+    const f128 sx = sub4f(splat4f(origin[0]), loadu4f(pack.v0[0]));
+    const f128 sy = sub4f(splat4f(origin[1]), loadu4f(pack.v0[1]));
+    const f128 sz = sub4f(splat4f(origin[2]), loadu4f(pack.v0[2]));
+    const f128 u = mul4f(add4f(add4f(mul4f(sx, px), mul4f(sy, py)), mul4f(sz, pz)), invDet);
+
+    const f128 qx = sub4f(mul4f(sy, e1z), mul4f(sz, e1y));
+    const f128 qy = sub4f(mul4f(sz, e1x), mul4f(sx, e1z));
+    const f128 qz = sub4f(mul4f(sx, e1y), mul4f(sy, e1x));
+    const f128 v = mul4f(add4f(add4f(mul4f(dx, qx), mul4f(dy, qy)), mul4f(dz, qz)), invDet);
+    const f128 tt = mul4f(add4f(add4f(mul4f(e2x, qx), mul4f(e2y, qy)), mul4f(e2z, qz)), invDet);
+
+    const f128 zero = zero4f();
+    f128       mask = cmpne4f(det, zero);
+    mask = and4f(mask, cmpge4f(u, zero));
+    mask = and4f(mask, cmpge4f(v, zero));
+    mask = and4f(mask, cmpge4f(splat4f(1.0f), add4f(u, v)));
+    mask = and4f(mask, cmpgt4f(tt, zero));
+    mask = and4f(mask, cmplt4f(tt, splat4f(*distance)));
+    hitMask = movemask4f(mask);
+    storeu4f(t, tt);
+#else
+    for (size_t lane = 0; lane < kPackSize; ++lane) {
+        const GfVec3f e1(pack.e1[0][lane], pack.e1[1][lane], pack.e1[2][lane]);
+        const GfVec3f e2(pack.e2[0][lane], pack.e2[1][lane], pack.e2[2][lane]);
+        const GfVec3f p = GfCross(direction, e2);
+        const float   det = GfDot(e1, p);
+        if (det == 0.0f) {
+            continue;
+        }
+        const float   invDet = 1.0f / det;
+        const GfVec3f s = origin - GfVec3f(pack.v0[0][lane], pack.v0[1][lane], pack.v0[2][lane]);
+        const float   u = GfDot(s, p) * invDet;
+        const GfVec3f q = GfCross(s, e1);
+        const float   v = GfDot(direction, q) * invDet;
+        t[lane] = GfDot(e2, q) * invDet;
+        if (u >= 0.0f && v >= 0.0f && u + v <= 1.0f && t[lane] > 0.0f && t[lane] < *distance) {
+            hitMask |= (1 << lane);
+        }
+    }
+#endif
+
+    if (!hitMask) {
+        return false;
+    }
+
+    size_t nearest = kPackSize;
+    for (size_t lane = 0; lane < kPackSize; ++lane) {
+        if ((hitMask & (1 << lane)) && (nearest == kPackSize || t[lane] < t[nearest])) {
+            nearest = lane;
+        }
+    }
+
+    *distance = t[nearest];
+    *normal = GfCross(
+        GfVec3f(pack.e1[0][nearest], pack.e1[1][nearest], pack.e1[2][nearest]),
+        GfVec3f(pack.e2[0][nearest], pack.e2[1][nearest], pack.e2[2][nearest]));
+    if (_leftHanded) {
+        *normal = -*normal;
+    }
+    return true;
+}
+
+/// The state of a ray intersection: the ray, the closest hit found so far and the caches
+/// used while traversing the stage.
+struct MayaUsdProxyShapeRayCaster::_Query
+{
+    _Query(
+        const UsdTimeCode&   time,
+        const TfTokenVector& purposes,
+        const SdfPathVector& excludedPaths,
+        const GfRay&         ray)
+        : time(time)
+        , purposes(purposes)
+        , excludedPaths(excludedPaths)
+        , ray(ray)
+        , xformCache(time)
+    {
+    }
+
+    const UsdTimeCode    time;
+    const TfTokenVector& purposes;
+    const SdfPathVector& excludedPaths;
+    const GfRay          ray;
+    UsdGeomXformCache    xformCache;
+
+    // In units of the ray direction, which are preserved by the mesh transformations.
+    double  distance { std::numeric_limits<double>::infinity() };
+    GfVec3d point;
+    GfVec3d normal;
+    bool    hit { false };
+};
+
+MayaUsdProxyShapeRayCaster::MayaUsdProxyShapeRayCaster() { }
+
+MayaUsdProxyShapeRayCaster::~MayaUsdProxyShapeRayCaster() { }
+
+bool MayaUsdProxyShapeRayCaster::Intersect(
+    const UsdPrim&       root,
+    const UsdTimeCode&   time,
+    const TfTokenVector& purposes,
+    const SdfPathVector& excludedPaths,
+    const GfRay&         ray,
+    GfVec3d*             outPoint,
+    GfVec3d*             outNormal)
+{
+    TRACE_FUNCTION();
+
+    if (!root) {
+        return false;
+    }
+
+    SdfPathVector sortedExcludedPaths(excludedPaths);
+    std::sort(sortedExcludedPaths.begin(), sortedExcludedPaths.end());
+
+    _Query query(time, purposes, sortedExcludedPaths, ray);
+
+    // The visibility and purpose of the root prim may be inherited from its ancestors.
+    UsdGeomImageable::PurposeInfo parentPurposeInfo;
+    const UsdPrim                 parent = root.GetParent();
+    if (parent && parent.IsA<UsdGeomImageable>()) {
+        const UsdGeomImageable parentImageable(parent);
+        if (parentImageable.ComputeVisibility(time) == UsdGeomTokens->invisible) {
+            return false;
+        }
+        parentPurposeInfo = parentImageable.ComputePurposeInfo();
+    }
+
+    _IntersectSubtree(root, parentPurposeInfo, query);
+
+    if (!query.hit) {
+        return false;
+    }
+
+    *outPoint = query.point;
+    *outNormal = query.normal;
+    return true;
+}
+
+void MayaUsdProxyShapeRayCaster::_IntersectSubtree(
+    const UsdPrim&                       prim,
+    const UsdGeomImageable::PurposeInfo& parentPurposeInfo,
+    _Query&                              query)
+{
+    const SdfPathVector& excludedPaths = query.excludedPaths;
+    if (std::binary_search(excludedPaths.begin(), excludedPaths.end(), prim.GetPath())) {
+        return;
+    }
+
+    UsdGeomImageable::PurposeInfo purposeInfo = parentPurposeInfo;
+    if (prim.IsA<UsdGeomImageable>()) {
+        const UsdGeomImageable imageable(prim);
+        TfToken                visibility;
+        if (imageable.GetVisibilityAttr().Get(&visibility, query.time)
+            && visibility == UsdGeomTokens->invisible) {
+            return;
+        }
+        purposeInfo = imageable.ComputePurposeInfo(parentPurposeInfo);
+    }
+
+    if (prim.IsA<UsdGeomPointInstancer>()) {
+        return;
+    }
+
+    if (prim.IsA<UsdGeomMesh>()
+        && std::find(query.purposes.begin(), query.purposes.end(), purposeInfo.purpose)
+            != query.purposes.end()) {
+        _IntersectMesh(prim, query);
+    }
+
+    for (const UsdPrim& child : prim.GetFilteredChildren(UsdTraverseInstanceProxies())) {
+        _IntersectSubtree(child, purposeInfo, query);
+    }
+}
+
+void MayaUsdProxyShapeRayCaster::_IntersectMesh(const UsdPrim& prim, _Query& query)
+{
+    const GfMatrix4d stageToLocal = query.xformCache.GetLocalToWorldTransform(prim).GetInverse();
+    const GfVec3f    origin(stageToLocal.Transform(query.ray.GetStartPoint()));
+    const GfVec3f    direction(stageToLocal.TransformDir(query.ray.GetDirection()));
+    float            distance
+        = static_cast<float>(std::min(query.distance, double(std::numeric_limits<float>::max())));
+
+    // Skip the meshes out of reach of the ray before building their hierarchy.
+    const UsdGeomMesh mesh(prim);
+    VtVec3fArray      extent;
+    float             entryDistance;
+    if (mesh.GetExtentAttr().Get(&extent, query.time) && extent.size() == 2
+        && !intersectBox(
+            GfRange3f(extent[0], extent[1]),
+            origin,
+            inverse(direction),
+            distance,
+            &entryDistance)) {
+        return;
+    }
+
+    // Instances share the hierarchies of the meshes of their prototype.
+    const SdfPath key
+        = prim.IsInstanceProxy() ? prim.GetPrimInPrototype().GetPath() : prim.GetPath();
+    std::shared_ptr<_MeshBVH>& bvh = _meshes[key];
+    if (!bvh || !bvh->Update(mesh, query.time)) {
+        bvh = std::make_shared<_MeshBVH>(mesh, query.time);
+    }
+
+    GfVec3f normal;
+    if (!bvh->Intersect(origin, direction, &distance, &normal)) {
+        return;
+    }
+
+    query.hit = true;
+    query.distance = distance;
+    query.point = query.ray.GetPoint(distance);
+    // Normals are transformed by the inverse transpose of the mesh transformation.
+    query.normal = stageToLocal.GetTranspose().TransformDir(GfVec3d(normal)).GetNormalized();
+}
+
+void MayaUsdProxyShapeRayCaster::Invalidate(const UsdNotice::ObjectsChanged& notice)
+{
+    if (_meshes.empty()) {
+        return;
+    }
+
+    for (const SdfPath& path : notice.GetResyncedPaths()) {
+        if (path.IsAbsoluteRootPath()) {
+            Clear();
+            return;
+        }
+
+        // The hierarchies are in the space of their mesh, so adding or removing transform
+        // operations of a prim leaves the hierarchies of its descendants valid.
+        auto iter = _meshes.find(path.GetPrimPath());
+        if (iter == _meshes.end()) {
+            continue;
+        }
+        if (!path.IsPropertyPath()) {
+            _meshes.erase(iter);
+        } else if (isMeshGeometryProperty(path.GetNameToken())) {
+            iter->second.reset();
+        }
+    }
+
+    for (const SdfPath& path : notice.GetChangedInfoOnlyPaths()) {
+        if (!path.IsPropertyPath() || !isMeshGeometryProperty(path.GetNameToken())) {
+            continue;
+        }
+
+        auto iter = _meshes.find(path.GetPrimPath());
+        if (iter != _meshes.end()) {
+            iter->second.reset();
+        }
+    }
+}
+
+void MayaUsdProxyShapeRayCaster::Clear() { _meshes.clear(); }
+
+PXR_NAMESPACE_CLOSE_SCOPE
@@ -0,0 +1,96 @@
+//
+// Copyright 2024 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef MAYAUSD_PROXY_SHAPE_RAY_CASTER_H
+#define MAYAUSD_PROXY_SHAPE_RAY_CASTER_H
+
+#include <mayaUsd/base/api.h>
+
+#include <pxr/base/gf/ray.h>
+#include <pxr/base/gf/vec3d.h>
+#include <pxr/base/tf/token.h>
+#include <pxr/pxr.h>
+#include <pxr/usd/sdf/path.h>
+#include <pxr/usd/sdf/pathTable.h>
+#include <pxr/usd/usd/notice.h>
+#include <pxr/usd/usd/prim.h>
+#include <pxr/usd/usd/timeCode.h>
+#include <pxr/usd/usdGeom/imageable.h>
+
+#include <memory>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+/// \class MayaUsdProxyShapeRayCaster
+/// \brief Intersects rays with the meshes under the proxy shape root prim on the CPU, to
+/// compute the closest point on the proxy shape used by make live and snapping.
+///
+/// The triangles of each mesh are kept in a bounding volume hierarchy, in the space of the
+/// mesh, built the first time a ray reaches the extent of the mesh. Transform changes keep
+/// the hierarchies, a change to the points or the topology of a mesh only rebuilds the
+/// hierarchy of that mesh, and instances share the hierarchies of the meshes of their
+/// prototype. The hierarchies of animated meshes are refit to the points of other time codes
+/// while their topology does not change. Point instancers are not intersected.
+///
+/// Invalidate() must be called with every ObjectsChanged notice sent by the stage.
+class MayaUsdProxyShapeRayCaster
+{
+public:
+    MAYAUSD_CORE_PUBLIC
+    MayaUsdProxyShapeRayCaster();
+
+    MAYAUSD_CORE_PUBLIC
+    ~MayaUsdProxyShapeRayCaster();
+
+    /// \brief Finds the first intersection of \p ray with the visible meshes of the given
+    /// \p purposes under \p root at \p time, ignoring the prims under \p excludedPaths.
+    /// The ray, point and normal are in the space of the stage.
+    /// Returns false if the ray hits nothing.
+    MAYAUSD_CORE_PUBLIC
+    bool Intersect(
+        const UsdPrim&       root,
+        const UsdTimeCode&   time,
+        const TfTokenVector& purposes,
+        const SdfPathVector& excludedPaths,
+        const GfRay&         ray,
+        GfVec3d*             outPoint,
+        GfVec3d*             outNormal);
+
+    /// \brief Discards the hierarchies of the meshes affected by the changes described by
+    /// \p notice.
+    MAYAUSD_CORE_PUBLIC
+    void Invalidate(const UsdNotice::ObjectsChanged& notice);
+
+    /// \brief Discards the hierarchies of all meshes.
+    MAYAUSD_CORE_PUBLIC
+    void Clear();
+
+private:
+    class _MeshBVH;
+    struct _Query;
+
+    void _IntersectSubtree(
+        const UsdPrim&                       prim,
+        const UsdGeomImageable::PurposeInfo& parentPurposeInfo,
+        _Query&                              query);
+
+    void _IntersectMesh(const UsdPrim& prim, _Query& query);
+
+    SdfPathTable<std::shared_ptr<_MeshBVH>> _meshes;
+};
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif
@@ -464,6 +464,8 @@ void wrapJobImportArgs()
             "importUSDZTexturesFilePath", &UsdMayaJobImportArgs::importUSDZTexturesFilePath)
         .def_readonly("importRelativeTextures", &UsdMayaJobImportArgs::importRelativeTextures)
         .def_readonly("importWithProxyShapes", &UsdMayaJobImportArgs::importWithProxyShapes)
+        .def_readonly("parallelRead", &UsdMayaJobImportArgs::parallelRead)
+        .def_readonly("perfReport", &UsdMayaJobImportArgs::perfReport)
         .add_property(
             "includeAPINames",
             make_getter(
@@ -581,6 +581,7 @@ void wrapJobExportArgs()
         .def_readonly("melPostCallback", &UsdMayaJobExportArgs::melPostCallback)
         .def_readonly("mergeTransformAndShape", &UsdMayaJobExportArgs::mergeTransformAndShape)
         .def_readonly("normalizeNurbs", &UsdMayaJobExportArgs::normalizeNurbs)
+        .def_readonly("parallelWrite", &UsdMayaJobExportArgs::parallelWrite)
         .def_readonly("preserveUVSetNames", &UsdMayaJobExportArgs::preserveUVSetNames)
         .def_readonly("writeDefaults", &UsdMayaJobExportArgs::writeDefaults)
         .add_property(
@@ -603,6 +604,9 @@ void wrapJobExportArgs()
             "shadingMode",
             make_getter(&UsdMayaJobExportArgs::shadingMode, return_value_policy<return_by_value>()))
         .def_readonly("staticSingleSample", &UsdMayaJobExportArgs::staticSingleSample)
+        .def_readonly("timeSampleTolerance", &UsdMayaJobExportArgs::timeSampleTolerance)
+        .def_readonly("streamingChunkSize", &UsdMayaJobExportArgs::streamingChunkSize)
+        .def_readonly("perfReport", &UsdMayaJobExportArgs::perfReport)
         .def_readonly("stripNamespaces", &UsdMayaJobExportArgs::stripNamespaces)
         .def_readonly("worldspace", &UsdMayaJobExportArgs::worldspace)
         .add_property(
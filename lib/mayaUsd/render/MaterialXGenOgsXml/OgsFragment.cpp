@@ -41,43 +41,6 @@ const MString OPTVAR_NUM_SAMPLES = "MxMayaEnvironmentSamples";
 /// fis mode is available and selected.
 const MString OPTVAR_ALBEDO_METHOD = "MxMayaEnvironmentAlbedoMethod";
 
-// Find the expected environment mode depending on Maya capabilities and optionVars:
-mx::HwSpecularEnvironmentMethod _getEnvironmentOptions(int& numSamples, bool& isMonteCarlo)
-{
-    bool varExists = false;
-    switch (mx::OgsXmlGenerator::useLightAPI()) {
-    case 1:
-    case 2: {
-        // We default with prefilter but will respect "None" as a choice
-        MString envMethod = MGlobal::optionVarStringValue(OPTVAR_ENVIRONMENT_METHOD, &varExists);
-        if (varExists && envMethod == "none") {
-            return mx::SPECULAR_ENVIRONMENT_NONE;
-        } else {
-            return mx::SPECULAR_ENVIRONMENT_PREFILTER;
-        }
-    } break;
-    case 3: {
-        // We default with fis
-        MString envMethod = MGlobal::optionVarStringValue(OPTVAR_ENVIRONMENT_METHOD, &varExists);
-        if (varExists) {
-            if (envMethod == "none") {
-                return mx::SPECULAR_ENVIRONMENT_NONE;
-            } else if (envMethod == "prefiltered") {
-                return mx::SPECULAR_ENVIRONMENT_PREFILTER;
-            }
-        }
-        numSamples = MGlobal::optionVarIntValue(OPTVAR_NUM_SAMPLES, &varExists);
-        if (!varExists) {
-            numSamples = 64;
-        }
-        MString albedoMethod = MGlobal::optionVarStringValue(OPTVAR_ALBEDO_METHOD, &varExists);
-        isMonteCarlo = (varExists && albedoMethod == "montecarlo");
-        return mx::SPECULAR_ENVIRONMENT_FIS;
-    } break;
-    }
-    return mx::SPECULAR_ENVIRONMENT_NONE;
-}
-
 // The base class for classes wrapping GLSL fragment generators for use during
 // OgsFragment construction.
 class GlslGeneratorWrapperBase
@@ -85,8 +48,11 @@ class GlslGeneratorWrapperBase
     GlslGeneratorWrapperBase() = delete;
 
 protected:
-    explicit GlslGeneratorWrapperBase(mx::ElementPtr element)
+    GlslGeneratorWrapperBase(
+        mx::ElementPtr                          element,
+        const OgsFragment::SpecularEnvironment& specularEnvironment)
         : _element(element)
+        , _specularEnvironment(specularEnvironment)
     {
         if (!_element)
             throw mx::Exception("No element specified");
@@ -111,21 +77,25 @@ protected:
         }
     }
 
+public:
+    const OgsFragment::SpecularEnvironment& getSpecularEnvironment() const
+    {
+        return _specularEnvironment;
+    }
+
 protected:
     void setCommonOptions(
         mx::GenOptions&            genOptions,
         mx::GenContext&            context,
         const mx::ShaderGenerator& generator)
     {
-        int  numSamples = 64;
-        bool isMonteCarlo = false;
-        genOptions.hwSpecularEnvironmentMethod = _getEnvironmentOptions(numSamples, isMonteCarlo);
+        genOptions.hwSpecularEnvironmentMethod = _specularEnvironment.method;
         // FIS option has further sub-options to check:
         if (genOptions.hwSpecularEnvironmentMethod == mx::SPECULAR_ENVIRONMENT_FIS) {
             context.pushUserData(
                 mx::HwSpecularEnvironmentSamples::name(),
-                mx::HwSpecularEnvironmentSamples::create(numSamples));
-            if (isMonteCarlo) {
+                mx::HwSpecularEnvironmentSamples::create(_specularEnvironment.numSamples));
+            if (_specularEnvironment.isMonteCarlo) {
                 genOptions.hwDirectionalAlbedoMethod = mx::DIRECTIONAL_ALBEDO_MONTE_CARLO;
             }
         }
@@ -159,7 +129,8 @@ protected:
     mx::ElementPtr _element;
 
 private:
-    bool _isSurface = false;
+    OgsFragment::SpecularEnvironment _specularEnvironment;
+    bool                             _isSurface = false;
 };
 
 // Knows how to create a temporary local GLSL fragment generator to generate
@@ -168,8 +139,11 @@ private:
 class LocalGlslGeneratorWrapper : public GlslGeneratorWrapperBase
 {
 public:
-    LocalGlslGeneratorWrapper(mx::ElementPtr element, const mx::FileSearchPath& librarySearchPath)
-        : GlslGeneratorWrapperBase(element)
+    LocalGlslGeneratorWrapper(
+        mx::ElementPtr                          element,
+        const mx::FileSearchPath&               librarySearchPath,
+        const OgsFragment::SpecularEnvironment& specularEnvironment)
+        : GlslGeneratorWrapperBase(element, specularEnvironment)
         , _librarySearchPath(librarySearchPath)
     {
     }
@@ -253,7 +227,7 @@ class ExternalGlslGeneratorWrapper : public GlslGeneratorWrapperBase
 {
 public:
     ExternalGlslGeneratorWrapper(mx::ElementPtr element, mx::GenContext& genContext)
-        : GlslGeneratorWrapperBase(element)
+        : GlslGeneratorWrapperBase(element, OgsFragment::getSpecularEnvironment())
         , _genContext(genContext)
     {
     }
@@ -279,7 +253,8 @@ private:
 std::string generateFragment(
     std::string&       fragmentSource,
     const mx::Shader&  glslShader,
-    const std::string& baseFragmentName)
+    const std::string& baseFragmentName,
+    const std::string& specularEnvKey)
 {
     static const std::string FRAGMENT_NAME_TOKEN = "$fragmentName";
 
@@ -318,8 +293,7 @@ std::string generateFragment(
     // MaterialX fragment).
     std::ostringstream nameStream;
     const size_t       sourceHash = std::hash<std::string> {}(fragmentSource);
-    nameStream << baseFragmentName << "__" << std::hex << sourceHash
-               << OgsFragment::getSpecularEnvKey();
+    nameStream << baseFragmentName << "__" << std::hex << sourceHash << specularEnvKey;
     std::string fragmentName = nameStream.str();
 
     // Substitute the placeholder name token with the actual name.
@@ -371,7 +345,16 @@ std::string generateLightRig(
 } // anonymous namespace
 
 OgsFragment::OgsFragment(mx::ElementPtr element, const mx::FileSearchPath& librarySearchPath)
-    : OgsFragment(element, LocalGlslGeneratorWrapper(element, librarySearchPath))
+    : OgsFragment(element, librarySearchPath, getSpecularEnvironment())
+{
+}
+
+OgsFragment::OgsFragment(
+    mx::ElementPtr             element,
+    const mx::FileSearchPath&  librarySearchPath,
+    const SpecularEnvironment& specularEnvironment)
+    : OgsFragment(
+        element, LocalGlslGeneratorWrapper(element, librarySearchPath, specularEnvironment))
 {
 }
 
@@ -400,7 +383,11 @@ OgsFragment::OgsFragment(mx::ElementPtr element, GLSL_GENERATOR_WRAPPER&& glslGe
 
     // Generate the complete XML fragment source embedding both GLSL and HLSL
     // code.
-    _fragmentName = generateFragment(_fragmentSource, *_glslShader, baseFragmentName);
+    _fragmentName = generateFragment(
+        _fragmentSource,
+        *_glslShader,
+        baseFragmentName,
+        getSpecularEnvKey(glslGeneratorWrapper.getSpecularEnvironment()));
 
     const mx::ShaderGraph& graph = _glslShader->getGraph();
     bool                   lighting
@@ -482,14 +469,55 @@ std::string OgsFragment::getMatrix4Name(const std::string& matrix3Name)
     return matrix3Name + mx::GlslFragmentGenerator::MATRIX3_TO_MATRIX4_POSTFIX;
 }
 
-std::string OgsFragment::getSpecularEnvKey()
+// Find the expected environment mode depending on Maya capabilities and optionVars:
+OgsFragment::SpecularEnvironment OgsFragment::getSpecularEnvironment()
+{
+    SpecularEnvironment specularEnvironment;
+    bool                varExists = false;
+    switch (mx::OgsXmlGenerator::useLightAPI()) {
+    case 1:
+    case 2: {
+        // We default with prefilter but will respect "None" as a choice
+        MString envMethod = MGlobal::optionVarStringValue(OPTVAR_ENVIRONMENT_METHOD, &varExists);
+        if (varExists && envMethod == "none") {
+            specularEnvironment.method = mx::SPECULAR_ENVIRONMENT_NONE;
+        } else {
+            specularEnvironment.method = mx::SPECULAR_ENVIRONMENT_PREFILTER;
+        }
+    } break;
+    case 3: {
+        // We default with fis
+        MString envMethod = MGlobal::optionVarStringValue(OPTVAR_ENVIRONMENT_METHOD, &varExists);
+        if (varExists) {
+            if (envMethod == "none") {
+                specularEnvironment.method = mx::SPECULAR_ENVIRONMENT_NONE;
+                break;
+            } else if (envMethod == "prefiltered") {
+                specularEnvironment.method = mx::SPECULAR_ENVIRONMENT_PREFILTER;
+                break;
+            }
+        }
+        specularEnvironment.method = mx::SPECULAR_ENVIRONMENT_FIS;
+        specularEnvironment.numSamples = MGlobal::optionVarIntValue(OPTVAR_NUM_SAMPLES, &varExists);
+        if (!varExists) {
+            specularEnvironment.numSamples = 64;
+        }
+        MString albedoMethod = MGlobal::optionVarStringValue(OPTVAR_ALBEDO_METHOD, &varExists);
+        specularEnvironment.isMonteCarlo = (varExists && albedoMethod == "montecarlo");
+    } break;
+    }
+    return specularEnvironment;
+}
+
+std::string OgsFragment::getSpecularEnvKey() { return getSpecularEnvKey(getSpecularEnvironment()); }
+
+std::string OgsFragment::getSpecularEnvKey(const SpecularEnvironment& specularEnvironment)
 {
     std::string retVal;
-    int         numSamples = 64;
-    bool        isMonteCarlo = false;
-    switch (_getEnvironmentOptions(numSamples, isMonteCarlo)) {
+    switch (specularEnvironment.method) {
     case mx::SPECULAR_ENVIRONMENT_FIS:
-        retVal += "F" + std::to_string(numSamples) + (isMonteCarlo ? "MC" : "P");
+        retVal += "F" + std::to_string(specularEnvironment.numSamples)
+            + (specularEnvironment.isMonteCarlo ? "MC" : "P");
         break;
     case mx::SPECULAR_ENVIRONMENT_PREFILTER: retVal = "P"; break;
     default: retVal = "N"; break;
@@ -7,6 +7,7 @@
 #include <mayaUsd/base/api.h>
 
 #include <MaterialXCore/Document.h>
+#include <MaterialXGenShader/GenOptions.h>
 #include <MaterialXGenShader/Shader.h>
 #include <MaterialXRender/ImageHandler.h>
 
@@ -21,9 +22,25 @@ namespace MaterialXMaya {
 class MAYAUSD_CORE_PUBLIC OgsFragment
 {
 public:
+    /// Specular environment settings of the generated fragments.
+    struct SpecularEnvironment
+    {
+        mx::HwSpecularEnvironmentMethod method = mx::SPECULAR_ENVIRONMENT_NONE;
+        int                             numSamples = 64;
+        bool                            isMonteCarlo = false;
+    };
+
     /// Creates a local GLSL fragment generator
     OgsFragment(mx::ElementPtr, const mx::FileSearchPath& librarySearchPath);
 
+    /// Creates a local GLSL fragment generator with the given specular environment
+    /// settings. Unlike the other constructors, it does not read Maya option variables,
+    /// so it can be used outside of the main thread.
+    OgsFragment(
+        mx::ElementPtr,
+        const mx::FileSearchPath&  librarySearchPath,
+        const SpecularEnvironment& specularEnvironment);
+
     /// Reuses an externally-provided GLSL fragment generator. Used in the test
     /// harness.
     OgsFragment(mx::ElementPtr, mx::GenContext&);
@@ -87,9 +104,16 @@ public:
     /// Required because OGS doesn't support matrix3 parameters.
     static std::string getMatrix4Name(const std::string& matrix3Name);
 
+    /// Read the specular environment settings from the Maya option variables. Must be
+    /// called on the main thread.
+    static SpecularEnvironment getSpecularEnvironment();
+
     /// Get a string that is unique for each environment settings possible:
     static std::string getSpecularEnvKey();
 
+    /// Get a string that is unique for the given environment settings:
+    static std::string getSpecularEnvKey(const SpecularEnvironment& specularEnvironment);
+
     /// Prepare all data structures to handle an internal Maya OCIO fragment:
     static std::string registerOCIOFragment(const std::string& fragName);
 
@@ -33,6 +33,8 @@ const MString& ColorManagementPreferences::RenderingSpaceName()
     return Get()._renderingSpaceName;
 }
 
+const MString& ColorManagementPreferences::ConfigFilePath() { return Get()._configFilePath; }
+
 const MString& ColorManagementPreferences::sRGBName() { return Get()._sRGBName; }
 
 std::string ColorManagementPreferences::getFileRule(const std::string& path)
@@ -120,6 +122,9 @@ void ColorManagementPreferences::Refresh()
     _renderingSpaceName
         = MGlobal::executeCommandStringResult("colorManagementPrefs -q -renderingSpaceName");
 
+    _configFilePath
+        = MGlobal::executeCommandStringResult("colorManagementPrefs -q -configFilePath");
+
     // Need some robustness around sRGB since not all OCIO configs declare it the same way:
     const auto sRGBAliases
         = std::set<std::string> { "sRGB",         "sRGB - Texture",
@@ -43,6 +43,10 @@ public:
      */
     static const MString& RenderingSpaceName();
 
+    /*! \brief  The path of the current OCIO config file.
+     */
+    static const MString& ConfigFilePath();
+
     /*! \brief  The current DCC color space name for plain sRGB
 
         Color management config files can rename or alias the sRGB color space name. We try a few
@@ -72,6 +76,7 @@ private:
     bool                     _dirty = true;
     bool                     _active = false;
     MString                  _renderingSpaceName;
+    MString                  _configFilePath;
     MString                  _sRGBName;
     std::vector<MCallbackId> _mayaColorManagementCallbackIds;
 
@@ -24,6 +24,7 @@
 #include <mayaUsd/base/tokens.h>
 #include <mayaUsd/render/vp2RenderDelegate/colorManagementPreferences.h>
 #include <mayaUsd/render/vp2RenderDelegate/proxyRenderDelegate.h>
+#include <mayaUsd/render/vp2RenderDelegate/textureLoadingQueue.h>
 #include <mayaUsd/render/vp2ShaderFragments/shaderFragments.h>
 #include <mayaUsd/utils/hash.h>
 
@@ -32,9 +33,17 @@
 #include <pxr/base/gf/vec2f.h>
 #include <pxr/base/gf/vec3f.h>
 #include <pxr/base/gf/vec4f.h>
+#include <pxr/base/js/json.h>
+#include <pxr/base/js/value.h>
 #include <pxr/base/tf/diagnostic.h>
+#include <pxr/base/tf/envSetting.h>
 #include <pxr/base/tf/getenv.h>
 #include <pxr/base/tf/pathUtils.h>
+#include <pxr/base/work/dispatcher.h>
+#include <pxr/base/work/loops.h>
+#include <pxr/base/work/threadLimits.h>
+#include <pxr/imaging/hd/changeTracker.h>
+#include <pxr/imaging/hd/renderIndex.h>
 #include <pxr/imaging/hd/sceneDelegate.h>
 
 #ifdef WANT_MATERIALX_BUILD
@@ -70,6 +79,7 @@
 #include <mayaUsd/render/MaterialXGenOgsXml/ShaderGenUtil.h>
 
 #include <MaterialXCore/Document.h>
+#include <MaterialXCore/Util.h>
 #include <MaterialXFormat/File.h>
 #include <MaterialXFormat/Util.h>
 #include <MaterialXGenGlsl/GlslShaderGenerator.h>
@@ -85,9 +95,21 @@
 #include <ghc/filesystem.hpp>
 #include <tbb/parallel_for.h>
 
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <fstream>
+#include <functional>
 #include <iostream>
+#include <memory>
+#include <set>
 #include <sstream>
 #include <string>
+#include <thread>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
@@ -109,6 +131,41 @@ static bool _IsDisabledAsyncTextureLoading()
 // Refresh viewport duration (in milliseconds)
 static const std::size_t kRefreshDuration { 1000 };
 
+// Time an idle task spends waiting for the texture decoding threads and uploading textures
+static const std::chrono::milliseconds kUploadTimeSlice { 4 };
+
+TF_DEFINE_ENV_SETTING(
+    MAYAUSD_VP2_TEXTURE_DECODING_BUDGET_MB,
+    512,
+    "Memory, in megabytes, of the textures decoded in the background beyond which decoding "
+    "waits for the decoded textures to be uploaded to the viewport.");
+
+#ifdef WANT_MATERIALX_BUILD
+TF_DEFINE_ENV_SETTING(
+    MAYAUSD_VP2_MATERIALX_FRAGMENT_CACHE,
+    true,
+    "Reuse the OGS fragments generated for MaterialX networks in previous sessions.");
+
+TF_DEFINE_ENV_SETTING(
+    MAYAUSD_VP2_MATERIALX_FRAGMENT_CACHE_DIR,
+    "",
+    "Directory of the OGS fragments generated for MaterialX networks, which can be shared "
+    "between users. Defaults to a directory in the Maya user application directory.");
+
+TF_DEFINE_ENV_SETTING(
+    MAYAUSD_VP2_MATERIALX_FRAGMENT_CACHE_SIZE,
+    1000,
+    "Number of OGS fragments generated for MaterialX networks kept in the fragment cache. "
+    "The least recently used fragments are removed at the start of the session.");
+
+#if !defined(MAYAUSD_VERSION)
+#error "MAYAUSD_VERSION is not defined"
+#endif
+
+#define STRINGIFY(x) #x
+#define TOSTRING(x)  STRINGIFY(x)
+#endif
+
 namespace {
 
 // USD `UsdImagingDelegate::ApplyPendingUpdates()` would request to
@@ -362,6 +419,253 @@ _MaterialXData& _GetMaterialXData()
     return *materialXData;
 }
 
+//! OGS fragment generated for a MaterialX network, with what is needed to instantiate it.
+struct _MaterialXFragment
+{
+    std::string   name;
+    std::string   source;
+    mx::StringMap pathInputMap;
+    bool          usesNormals { false };
+};
+
+/*! \brief  Cache of the OGS fragments generated for MaterialX networks, kept on disk across
+            sessions.
+
+    Generating a fragment takes a lot longer than compiling it, so the fragments of a scene
+    are reused the next time it is opened. The key of an entry describes everything the
+    generated fragment depends on, and the entry file is named after its hash. The key is
+    saved in the entry to detect hash collisions. Entries are written to a temporary file
+    which is then renamed, so that several sessions can share the cache directory.
+
+    The cache is private to the user by default, since its entries are registered as shader
+    code. Sharing it between users is opted into by setting its directory. Loading an entry
+    refreshes its modification time, and the least recently used entries beyond the cache size
+    are removed when the cache is created.
+*/
+class _MaterialXFragmentDiskCache
+{
+public:
+    static const _MaterialXFragmentDiskCache& GetInstance()
+    {
+        static const _MaterialXFragmentDiskCache cache;
+        return cache;
+    }
+
+    //! Returns the key of the fragment generated for the network with this shader cache ID.
+    static std::string GetKey(const std::string& shaderCacheID);
+
+    //! Returns true and fills the fragment if the key is found in the cache.
+    bool Load(const std::string& key, _MaterialXFragment& fragment) const;
+
+    //! Adds the fragment to the cache. Failures are silent since the cache is optional.
+    void Save(const std::string& key, const _MaterialXFragment& fragment) const;
+
+private:
+    _MaterialXFragmentDiskCache();
+
+    ghc::filesystem::path _GetEntryPath(const std::string& key) const;
+    void                  _Prune() const;
+
+    ghc::filesystem::path _directory; //!< Empty when the cache is disabled
+};
+
+_MaterialXFragmentDiskCache::_MaterialXFragmentDiskCache()
+{
+    if (!TfGetEnvSetting(MAYAUSD_VP2_MATERIALX_FRAGMENT_CACHE)) {
+        return;
+    }
+
+    const std::string& directory = TfGetEnvSetting(MAYAUSD_VP2_MATERIALX_FRAGMENT_CACHE_DIR);
+    if (!directory.empty()) {
+        _directory = directory;
+    } else {
+        // Not in the temporary directory, where another user could create the directory first
+        // and plant entries.
+        const MString userAppDir = MGlobal::executeCommandStringResult("internalVar -uad");
+        if (userAppDir.length() == 0) {
+            return;
+        }
+        _directory = ghc::filesystem::path(userAppDir.asChar()) / "mayaUsd" / "fragmentCache";
+    }
+
+    _Prune();
+}
+
+void _MaterialXFragmentDiskCache::_Prune() const
+{
+    const int    cacheSize = TfGetEnvSetting(MAYAUSD_VP2_MATERIALX_FRAGMENT_CACHE_SIZE);
+    const size_t maxEntries = static_cast<size_t>(std::max(cacheSize, 0));
+
+    using Entry = std::pair<ghc::filesystem::file_time_type, ghc::filesystem::path>;
+    std::vector<Entry> entries;
+    std::error_code    ec;
+    for (ghc::filesystem::directory_iterator it(_directory, ec), end; !ec && it != end;
+         it.increment(ec)) {
+        const ghc::filesystem::path& path = it->path();
+        if (path.extension() != ".json") {
+            continue;
+        }
+        std::error_code timeEc;
+        const auto      time = ghc::filesystem::last_write_time(path, timeEc);
+        if (!timeEc) {
+            entries.emplace_back(time, path);
+        }
+    }
+    if (entries.size() <= maxEntries) {
+        return;
+    }
+
+    // Remove the least recently used entries. Failures are silent, the entries of other users
+    // of a shared cache may not be removable.
+    const auto firstKept = entries.end() - static_cast<std::ptrdiff_t>(maxEntries);
+    std::nth_element(entries.begin(), firstKept, entries.end());
+    for (auto it = entries.begin(); it != firstKept; ++it) {
+        ghc::filesystem::remove(it->second, ec);
+    }
+}
+
+/*static*/
+std::string _MaterialXFragmentDiskCache::GetKey(const std::string& shaderCacheID)
+{
+    std::ostringstream key;
+    key << "mayaUsd " << TOSTRING(MAYAUSD_VERSION) << "\n"
+        << "Maya " << MGlobal::apiVersion() << "\n"
+        << "MaterialX " << mx::getVersionString() << "\n"
+        << "libraries " << _GetMaterialXData()._mtlxSearchPath.asString() << "\n"
+        << "primaryUVSet " << _GetMaterialXData()._mainUvSetName << "\n";
+
+#ifdef HAS_COLOR_MANAGEMENT_SUPPORT_API
+    // The OCIO fragments are inlined in the generated fragment, so it depends on the content
+    // of the config file.
+    if (MayaUsd::ColorManagementPreferences::Active()) {
+        const ghc::filesystem::path configPath(
+            MayaUsd::ColorManagementPreferences::ConfigFilePath().asChar());
+        std::error_code ec;
+        const auto      configTime = ghc::filesystem::last_write_time(configPath, ec);
+        key << "ocio " << configPath.string() << " "
+            << (ec ? 0 : configTime.time_since_epoch().count()) << " "
+            << MayaUsd::ColorManagementPreferences::RenderingSpaceName().asChar() << "\n";
+    }
+#endif
+
+    key << shaderCacheID;
+    return key.str();
+}
+
+ghc::filesystem::path _MaterialXFragmentDiskCache::_GetEntryPath(const std::string& key) const
+{
+    // 64-bit FNV-1a.
+    uint64_t hash = 14695981039346656037ull;
+    for (const char c : key) {
+        hash = (hash ^ static_cast<unsigned char>(c)) * 1099511628211ull;
+    }
+
+    char fileName[32];
+    snprintf(fileName, sizeof(fileName), "%016llx.json", static_cast<unsigned long long>(hash));
+    return _directory / fileName;
+}
+
+bool _MaterialXFragmentDiskCache::Load(const std::string& key, _MaterialXFragment& fragment) const
+{
+    if (_directory.empty()) {
+        return false;
+    }
+
+    const ghc::filesystem::path entryPath = _GetEntryPath(key);
+    std::ifstream               stream(entryPath.string(), std::ios::binary);
+    if (!stream) {
+        return false;
+    }
+
+    const JsValue entryValue = JsParseStream(stream);
+    if (!entryValue.IsObject()) {
+        return false;
+    }
+
+    const JsObject& entry = entryValue.GetJsObject();
+    auto            getValue = [&entry](const char* name) -> const JsValue* {
+        const auto it = entry.find(name);
+        return it != entry.end() ? &it->second : nullptr;
+    };
+
+    const JsValue* entryKey = getValue("key");
+    const JsValue* name = getValue("name");
+    const JsValue* source = getValue("source");
+    const JsValue* pathInputMap = getValue("pathInputMap");
+    const JsValue* usesNormals = getValue("usesNormals");
+    if (!entryKey || !entryKey->IsString() || entryKey->GetString() != key || !name
+        || !name->IsString() || !source || !source->IsString() || !pathInputMap
+        || !pathInputMap->IsObject() || !usesNormals || !usesNormals->IsBool()) {
+        return false;
+    }
+
+    fragment.pathInputMap.clear();
+    for (const auto& pathInput : pathInputMap->GetJsObject()) {
+        if (!pathInput.second.IsString()) {
+            return false;
+        }
+        fragment.pathInputMap[pathInput.first] = pathInput.second.GetString();
+    }
+    fragment.name = name->GetString();
+    fragment.source = source->GetString();
+    fragment.usesNormals = usesNormals->GetBool();
+
+    // Mark the entry as recently used, so that it is not pruned.
+    std::error_code ec;
+    ghc::filesystem::last_write_time(entryPath, ghc::filesystem::file_time_type::clock::now(), ec);
+    return true;
+}
+
+void _MaterialXFragmentDiskCache::Save(
+    const std::string&        key,
+    const _MaterialXFragment& fragment) const
+{
+    if (_directory.empty()) {
+        return;
+    }
+
+    std::error_code ec;
+    ghc::filesystem::create_directories(_directory, ec);
+    if (ec) {
+        return;
+    }
+
+    JsObject pathInputMap;
+    for (const auto& pathInput : fragment.pathInputMap) {
+        pathInputMap[pathInput.first] = JsValue(pathInput.second);
+    }
+
+    JsObject entry;
+    entry["key"] = JsValue(key);
+    entry["name"] = JsValue(fragment.name);
+    entry["source"] = JsValue(fragment.source);
+    entry["pathInputMap"] = JsValue(pathInputMap);
+    entry["usesNormals"] = JsValue(fragment.usesNormals);
+
+    // Unique temporary file name, since other threads or sessions may save the same entry.
+    const ghc::filesystem::path entryPath = _GetEntryPath(key);
+    ghc::filesystem::path       tmpPath = entryPath;
+    tmpPath += "." + std::to_string(std::hash<std::thread::id>()(std::this_thread::get_id()))
+        + "." + std::to_string(std::chrono::steady_clock::now().time_since_epoch().count())
+        + ".tmp";
+
+    {
+        std::ofstream stream(tmpPath.string(), std::ios::binary);
+        if (stream) {
+            JsWriteToStream(JsValue(entry), stream);
+        }
+        if (!stream) {
+            ghc::filesystem::remove(tmpPath, ec);
+            return;
+        }
+    }
+
+    ghc::filesystem::rename(tmpPath, entryPath, ec);
+    if (ec) {
+        ghc::filesystem::remove(tmpPath, ec);
+    }
+}
+
 //! Return true if that node parameter has topological impact on the generated code.
 //
 // Swizzle and geompropvalue nodes are known to have an attribute that affects
@@ -921,6 +1225,129 @@ void _AddMissingTangents(mx::DocumentPtr& mtlxDoc)
     }
 }
 
+/*! \brief  Generates the OGS fragment of a MaterialX network fixed by _ApplyMtlxVP2Fixes().
+
+    Does not call into Maya, so it can run outside of the main thread. The primary UV set name
+    of the OgsXmlGenerator must be set by the caller. MaterialX errors are raised as exceptions.
+*/
+bool _GenerateMaterialXFragment(
+    const SdfPath&                                         materialId,
+    const HdMaterialNetwork2&                              fixedNetwork,
+    const MaterialXMaya::OgsFragment::SpecularEnvironment& specularEnvironment,
+    _MaterialXFragment&                                    fragment)
+{
+    const auto terminalIt = fixedNetwork.terminals.find(HdMaterialTerminalTokens->surface);
+    if (terminalIt == fixedNetwork.terminals.end()) {
+        return false;
+    }
+    const SdfPath& fixedPath = terminalIt->second.upstreamNode;
+    const auto     surfTerminalIt = fixedNetwork.nodes.find(fixedPath);
+    if (surfTerminalIt == fixedNetwork.nodes.end()) {
+        return false;
+    }
+    const HdMaterialNode2& surfTerminal = surfTerminalIt->second;
+
+    // Check if the Terminal is a MaterialX Node
+    SdrRegistry&                sdrRegistry = SdrRegistry::GetInstance();
+    const SdrShaderNodeConstPtr mtlxSdrNode = sdrRegistry.GetShaderNodeByIdentifierAndType(
+        surfTerminal.nodeTypeId, HdVP2Tokens->mtlx);
+    if (!mtlxSdrNode) {
+        return false;
+    }
+
+#ifdef HAS_COLOR_MANAGEMENT_SUPPORT_API
+    mx::DocumentPtr completeLibrary = mx::createDocument();
+    completeLibrary->importLibrary(_GetMaterialXData()._mtlxLibrary);
+    completeLibrary->importLibrary(MaterialXMaya::OgsFragment::getOCIOLibrary());
+#else
+    mx::DocumentPtr completeLibrary = _GetMaterialXData()._mtlxLibrary;
+#endif
+
+    // Create the MaterialX Document from the HdMaterialNetwork
+#if PXR_VERSION > 2111
+    mx::DocumentPtr mtlxDoc = HdMtlxCreateMtlxDocumentFromHdNetwork(
+        fixedNetwork,
+        surfTerminal, // MaterialX HdNode
+        fixedPath,
+        SdfPath(_mtlxTokens->USD_Mtlx_VP2_Material),
+        completeLibrary);
+#else
+    std::set<SdfPath> hdTextureNodes;
+    mx::StringMap     mxHdTextureMap; // Mx-Hd texture name counterparts
+    mx::DocumentPtr   mtlxDoc = HdMtlxCreateMtlxDocumentFromHdNetwork(
+        fixedNetwork,
+        surfTerminal, // MaterialX HdNode
+        SdfPath(_mtlxTokens->USD_Mtlx_VP2_Material),
+        completeLibrary,
+        &hdTextureNodes,
+        &mxHdTextureMap);
+#endif
+
+    if (!mtlxDoc) {
+        return false;
+    }
+
+    // Touchups required to fix input stream issues:
+    _AddMissingTangents(mtlxDoc);
+
+    if (TfDebug::IsEnabled(HDVP2_DEBUG_MATERIAL)) {
+        std::ostringstream debugStream;
+        debugStream << "generated shader code for " << materialId.GetText() << ":\n";
+        debugStream << "Generated graph\n==============================\n";
+        mx::writeToXmlStream(mtlxDoc, debugStream);
+        debugStream << "\n==============================\n";
+        std::cout << debugStream.str();
+    }
+
+    mx::NodePtr materialNode;
+    for (const mx::NodePtr& material : mtlxDoc->getMaterialNodes()) {
+        if (material->getName() == _mtlxTokens->USD_Mtlx_VP2_Material.GetText()) {
+            materialNode = material;
+        }
+    }
+
+    if (!materialNode) {
+        return false;
+    }
+
+    MaterialXMaya::OgsFragment ogsFragment(
+        materialNode, _GetMaterialXData()._mtlxSearchPath, specularEnvironment);
+
+    fragment.name = ogsFragment.getFragmentName();
+    fragment.source = ogsFragment.getFragmentSource();
+    fragment.pathInputMap = ogsFragment.getPathInputMap();
+
+    // Explore the fragment for primvars:
+    mx::ShaderPtr            shader = ogsFragment.getShader();
+    const mx::VariableBlock& vertexInputs
+        = shader->getStage(mx::Stage::VERTEX).getInputBlock(mx::HW::VERTEX_INPUTS);
+    for (size_t i = 0; i < vertexInputs.size(); ++i) {
+        const mx::ShaderPort* variable = vertexInputs[i];
+        // Position is always assumed.
+        // Tangent will be generated in the vertex shader using a utility fragment
+        if (variable->getName() == mx::HW::T_IN_NORMAL) {
+            fragment.usesNormals = true;
+        }
+    }
+    return true;
+}
+
+//! Fragments generated ahead of the sync of the materials, by disk cache key. Only accessed
+//! from the main thread.
+std::unordered_map<std::string, _MaterialXFragment> _preparedMaterialXFragments;
+
+//! Moves the fragment prepared for the key out of the prepared fragments, if any.
+bool _TakePreparedMaterialXFragment(const std::string& key, _MaterialXFragment& fragment)
+{
+    const auto it = _preparedMaterialXFragments.find(key);
+    if (it == _preparedMaterialXFragments.end()) {
+        return false;
+    }
+    fragment = std::move(it->second);
+    _preparedMaterialXFragments.erase(it);
+    return true;
+}
+
 #endif // WANT_MATERIALX_BUILD
 
 #if PXR_VERSION <= 2211
@@ -1435,8 +1862,30 @@ MHWRender::MSamplerStateDesc _GetSamplerStateDesc(const HdMaterialNode& node)
     return desc;
 }
 
-MHWRender::MTexture*
-_LoadUdimTexture(const std::string& path, bool& isColorSpaceSRGB, MFloatArray& uvScaleOffset)
+//! Image data decoded on the CPU, ready to be uploaded to VP2 by _UploadTexture().
+struct _DecodedTexture
+{
+    //! False if the image could not be opened, in which case the fallback color is used.
+    bool isOpened { false };
+    bool isColorSpaceSRGB { false };
+
+    //! Description and texels of a regular texture. The texels are empty if the image
+    //! could not be read or has an unsupported format.
+    MHWRender::MTextureDescription desc;
+    std::vector<unsigned char>     texels;
+
+    //! Tile ids and paths of a UDIM texture, empty if a tile is missing or unreadable.
+    //! VP2 reads the tiles itself to combine them into a single texture.
+    std::vector<std::tuple<int, TfToken>> udimTiles;
+    unsigned int                          udimTileWidth { 0 };
+    unsigned int                          udimTileHeight { 0 };
+
+    size_t GetMemorySize() const { return texels.size(); }
+};
+
+//! Find and validate the tiles of the UDIM texture at the specified path. Every tile is
+//! opened once.
+_DecodedTexture _DecodeUdimTexture(const std::string& path)
 {
     /*
         For this method to work path needs to be an absolute file path, not an asset path.
@@ -1447,30 +1896,8 @@ _LoadUdimTexture(const std::string& path, bool& isColorSpaceSRGB, MFloatArray& u
 
         https://github.com/PixarAnimationStudios/USD/commit/4e42656543f4e3a313ce31a81c27477d4dcb64b9
     */
-
-    // test for a UDIM texture
-    if (!HdStIsSupportedUdimTexture(path))
-        return nullptr;
-
-    /*
-        Maya's tiled texture support is implemented quite differently from Usd's UDIM support.
-        In Maya the texture tiles get combined into a single big texture, downscaling each tile
-        if necessary, and filling in empty regions of a non-square tile with the undefined color.
-
-        In USD the UDIM textures are stored in a texture array that the shader uses to draw.
-    */
-
-    MHWRender::MRenderer* const       renderer = MHWRender::MRenderer::theRenderer();
-    MHWRender::MTextureManager* const textureMgr
-        = renderer ? renderer->getTextureManager() : nullptr;
-    if (!TF_VERIFY(textureMgr)) {
-        return nullptr;
-    }
-
-    MHWRender::MTexture* texture = textureMgr->findTexture(path.c_str());
-    if (texture) {
-        return texture;
-    }
+    _DecodedTexture decoded;
+    decoded.isOpened = true;
 
     // HdSt sets the tile limit to the max number of textures in an array of 2d textures. OpenGL
     // says the minimum number of layers in 2048 so I'll use that.
@@ -1478,146 +1905,55 @@ _LoadUdimTexture(const std::string& path, bool& isColorSpaceSRGB, MFloatArray& u
     std::vector<std::tuple<int, TfToken>> tiles = UsdImaging_GetUdimTiles(path, tileLimit);
     if (tiles.size() == 0) {
         TF_WARN("Unable to find UDIM tiles for %s", path.c_str());
-        return nullptr;
+        return decoded;
     }
 
-    // I don't think there is a downside to setting a very high limit.
-    // Maya will clamp the texture size to the VP2 texture clamp resolution and the hardware's
-    // max texture size. And Maya doesn't make the tiled texture unnecessarily large. When I
-    // try loading two 1k textures I end up with a tiled texture that is 2k x 1k.
-    unsigned int maxWidth = 0;
-    unsigned int maxHeight = 0;
-    renderer->GPUmaximumOutputTargetSize(maxWidth, maxHeight);
-
-    // Open the first image and get it's resolution. Assuming that all the tiles have the same
-    // resolution, warn the user if Maya's tiled texture implementation is going to result in
-    // a loss of texture data.
-    {
-        HioImageSharedPtr image = HioImage::OpenForReading(std::get<1>(tiles[0]).GetString());
+    for (size_t i = 0; i < tiles.size(); ++i) {
+        const TfToken&    tilePath = std::get<1>(tiles[i]);
+        HioImageSharedPtr image = HioImage::OpenForReading(tilePath.GetString());
         if (!TF_VERIFY(image)) {
-            return nullptr;
+            return decoded;
         }
-        isColorSpaceSRGB = image->IsColorSpaceSRGB();
-        unsigned int tileWidth = image->GetWidth();
-        unsigned int tileHeight = image->GetHeight();
 
-        int maxTileId = std::get<0>(tiles.back());
-        int maxU = maxTileId % 10;
-        int maxV = (maxTileId - maxU) / 10;
-        if ((tileWidth * maxU > maxWidth) || (tileHeight * maxV > maxHeight))
-            TF_WARN(
-                "UDIM texture %s creates a tiled texture larger than the maximum texture size. Some"
-                "resolution will be lost.",
-                path.c_str());
-    }
-
-    MString textureName(
-        path.c_str()); // used for caching, using the string with <UDIM> in it is fine
-    MStringArray tilePaths;
-    MFloatArray  tilePositions;
-    for (auto& tile : tiles) {
-        tilePaths.append(MString(std::get<1>(tile).GetText()));
-
-        HioImageSharedPtr image = HioImage::OpenForReading(std::get<1>(tile).GetString());
-        if (!TF_VERIFY(image)) {
-            return nullptr;
-        }
-        if (isColorSpaceSRGB != image->IsColorSpaceSRGB()) {
+        // Assume that all the tiles have the resolution of the first one.
+        if (i == 0) {
+            decoded.isColorSpaceSRGB = image->IsColorSpaceSRGB();
+            decoded.udimTileWidth = image->GetWidth();
+            decoded.udimTileHeight = image->GetHeight();
+        } else if (decoded.isColorSpaceSRGB != image->IsColorSpaceSRGB()) {
             TF_WARN(
                 "UDIM texture %s color space doesn't match %s color space",
-                std::get<1>(tile).GetText(),
+                tilePath.GetText(),
                 std::get<1>(tiles[0]).GetText());
         }
-
-        // The image labeled 1001 will have id 0, 1002 will have id 1, 1011 will have id 10.
-        // image 1001 starts with UV (0.0f, 0.0f), 1002 is (1.0f, 0.0f) and 1011 is (0.0f, 1.0f)
-        int   tileId = std::get<0>(tile);
-        float u = (float)(tileId % 10);
-        float v = (float)((tileId - u) / 10);
-        tilePositions.append(u);
-        tilePositions.append(v);
-    }
-
-    MColor       undefinedColor(0.0f, 1.0f, 0.0f, 1.0f);
-    MStringArray failedTilePaths;
-    texture = textureMgr->acquireTiledTexture(
-        textureName,
-        tilePaths,
-        tilePositions,
-        undefinedColor,
-        maxWidth,
-        maxHeight,
-        failedTilePaths,
-        uvScaleOffset);
-
-    for (unsigned int i = 0; i < failedTilePaths.length(); i++) {
-        TF_WARN("Failed to load <UDIM> texture tile %s", failedTilePaths[i].asChar());
     }
 
-    return texture;
+    decoded.udimTiles = std::move(tiles);
+    return decoded;
 }
 
-MHWRender::MTexture* _GenerateFallbackTexture(
-    MHWRender::MTextureManager* const textureMgr,
-    const std::string&                path,
-    const GfVec4f&                    fallbackColor)
-{
-    MHWRender::MTexture* texture = textureMgr->findTexture(path.c_str());
-    if (texture) {
-        return texture;
-    }
-
-    MHWRender::MTextureDescription desc;
-    desc.setToDefault2DTexture();
-    desc.fWidth = 1;
-    desc.fHeight = 1;
-    desc.fFormat = MHWRender::kR8G8B8A8_UNORM;
-    desc.fBytesPerRow = 4;
-    desc.fBytesPerSlice = desc.fBytesPerRow;
-
-    std::vector<unsigned char> texels(4);
-    for (size_t i = 0; i < 4; ++i) {
-        float texelValue = GfClamp(fallbackColor[i], 0.0f, 1.0f);
-        texels[i] = static_cast<unsigned char>(texelValue * 255.0);
-    }
-    return textureMgr->acquireTexture(path.c_str(), desc, texels.data());
-}
-
-//! Load texture from the specified path
-MHWRender::MTexture* _LoadTexture(
-    const std::string& path,
-    bool               hasFallbackColor,
-    const GfVec4f&     fallbackColor,
-    bool&              isColorSpaceSRGB,
-    MFloatArray&       uvScaleOffset)
+//! Read the image at the specified path and convert its texels to a format supported by VP2.
+//! Does not use any VP2 or OpenGL API, so that it can run on any thread.
+_DecodedTexture _DecodeTexture(const std::string& path)
 {
     MProfilingScope profilingScope(
-        HdVP2RenderDelegate::sProfilerCategory, MProfiler::kColorD_L2, "LoadTexture", path.c_str());
+        HdVP2RenderDelegate::sProfilerCategory,
+        MProfiler::kColorD_L2,
+        "DecodeTexture",
+        path.c_str());
 
     // If it is a UDIM texture we need to modify the path before calling OpenForReading
-    if (HdStIsSupportedUdimTexture(path))
-        return _LoadUdimTexture(path, isColorSpaceSRGB, uvScaleOffset);
-
-    MHWRender::MRenderer* const       renderer = MHWRender::MRenderer::theRenderer();
-    MHWRender::MTextureManager* const textureMgr
-        = renderer ? renderer->getTextureManager() : nullptr;
-    if (!TF_VERIFY(textureMgr)) {
-        return nullptr;
+    if (HdStIsSupportedUdimTexture(path)) {
+        return _DecodeUdimTexture(path);
     }
 
-    MHWRender::MTexture* texture = textureMgr->findTexture(path.c_str());
-    if (texture) {
-        return texture;
-    }
+    _DecodedTexture decoded;
 
     HioImageSharedPtr image = HioImage::OpenForReading(path);
     if (!TF_VERIFY(image, "Unable to create an image from %s", path.c_str())) {
-        if (!hasFallbackColor) {
-            return nullptr;
-        }
-        // Create a 1x1 texture of the fallback color, if it was specified:
-        return _GenerateFallbackTexture(textureMgr, path, fallbackColor);
+        return decoded;
     }
+    decoded.isOpened = true;
 
     // This image is used for loading pixel data from usdz only and should
     // not trigger any OpenGL call. VP2RenderDelegate will transfer the
@@ -1637,16 +1973,18 @@ MHWRender::MTexture* _LoadTexture(
     spec.data = storage.data();
 
     if (!image->Read(spec)) {
-        return nullptr;
+        return decoded;
     }
 
-    MHWRender::MTextureDescription desc;
+    MHWRender::MTextureDescription& desc = decoded.desc;
     desc.setToDefault2DTexture();
     desc.fWidth = spec.width;
     desc.fHeight = spec.height;
     desc.fBytesPerRow = bytesPerRow;
     desc.fBytesPerSlice = bytesPerSlice;
 
+    std::vector<unsigned char>& texels = decoded.texels;
+
     auto specFormat = spec.format;
     switch (specFormat) {
     // Single Channel
@@ -1658,7 +1996,7 @@ MHWRender::MTexture* _LoadTexture(
         desc.fBytesPerRow = spec.width * bpp_RGB32;
         desc.fBytesPerSlice = desc.fBytesPerRow * spec.height;
 
-        std::vector<unsigned char> texels(desc.fBytesPerSlice);
+        texels.resize(desc.fBytesPerSlice);
 
         uint32_t* texels32 = (uint32_t*)texels.data();
         uint32_t* storage32 = (uint32_t*)storage.data();
@@ -1669,8 +2007,6 @@ MHWRender::MTexture* _LoadTexture(
             *texels32++ = pixel;
             *texels32++ = pixel;
         }
-
-        texture = textureMgr->acquireTexture(path.c_str(), desc, texels.data());
     } break;
     case HioFormatFloat16: {
         // We want white instead or red when expanding to RGB, so convert to kR16G16B16A16_FLOAT
@@ -1680,7 +2016,7 @@ MHWRender::MTexture* _LoadTexture(
         desc.fBytesPerRow = spec.width * bpp_8;
         desc.fBytesPerSlice = desc.fBytesPerRow * spec.height;
 
-        std::vector<unsigned char> texels(desc.fBytesPerSlice);
+        texels.resize(desc.fBytesPerSlice);
 
         GfHalf         opaqueAlpha(1.0f);
         const uint16_t alphaBits = opaqueAlpha.bits();
@@ -1695,8 +2031,6 @@ MHWRender::MTexture* _LoadTexture(
             *texels16++ = pixel;
             *texels16++ = alphaBits;
         }
-
-        texture = textureMgr->acquireTexture(path.c_str(), desc, texels.data());
     } break;
     case HioFormatUNorm8: {
         // We want white instead or red when expanding to RGB, so convert to kR8G8B8A8_UNORM
@@ -1706,7 +2040,7 @@ MHWRender::MTexture* _LoadTexture(
         desc.fBytesPerRow = spec.width * bpp_4;
         desc.fBytesPerSlice = desc.fBytesPerRow * spec.height;
 
-        std::vector<unsigned char> texels(desc.fBytesPerSlice);
+        texels.resize(desc.fBytesPerSlice);
 
         uint8_t* texels8 = (uint8_t*)texels.data();
         uint8_t* storage8 = (uint8_t*)storage.data();
@@ -1719,8 +2053,7 @@ MHWRender::MTexture* _LoadTexture(
             *texels8++ = 0xFF;
         }
 
-        texture = textureMgr->acquireTexture(path.c_str(), desc, texels.data());
-        isColorSpaceSRGB = image->IsColorSpaceSRGB();
+        decoded.isColorSpaceSRGB = image->IsColorSpaceSRGB();
     } break;
 
     // Dual channel (quite rare, but seen with mono + alpha files)
@@ -1732,7 +2065,7 @@ MHWRender::MTexture* _LoadTexture(
         desc.fBytesPerRow = spec.width * bpp_RGBA32;
         desc.fBytesPerSlice = desc.fBytesPerRow * spec.height;
 
-        std::vector<unsigned char> texels(desc.fBytesPerSlice);
+        texels.resize(desc.fBytesPerSlice);
 
         uint32_t* texels32 = (uint32_t*)texels.data();
         uint32_t* storage32 = (uint32_t*)storage.data();
@@ -1744,8 +2077,6 @@ MHWRender::MTexture* _LoadTexture(
             *texels32++ = pixel;
             *texels32++ = *storage32++;
         }
-
-        texture = textureMgr->acquireTexture(path.c_str(), desc, texels.data());
     } break;
     case HioFormatFloat16Vec2: {
         // R16G16 is not supported by VP2. Converted to R16G16B16A16.
@@ -1755,7 +2086,7 @@ MHWRender::MTexture* _LoadTexture(
         desc.fBytesPerRow = spec.width * bpp_8;
         desc.fBytesPerSlice = desc.fBytesPerRow * spec.height;
 
-        std::vector<unsigned char> texels(desc.fBytesPerSlice);
+        texels.resize(desc.fBytesPerSlice);
 
         uint16_t* texels16 = (uint16_t*)texels.data();
         uint16_t* storage16 = (uint16_t*)storage.data();
@@ -1767,8 +2098,6 @@ MHWRender::MTexture* _LoadTexture(
             *texels16++ = pixel;
             *texels16++ = *storage16++;
         }
-
-        texture = textureMgr->acquireTexture(path.c_str(), desc, texels.data());
         break;
     }
     case HioFormatUNorm8Vec2:
@@ -1780,7 +2109,7 @@ MHWRender::MTexture* _LoadTexture(
         desc.fBytesPerRow = spec.width * bpp_4;
         desc.fBytesPerSlice = desc.fBytesPerRow * spec.height;
 
-        std::vector<unsigned char> texels(desc.fBytesPerSlice);
+        texels.resize(desc.fBytesPerSlice);
 
         uint8_t* texels8 = (uint8_t*)texels.data();
         uint8_t* storage8 = (uint8_t*)storage.data();
@@ -1793,15 +2122,14 @@ MHWRender::MTexture* _LoadTexture(
             *texels8++ = *storage8++;
         }
 
-        texture = textureMgr->acquireTexture(path.c_str(), desc, texels.data());
-        isColorSpaceSRGB = image->IsColorSpaceSRGB();
+        decoded.isColorSpaceSRGB = image->IsColorSpaceSRGB();
         break;
     }
 
     // 3-Channel
     case HioFormatFloat32Vec3:
         desc.fFormat = MHWRender::kR32G32B32_FLOAT;
-        texture = textureMgr->acquireTexture(path.c_str(), desc, spec.data);
+        texels = std::move(storage);
         break;
     case HioFormatFloat16Vec3: {
         // R16G16B16 is not supported by VP2. Converted to R16G16B16A16.
@@ -1816,7 +2144,7 @@ MHWRender::MTexture* _LoadTexture(
         const unsigned char  lowAlpha = reinterpret_cast<const unsigned char*>(&alphaBits)[0];
         const unsigned char  highAlpha = reinterpret_cast<const unsigned char*>(&alphaBits)[1];
 
-        std::vector<unsigned char> texels(desc.fBytesPerSlice);
+        texels.resize(desc.fBytesPerSlice);
 
         for (int y = 0; y < spec.height; y++) {
             for (int x = 0; x < spec.width; x++) {
@@ -1831,13 +2159,11 @@ MHWRender::MTexture* _LoadTexture(
                 texels[t * bpp_8 + 7] = highAlpha;
             }
         }
-
-        texture = textureMgr->acquireTexture(path.c_str(), desc, texels.data());
         break;
     }
     case HioFormatFloat16Vec4:
         desc.fFormat = MHWRender::kR16G16B16A16_FLOAT;
-        texture = textureMgr->acquireTexture(path.c_str(), desc, spec.data);
+        texels = std::move(storage);
         break;
     case HioFormatUNorm8Vec3:
     case HioFormatUNorm8Vec3srgb: {
@@ -1848,7 +2174,7 @@ MHWRender::MTexture* _LoadTexture(
         desc.fBytesPerRow = spec.width * bpp_4;
         desc.fBytesPerSlice = desc.fBytesPerRow * spec.height;
 
-        std::vector<unsigned char> texels(desc.fBytesPerSlice);
+        texels.resize(desc.fBytesPerSlice);
 
         for (int y = 0; y < spec.height; y++) {
             for (int x = 0; x < spec.width; x++) {
@@ -1860,21 +2186,20 @@ MHWRender::MTexture* _LoadTexture(
             }
         }
 
-        texture = textureMgr->acquireTexture(path.c_str(), desc, texels.data());
-        isColorSpaceSRGB = image->IsColorSpaceSRGB();
+        decoded.isColorSpaceSRGB = image->IsColorSpaceSRGB();
         break;
     }
 
     // 4-Channel
     case HioFormatFloat32Vec4:
         desc.fFormat = MHWRender::kR32G32B32A32_FLOAT;
-        texture = textureMgr->acquireTexture(path.c_str(), desc, spec.data);
+        texels = std::move(storage);
         break;
     case HioFormatUNorm8Vec4:
     case HioFormatUNorm8Vec4srgb:
         desc.fFormat = MHWRender::kR8G8B8A8_UNORM;
-        isColorSpaceSRGB = image->IsColorSpaceSRGB();
-        texture = textureMgr->acquireTexture(path.c_str(), desc, spec.data);
+        decoded.isColorSpaceSRGB = image->IsColorSpaceSRGB();
+        texels = std::move(storage);
         break;
     default:
         TF_WARN(
@@ -1884,7 +2209,187 @@ MHWRender::MTexture* _LoadTexture(
         break;
     }
 
-    return texture;
+    return decoded;
+}
+
+MHWRender::MTexture* _UploadUdimTexture(
+    MHWRender::MRenderer* const       renderer,
+    MHWRender::MTextureManager* const textureMgr,
+    const std::string&                path,
+    const _DecodedTexture&            decoded,
+    MFloatArray&                      uvScaleOffset)
+{
+    /*
+        Maya's tiled texture support is implemented quite differently from Usd's UDIM support.
+        In Maya the texture tiles get combined into a single big texture, downscaling each tile
+        if necessary, and filling in empty regions of a non-square tile with the undefined color.
+
+        In USD the UDIM textures are stored in a texture array that the shader uses to draw.
+    */
+    const std::vector<std::tuple<int, TfToken>>& tiles = decoded.udimTiles;
+    if (tiles.empty()) {
+        return nullptr;
+    }
+
+    // I don't think there is a downside to setting a very high limit.
+    // Maya will clamp the texture size to the VP2 texture clamp resolution and the hardware's
+    // max texture size. And Maya doesn't make the tiled texture unnecessarily large. When I
+    // try loading two 1k textures I end up with a tiled texture that is 2k x 1k.
+    unsigned int maxWidth = 0;
+    unsigned int maxHeight = 0;
+    renderer->GPUmaximumOutputTargetSize(maxWidth, maxHeight);
+
+    // Warn the user if Maya's tiled texture implementation is going to result in a loss of
+    // texture data.
+    int maxTileId = std::get<0>(tiles.back());
+    int maxU = maxTileId % 10;
+    int maxV = (maxTileId - maxU) / 10;
+    if ((decoded.udimTileWidth * maxU > maxWidth) || (decoded.udimTileHeight * maxV > maxHeight))
+        TF_WARN(
+            "UDIM texture %s creates a tiled texture larger than the maximum texture size. Some"
+            "resolution will be lost.",
+            path.c_str());
+
+    MString textureName(
+        path.c_str()); // used for caching, using the string with <UDIM> in it is fine
+    MStringArray tilePaths;
+    MFloatArray  tilePositions;
+    for (auto& tile : tiles) {
+        tilePaths.append(MString(std::get<1>(tile).GetText()));
+
+        // The image labeled 1001 will have id 0, 1002 will have id 1, 1011 will have id 10.
+        // image 1001 starts with UV (0.0f, 0.0f), 1002 is (1.0f, 0.0f) and 1011 is (0.0f, 1.0f)
+        int   tileId = std::get<0>(tile);
+        float u = (float)(tileId % 10);
+        float v = (float)((tileId - u) / 10);
+        tilePositions.append(u);
+        tilePositions.append(v);
+    }
+
+    MColor       undefinedColor(0.0f, 1.0f, 0.0f, 1.0f);
+    MStringArray failedTilePaths;
+    MHWRender::MTexture* texture = textureMgr->acquireTiledTexture(
+        textureName,
+        tilePaths,
+        tilePositions,
+        undefinedColor,
+        maxWidth,
+        maxHeight,
+        failedTilePaths,
+        uvScaleOffset);
+
+    for (unsigned int i = 0; i < failedTilePaths.length(); i++) {
+        TF_WARN("Failed to load <UDIM> texture tile %s", failedTilePaths[i].asChar());
+    }
+
+    return texture;
+}
+
+MHWRender::MTexture* _GenerateFallbackTexture(
+    MHWRender::MTextureManager* const textureMgr,
+    const std::string&                path,
+    const GfVec4f&                    fallbackColor)
+{
+    MHWRender::MTexture* texture = textureMgr->findTexture(path.c_str());
+    if (texture) {
+        return texture;
+    }
+
+    MHWRender::MTextureDescription desc;
+    desc.setToDefault2DTexture();
+    desc.fWidth = 1;
+    desc.fHeight = 1;
+    desc.fFormat = MHWRender::kR8G8B8A8_UNORM;
+    desc.fBytesPerRow = 4;
+    desc.fBytesPerSlice = desc.fBytesPerRow;
+
+    std::vector<unsigned char> texels(4);
+    for (size_t i = 0; i < 4; ++i) {
+        float texelValue = GfClamp(fallbackColor[i], 0.0f, 1.0f);
+        texels[i] = static_cast<unsigned char>(texelValue * 255.0);
+    }
+    return textureMgr->acquireTexture(path.c_str(), desc, texels.data());
+}
+
+//! Create the VP2 texture of the specified path from its decoded image. Must be called on the
+//! main thread.
+MHWRender::MTexture* _UploadTexture(
+    const std::string&     path,
+    const _DecodedTexture& decoded,
+    bool                   hasFallbackColor,
+    const GfVec4f&         fallbackColor,
+    bool&                  isColorSpaceSRGB,
+    MFloatArray&           uvScaleOffset)
+{
+    MProfilingScope profilingScope(
+        HdVP2RenderDelegate::sProfilerCategory,
+        MProfiler::kColorD_L2,
+        "UploadTexture",
+        path.c_str());
+
+    MHWRender::MRenderer* const       renderer = MHWRender::MRenderer::theRenderer();
+    MHWRender::MTextureManager* const textureMgr
+        = renderer ? renderer->getTextureManager() : nullptr;
+    if (!TF_VERIFY(textureMgr)) {
+        return nullptr;
+    }
+
+    MHWRender::MTexture* texture = textureMgr->findTexture(path.c_str());
+    if (texture) {
+        return texture;
+    }
+
+    if (!decoded.isOpened) {
+        if (!hasFallbackColor) {
+            return nullptr;
+        }
+        // Create a 1x1 texture of the fallback color, if it was specified:
+        return _GenerateFallbackTexture(textureMgr, path, fallbackColor);
+    }
+
+    isColorSpaceSRGB = decoded.isColorSpaceSRGB;
+
+    if (HdStIsSupportedUdimTexture(path)) {
+        return _UploadUdimTexture(renderer, textureMgr, path, decoded, uvScaleOffset);
+    }
+
+    if (decoded.texels.empty()) {
+        return nullptr;
+    }
+
+    return textureMgr->acquireTexture(path.c_str(), decoded.desc, decoded.texels.data());
+}
+
+//! Load texture from the specified path
+MHWRender::MTexture* _LoadTexture(
+    const std::string& path,
+    bool               hasFallbackColor,
+    const GfVec4f&     fallbackColor,
+    bool&              isColorSpaceSRGB,
+    MFloatArray&       uvScaleOffset)
+{
+    MProfilingScope profilingScope(
+        HdVP2RenderDelegate::sProfilerCategory, MProfiler::kColorD_L2, "LoadTexture", path.c_str());
+
+    MHWRender::MRenderer* const       renderer = MHWRender::MRenderer::theRenderer();
+    MHWRender::MTextureManager* const textureMgr
+        = renderer ? renderer->getTextureManager() : nullptr;
+    if (!TF_VERIFY(textureMgr)) {
+        return nullptr;
+    }
+
+    MHWRender::MTexture* texture = textureMgr->findTexture(path.c_str());
+    if (texture) {
+        return texture;
+    }
+
+    return _UploadTexture(
+        path,
+        _DecodeTexture(path),
+        hasFallbackColor,
+        fallbackColor,
+        isColorSpaceSRGB,
+        uvScaleOffset);
 }
 
 TfToken MayaDescriptorToToken(const MVertexBufferDescriptor& descriptor)
@@ -1919,6 +2424,70 @@ struct MStringHash
     }
 };
 
+/*! \brief  Decodes the images of the asynchronous texture loading tasks on worker threads,
+            most important first, and uploads them to VP2 on idle on the main thread.
+
+    Tasks loading the same path share a single decoding, with the highest priority of the
+    tasks. Decoding pauses while the decoded images waiting to be uploaded use more memory
+    than MAYAUSD_VP2_TEXTURE_DECODING_BUDGET_MB, so this budget can be exceeded by at most
+    one image per worker thread. Each idle upload takes about kUploadTimeSlice at most, apart
+    from the upload of a single large image.
+*/
+class _TextureDecodingQueue
+{
+public:
+    using TaskPtr = std::shared_ptr<HdVP2Material::TextureLoadingTask>;
+
+    static _TextureDecodingQueue& GetInstance()
+    {
+        static _TextureDecodingQueue sInstance;
+        return sInstance;
+    }
+
+    //! Queue the texture of the task for decoding, or move it to the priority of the task if
+    //! it is already queued. Can be called from any thread.
+    void Enqueue(const std::string& path, const TaskPtr& task);
+
+    //! Move the texture to the priority of its tasks if it is still queued. Can be called
+    //! from any thread.
+    void UpdatePriority(const std::string& path);
+
+    //! Stop decoding and drop the pending tasks.
+    void OnMayaExit();
+
+private:
+    struct _Job
+    {
+        std::string          path;
+        std::vector<TaskPtr> tasks;
+        _DecodedTexture      decoded;
+    };
+    using _JobPtr = std::shared_ptr<_Job>;
+
+    _TextureDecodingQueue() = default;
+    ~_TextureDecodingQueue() = default;
+
+    bool _IsOverBudget() const;
+    void _StartDecoders();
+    void _ScheduleUpload();
+    void _Decode();
+    void _Upload();
+
+    static bool _HasPendingTask(const _Job& job);
+    static int  _GetPriority(const _Job& job);
+
+    std::mutex                               _mutex;
+    std::condition_variable                  _decodedCondition;
+    std::unordered_map<std::string, _JobPtr> _jobs;        //!< Jobs not uploaded yet, by path
+    HdVP2TextureLoadingQueue                 _queuedJobs;  //!< Paths of the jobs to decode
+    std::deque<_JobPtr>                      _decodedJobs; //!< Jobs waiting to be uploaded
+    size_t                                   _decodedBytes { 0 };
+    size_t                                   _decoderCount { 0 };
+    bool                                     _isUploadScheduled { false };
+    bool                                     _isExiting { false };
+    WorkDispatcher                           _dispatcher;
+};
+
 } // anonymous namespace
 
 class HdVP2Material::TextureLoadingTask
@@ -1959,58 +2528,252 @@ public:
         return _fallbackTextureInfo;
     }
 
-    bool EnqueueLoadOnIdle()
+    //! Raise the priority of the task. Returns the previous priority, which is negative if
+    //! the task was never queued.
+    int RaisePriority(int priority)
     {
-        if (_started.exchange(true)) {
-            return false;
-        }
-        // Push the texture loading on idle
-        auto ret = MGlobal::executeTaskOnIdle(
-            [](void* data) {
-                auto* task = static_cast<HdVP2Material::TextureLoadingTask*>(data);
-                task->_Load();
-                // Once it is done, free the memory.
-                delete task;
-            },
-            this);
-        return ret == MStatus::kSuccess;
+        int current = _priority.load();
+        while (current < priority && !_priority.compare_exchange_weak(current, priority)) { }
+        return current;
     }
 
-    bool Terminate()
+    //! Change the priority of the task if it was queued. Returns whether it changed.
+    bool ChangePriority(int priority)
     {
-        _terminated = true;
-        // Return the started state to caller, the caller will delete this object
-        // if this task has not started yet.
-        // We will not be able to delete this object within its method.
-        return !_started.load();
+        int current = _priority.load();
+        while (current >= 0 && current != priority
+               && !_priority.compare_exchange_weak(current, priority)) { }
+        return current >= 0 && current != priority;
     }
 
-private:
-    void _Load()
+    int GetPriority() const { return _priority.load(); }
+
+    void Terminate() { _terminated = true; }
+
+    bool IsTerminated() const { return _terminated.load(); }
+
+    //! Create the VP2 texture from the decoded image, on the main thread.
+    void Upload(const _DecodedTexture& decoded)
     {
-        if (_terminated) {
+        if (_terminated || _uploaded) {
             return;
         }
+        _uploaded = true;
+
         bool        isSRGB = false;
         MFloatArray uvScaleOffset;
-        auto*       texture
-            = _LoadTexture(_path, _hasFallbackColor, _fallbackColor, isSRGB, uvScaleOffset);
-        if (_terminated) {
-            return;
-        }
+        auto*       texture = _UploadTexture(
+            _path, decoded, _hasFallbackColor, _fallbackColor, isSRGB, uvScaleOffset);
         _parent->_UpdateLoadedTexture(_sceneDelegate, _path, texture, isSRGB, uvScaleOffset);
     }
 
+private:
     HdVP2TextureInfo  _fallbackTextureInfo;
     HdVP2Material*    _parent;
     HdSceneDelegate*  _sceneDelegate;
     const std::string _path;
     const GfVec4f     _fallbackColor;
-    std::atomic_bool  _started { false };
-    bool              _terminated { false };
+    std::atomic_int   _priority { -1 };
+    std::atomic_bool  _terminated { false };
+    bool              _uploaded { false };
     bool              _hasFallbackColor;
 };
 
+namespace {
+
+void _TextureDecodingQueue::Enqueue(const std::string& path, const TaskPtr& task)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_isExiting) {
+        return;
+    }
+
+    _JobPtr& job = _jobs[path];
+    const bool isNewJob = !job;
+    if (isNewJob) {
+        job = std::make_shared<_Job>();
+        job->path = path;
+    }
+
+    if (std::find(job->tasks.begin(), job->tasks.end(), task) == job->tasks.end()) {
+        job->tasks.push_back(task);
+    }
+
+    // The job can only be moved in the queue if it is not already decoding.
+    if (isNewJob || _queuedJobs.IsQueued(path)) {
+        _queuedJobs.Push(path, _GetPriority(*job));
+    }
+
+    _StartDecoders();
+    _ScheduleUpload();
+}
+
+void _TextureDecodingQueue::UpdatePriority(const std::string& path)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_isExiting || !_queuedJobs.IsQueued(path)) {
+        return;
+    }
+
+    const auto job = _jobs.find(path);
+    if (TF_VERIFY(job != _jobs.end())) {
+        _queuedJobs.Push(path, _GetPriority(*job->second));
+    }
+}
+
+void _TextureDecodingQueue::OnMayaExit()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _isExiting = true;
+        _queuedJobs.Clear();
+    }
+
+    _dispatcher.Wait();
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    _decodedJobs.clear();
+    _jobs.clear();
+    _decodedBytes = 0;
+}
+
+bool _TextureDecodingQueue::_IsOverBudget() const
+{
+    static const size_t kBudget
+        = size_t(std::max(TfGetEnvSetting(MAYAUSD_VP2_TEXTURE_DECODING_BUDGET_MB), 1)) << 20;
+    return _decodedBytes >= kBudget;
+}
+
+void _TextureDecodingQueue::_StartDecoders()
+{
+    const size_t maxDecoderCount = std::max(WorkGetConcurrencyLimit(), 1u);
+    while (_decoderCount < maxDecoderCount && _decoderCount < _queuedJobs.GetSize()
+           && !_IsOverBudget()) {
+        ++_decoderCount;
+        _dispatcher.Run([this]() { _Decode(); });
+    }
+}
+
+void _TextureDecodingQueue::_ScheduleUpload()
+{
+    if (_isUploadScheduled) {
+        return;
+    }
+    _isUploadScheduled = true;
+    MGlobal::executeTaskOnIdle([](void*) { _TextureDecodingQueue::GetInstance()._Upload(); });
+}
+
+bool _TextureDecodingQueue::_HasPendingTask(const _Job& job)
+{
+    return std::any_of(job.tasks.begin(), job.tasks.end(), [](const TaskPtr& task) {
+        return !task->IsTerminated();
+    });
+}
+
+int _TextureDecodingQueue::_GetPriority(const _Job& job)
+{
+    int priority = 0;
+    for (const TaskPtr& task : job.tasks) {
+        if (!task->IsTerminated()) {
+            priority = std::max(priority, task->GetPriority());
+        }
+    }
+    return priority;
+}
+
+void _TextureDecodingQueue::_Decode()
+{
+    for (;;) {
+        _JobPtr job;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            std::string path;
+            if (_isExiting || _IsOverBudget() || !_queuedJobs.Pop(&path)) {
+                --_decoderCount;
+                _decodedCondition.notify_all();
+                return;
+            }
+            const auto queuedJob = _jobs.find(path);
+            if (!TF_VERIFY(queuedJob != _jobs.end())) {
+                continue;
+            }
+            job = queuedJob->second;
+
+            // Skip the textures of the materials which were deleted in the meantime.
+            if (!_HasPendingTask(*job)) {
+                _jobs.erase(job->path);
+                continue;
+            }
+        }
+
+        _DecodedTexture decoded = _DecodeTexture(job->path);
+
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _decodedBytes += decoded.GetMemorySize();
+            job->decoded = std::move(decoded);
+            _decodedJobs.push_back(job);
+        }
+        _decodedCondition.notify_all();
+    }
+}
+
+void _TextureDecodingQueue::_Upload()
+{
+    MProfilingScope profilingScope(
+        HdVP2RenderDelegate::sProfilerCategory, MProfiler::kColorD_L2, "UploadDecodedTextures");
+
+    // Bound the time spent on the main thread, waiting for the decoders included, so that
+    // the viewport stays interactive while the textures load.
+    const auto deadline = std::chrono::steady_clock::now() + kUploadTimeSlice;
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _decodedCondition.wait_until(lock, deadline, [this]() {
+            return _isExiting || !_decodedJobs.empty() || _decoderCount == 0;
+        });
+    }
+
+    for (;;) {
+        _JobPtr job;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (_isExiting || _decodedJobs.empty()) {
+                break;
+            }
+            job = std::move(_decodedJobs.front());
+            _decodedJobs.pop_front();
+            _jobs.erase(job->path);
+        }
+
+        for (const TaskPtr& task : job->tasks) {
+            task->Upload(job->decoded);
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _decodedBytes -= std::min(job->decoded.GetMemorySize(), _decodedBytes);
+        }
+
+        // Upload at least one image per call, the others wait for the next idle time.
+        if (std::chrono::steady_clock::now() >= deadline) {
+            break;
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    _isUploadScheduled = false;
+    if (_isExiting || _jobs.empty()) {
+        return;
+    }
+
+    // Keep an idle task in the queue until all the textures are uploaded, so that flushing
+    // the idle queue waits for them.
+    _StartDecoders();
+    _ScheduleUpload();
+}
+
+} // anonymous namespace
+
 std::mutex                            HdVP2Material::_refreshMutex;
 std::chrono::steady_clock::time_point HdVP2Material::_startTime;
 std::atomic_size_t                    HdVP2Material::_runningTasksCounter;
@@ -2088,15 +2851,31 @@ void HdVP2Material::Sync(
             "HdVP2Material::Sync",
             id.GetText());
 
-        VtValue vtMatResource = sceneDelegate->GetMaterialResource(id);
+        VtValue              vtMatResource;
+        HdMaterialNetworkMap untexturedNetworkMap;
+        bool                 hasUntexturedNetworkMap = false;
+#ifdef WANT_MATERIALX_BUILD
+        // Reuse the networks already fetched to prepare the MaterialX fragments.
+        if (_preparedResource) {
+            vtMatResource = std::move(_preparedResource->materialResource);
+            untexturedNetworkMap = std::move(_preparedResource->untexturedNetworkMap);
+            hasUntexturedNetworkMap = true;
+            _preparedResource.reset();
+        } else
+#endif
+        {
+            vtMatResource = sceneDelegate->GetMaterialResource(id);
+        }
 
         if (vtMatResource.IsHolding<HdMaterialNetworkMap>()) {
             const HdMaterialNetworkMap& fullNetworkMap
                 = vtMatResource.UncheckedGet<HdMaterialNetworkMap>();
 
             // untextured network is always synced
-            HdMaterialNetworkMap untexturedNetworkMap = fullNetworkMap;
-            ConvertNetworkMapToUntextured(untexturedNetworkMap);
+            if (!hasUntexturedNetworkMap) {
+                untexturedNetworkMap = fullNetworkMap;
+                ConvertNetworkMapToUntextured(untexturedNetworkMap);
+            }
             _compiledNetworks[kUntextured].Sync(sceneDelegate, untexturedNetworkMap);
 
             // full network is synced only if required by display style
@@ -2130,24 +2909,19 @@ void HdVP2Material::CompiledNetwork::Sync(
     if (!bxdfNet.nodes.empty()) {
         if (_IsMaterialX(bxdfNet.nodes.back())) {
 
-            bool isVolume = false;
-#if PXR_VERSION > 2203
-            const HdMaterialNetwork2 surfaceNetwork
-                = HdConvertToHdMaterialNetwork2(networkMap, &isVolume);
-#else
-            HdMaterialNetwork2 surfaceNetwork;
-            HdMaterialNetwork2ConvertFromHdMaterialNetworkMap(
-                networkMap, &surfaceNetwork, &isVolume);
-#endif
-            if (isVolume) {
+            std::unique_ptr<_SurfaceNetwork> surfaceNetwork = std::move(_preparedSurfaceNetwork);
+            if (!surfaceNetwork) {
+                surfaceNetwork = _ConvertSurfaceNetwork(networkMap);
+            }
+            if (surfaceNetwork->isVolume) {
                 // Not supported.
                 return;
             }
 
-            size_t topoHash = _GenerateNetwork2TopoHash(surfaceNetwork);
+            const size_t topoHash = surfaceNetwork->topoHash;
 
             if (!_surfaceShader || topoHash != _topoHash) {
-                _surfaceShader.reset(_CreateMaterialXShaderInstance(id, surfaceNetwork));
+                _surfaceShader.reset(_CreateMaterialXShaderInstance(id, surfaceNetwork->network));
                 _frontFaceShader.reset(nullptr);
                 _pointShader.reset(nullptr);
                 _topoHash = topoHash;
@@ -2283,6 +3057,190 @@ void HdVP2Material::CompiledNetwork::Sync(
     }
 }
 
+#ifdef WANT_MATERIALX_BUILD
+/*static*/
+std::unique_ptr<HdVP2Material::CompiledNetwork::_SurfaceNetwork>
+HdVP2Material::CompiledNetwork::_ConvertSurfaceNetwork(const HdMaterialNetworkMap& networkMap)
+{
+    auto surfaceNetwork = std::make_unique<_SurfaceNetwork>();
+#if PXR_VERSION > 2203
+    surfaceNetwork->network
+        = HdConvertToHdMaterialNetwork2(networkMap, &surfaceNetwork->isVolume);
+#else
+    HdMaterialNetwork2ConvertFromHdMaterialNetworkMap(
+        networkMap, &surfaceNetwork->network, &surfaceNetwork->isVolume);
+#endif
+    if (!surfaceNetwork->isVolume) {
+        surfaceNetwork->topoHash = _GenerateNetwork2TopoHash(surfaceNetwork->network);
+    }
+    return surfaceNetwork;
+}
+
+bool HdVP2Material::CompiledNetwork::GetNewMaterialXNetwork(
+    const HdMaterialNetworkMap& networkMap,
+    HdMaterialNetwork2&         fixedNetwork)
+{
+    _preparedSurfaceNetwork.reset();
+
+    HdMaterialNetwork bxdfNet;
+    TfMapLookup(networkMap.map, HdMaterialTerminalTokens->surface, &bxdfNet);
+    if (bxdfNet.nodes.empty() || !_IsMaterialX(bxdfNet.nodes.back())) {
+        return false;
+    }
+
+    // The sync takes the converted network, whether a new shader instance is needed or not.
+    _preparedSurfaceNetwork = _ConvertSurfaceNetwork(networkMap);
+    const _SurfaceNetwork& surfaceNetwork = *_preparedSurfaceNetwork;
+    if (surfaceNetwork.isVolume
+        || surfaceNetwork.network.terminals.find(HdMaterialTerminalTokens->surface)
+            == surfaceNetwork.network.terminals.end()) {
+        return false;
+    }
+
+    if (_surfaceShader && surfaceNetwork.topoHash == _topoHash) {
+        return false;
+    }
+
+    // The fixes reset the node path map used to update the shader instance of this network.
+    CompiledNetwork scratchNetwork(_owner);
+    scratchNetwork._ApplyMtlxVP2Fixes(fixedNetwork, surfaceNetwork.network);
+    return true;
+}
+
+/*static*/
+void HdVP2Material::PrepareMaterialXFragments(
+    HdRenderIndex&   renderIndex,
+    HdSceneDelegate* sceneDelegate)
+{
+    MProfilingScope profilingScope(
+        HdVP2RenderDelegate::sProfilerCategory,
+        MProfiler::kColorC_L2,
+        "HdVP2Material::PrepareMaterialXFragments");
+
+    struct _Request
+    {
+        SdfPath            materialId;
+        HdMaterialNetwork2 fixedNetwork;
+        std::string        key;
+        _MaterialXFragment fragment;
+        bool               isGenerated = false;
+    };
+
+    // Collect the networks of the dirty materials which need a new shader instance, on the main
+    // thread since the VP2 fixes query the color management preferences and register the OCIO
+    // fragments. Identical topologies are only generated once.
+    const auto specularEnvironment = MaterialXMaya::OgsFragment::getSpecularEnvironment();
+    const std::string specularEnvKey
+        = MaterialXMaya::OgsFragment::getSpecularEnvKey(specularEnvironment);
+    const auto&                     diskCache = _MaterialXFragmentDiskCache::GetInstance();
+    std::vector<_Request>           requests;
+    std::unordered_set<std::string> requestedKeys;
+
+    auto addRequest = [&](const SdfPath&              materialId,
+                          HdVP2Material&              material,
+                          CompiledNetwork&            compiledNetwork,
+                          const HdMaterialNetworkMap& networkMap) {
+        _Request request;
+        if (!compiledNetwork.GetNewMaterialXNetwork(networkMap, request.fixedNetwork)) {
+            return;
+        }
+
+        const TfToken shaderCacheID(_GenerateXMLString(request.fixedNetwork) + specularEnvKey);
+        if (material._renderDelegate->GetPrimvarsFromCache(shaderCacheID)) {
+            // The shader instance is already cached.
+            return;
+        }
+
+        request.key = diskCache.GetKey(shaderCacheID.GetString());
+        if (_preparedMaterialXFragments.count(request.key)
+            || !requestedKeys.insert(request.key).second
+            || diskCache.Load(request.key, request.fragment)) {
+            return;
+        }
+
+        request.materialId = materialId;
+        requests.push_back(std::move(request));
+    };
+
+    HdChangeTracker& changeTracker = renderIndex.GetChangeTracker();
+    for (const SdfPath& materialId :
+         renderIndex.GetSprimSubtree(HdPrimTypeTokens->material, SdfPath::AbsoluteRootPath())) {
+        const HdDirtyBits dirtyBits = changeTracker.GetSprimDirtyBits(materialId);
+        if (!(dirtyBits & (HdMaterial::DirtyResource | HdMaterial::DirtyParams))) {
+            continue;
+        }
+
+        auto* const material = static_cast<HdVP2Material*>(
+            renderIndex.GetSprim(HdPrimTypeTokens->material, materialId));
+        if (!material) {
+            continue;
+        }
+
+        // Same networks as the ones synced by HdVP2Material::Sync(), which takes them rather
+        // than fetching and converting them again.
+        auto prepared = std::make_unique<_PreparedResource>();
+        prepared->materialResource = sceneDelegate->GetMaterialResource(materialId);
+        if (!prepared->materialResource.IsHolding<HdMaterialNetworkMap>()) {
+            material->_preparedResource.reset();
+            continue;
+        }
+
+        const HdMaterialNetworkMap& fullNetworkMap
+            = prepared->materialResource.UncheckedGet<HdMaterialNetworkMap>();
+        prepared->untexturedNetworkMap = fullNetworkMap;
+        ConvertNetworkMapToUntextured(prepared->untexturedNetworkMap);
+        addRequest(
+            materialId,
+            *material,
+            material->_compiledNetworks[kUntextured],
+            prepared->untexturedNetworkMap);
+
+        auto* const param
+            = static_cast<HdVP2RenderParam*>(material->_renderDelegate->GetRenderParam());
+        if (param->GetDrawScene().NeedTexturedMaterials()) {
+            addRequest(materialId, *material, material->_compiledNetworks[kFull], fullNetworkMap);
+        }
+
+        material->_preparedResource = std::move(prepared);
+    }
+
+    if (requests.empty()) {
+        return;
+    }
+
+    // Generating the fragments does not call into Maya, once the primary UV set name is set.
+    const auto prevUVSetName = mx::OgsXmlGenerator::getPrimaryUVSetName();
+    mx::OgsXmlGenerator::setPrimaryUVSetName(_GetMaterialXData()._mainUvSetName);
+
+    WorkParallelForN(requests.size(), [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            _Request& request = requests[i];
+            try {
+                request.isGenerated = _GenerateMaterialXFragment(
+                    request.materialId,
+                    request.fixedNetwork,
+                    specularEnvironment,
+                    request.fragment);
+            } catch (mx::Exception&) {
+                // The sync generates the fragment again and reports the error.
+            }
+        }
+    });
+
+    mx::OgsXmlGenerator::setPrimaryUVSetName(prevUVSetName);
+
+    for (_Request& request : requests) {
+        if (request.isGenerated) {
+            _preparedMaterialXFragments.emplace(
+                std::move(request.key), std::move(request.fragment));
+        }
+    }
+}
+
+/*static*/
+void HdVP2Material::ReleaseMaterialXFragments() { _preparedMaterialXFragments.clear(); }
+#endif
+
 /*! \brief  Returns the minimal set of dirty bits to place in the
 change tracker for use in the first sync of this prim.
 */
@@ -2878,103 +3836,38 @@ MHWRender::MShaderInstance* HdVP2Material::CompiledNetwork::_CreateMaterialXShad
         return shaderInstance;
     }
 
-    SdfPath fixedPath = fixedNetwork.terminals[HdMaterialTerminalTokens->surface].upstreamNode;
-    HdMaterialNode2 const* surfTerminal = &fixedNetwork.nodes[fixedPath];
-    if (!surfTerminal) {
-        return shaderInstance;
-    }
-
     try {
         // The HdMtlxCreateMtlxDocumentFromHdNetwork function can throw if any MaterialX error is
         // raised.
 
-        // Check if the Terminal is a MaterialX Node
-        SdrRegistry&                sdrRegistry = SdrRegistry::GetInstance();
-        const SdrShaderNodeConstPtr mtlxSdrNode = sdrRegistry.GetShaderNodeByIdentifierAndType(
-            surfTerminal->nodeTypeId, HdVP2Tokens->mtlx);
-
-        mx::DocumentPtr           mtlxDoc;
-        const mx::FileSearchPath& crLibrarySearchPath(_GetMaterialXData()._mtlxSearchPath);
-        if (mtlxSdrNode) {
-
-#ifdef HAS_COLOR_MANAGEMENT_SUPPORT_API
-            mx::DocumentPtr completeLibrary = mx::createDocument();
-            completeLibrary->importLibrary(_GetMaterialXData()._mtlxLibrary);
-            completeLibrary->importLibrary(MaterialXMaya::OgsFragment::getOCIOLibrary());
-#else
-            mx::DocumentPtr completeLibrary = _GetMaterialXData()._mtlxLibrary;
-#endif
-
-            // Create the MaterialX Document from the HdMaterialNetwork
-#if PXR_VERSION > 2111
-            mtlxDoc = HdMtlxCreateMtlxDocumentFromHdNetwork(
+        // Reuse the fragment generated ahead of the sync, or for the same network in a previous
+        // session, if any.
+        const auto&        diskCache = _MaterialXFragmentDiskCache::GetInstance();
+        const std::string  fragmentKey = diskCache.GetKey(shaderCacheID.GetString());
+        _MaterialXFragment fragment;
+        const bool         isFragmentCached = diskCache.Load(fragmentKey, fragment);
+        if (!isFragmentCached && !_TakePreparedMaterialXFragment(fragmentKey, fragment)) {
+            // Enable changing texcoord to geompropvalue
+            const auto prevUVSetName = mx::OgsXmlGenerator::getPrimaryUVSetName();
+            mx::OgsXmlGenerator::setPrimaryUVSetName(_GetMaterialXData()._mainUvSetName);
+
+            const bool isGenerated = _GenerateMaterialXFragment(
+                materialId,
                 fixedNetwork,
-                *surfTerminal, // MaterialX HdNode
-                fixedPath,
-                SdfPath(_mtlxTokens->USD_Mtlx_VP2_Material),
-                completeLibrary);
-#else
-            std::set<SdfPath> hdTextureNodes;
-            mx::StringMap mxHdTextureMap; // Mx-Hd texture name counterparts
-            mtlxDoc = HdMtlxCreateMtlxDocumentFromHdNetwork(
-                fixedNetwork,
-                *surfTerminal, // MaterialX HdNode
-                SdfPath(_mtlxTokens->USD_Mtlx_VP2_Material),
-                completeLibrary,
-                &hdTextureNodes,
-                &mxHdTextureMap);
-#endif
-
-            if (!mtlxDoc) {
-                return shaderInstance;
-            }
-
-            // Touchups required to fix input stream issues:
-            _AddMissingTangents(mtlxDoc);
-
-            _surfaceShaderId = terminalPath;
+                MaterialXMaya::OgsFragment::getSpecularEnvironment(),
+                fragment);
 
-            if (TfDebug::IsEnabled(HDVP2_DEBUG_MATERIAL)) {
-                std::cout << "generated shader code for " << materialId.GetText() << ":\n";
-                std::cout << "Generated graph\n==============================\n";
-                mx::writeToXmlStream(mtlxDoc, std::cout);
-                std::cout << "\n==============================\n";
-            }
-        } else {
-            return shaderInstance;
-        }
+            // Restore previous UV set name
+            mx::OgsXmlGenerator::setPrimaryUVSetName(prevUVSetName);
 
-        mx::NodePtr materialNode;
-        for (const mx::NodePtr& material : mtlxDoc->getMaterialNodes()) {
-            if (material->getName() == _mtlxTokens->USD_Mtlx_VP2_Material.GetText()) {
-                materialNode = material;
+            if (!isGenerated) {
+                return shaderInstance;
             }
         }
+        _surfaceShaderId = terminalPath;
 
-        if (!materialNode) {
-            return shaderInstance;
-        }
-
-        // Enable changing texcoord to geompropvalue
-        const auto prevUVSetName = mx::OgsXmlGenerator::getPrimaryUVSetName();
-        mx::OgsXmlGenerator::setPrimaryUVSetName(_GetMaterialXData()._mainUvSetName);
-
-        MaterialXMaya::OgsFragment ogsFragment(materialNode, crLibrarySearchPath);
-
-        // Restore previous UV set name
-        mx::OgsXmlGenerator::setPrimaryUVSetName(prevUVSetName);
-
-        // Explore the fragment for primvars:
-        mx::ShaderPtr            shader = ogsFragment.getShader();
-        const mx::VariableBlock& vertexInputs
-            = shader->getStage(mx::Stage::VERTEX).getInputBlock(mx::HW::VERTEX_INPUTS);
-        for (size_t i = 0; i < vertexInputs.size(); ++i) {
-            const mx::ShaderPort* variable = vertexInputs[i];
-            // Position is always assumed.
-            // Tangent will be generated in the vertex shader using a utility fragment
-            if (variable->getName() == mx::HW::T_IN_NORMAL) {
-                _requiredPrimvars.push_back(HdTokens->normals);
-            }
+        if (fragment.usesNormals) {
+            _requiredPrimvars.push_back(HdTokens->normals);
         }
 
         MHWRender::MRenderer* const renderer = MHWRender::MRenderer::theRenderer();
@@ -2987,18 +3880,22 @@ MHWRender::MShaderInstance* HdVP2Material::CompiledNetwork::_CreateMaterialXShad
             return shaderInstance;
         }
 
-        MString fragmentName(ogsFragment.getFragmentName().c_str());
+        MString fragmentName(fragment.name.c_str());
 
         if (!fragmentManager->hasFragment(fragmentName)) {
-            std::string   fragSrc = ogsFragment.getFragmentSource();
             const MString registeredFragment
-                = fragmentManager->addShadeFragmentFromBuffer(fragSrc.c_str(), false);
+                = fragmentManager->addShadeFragmentFromBuffer(fragment.source.c_str(), false);
             if (registeredFragment.length() == 0) {
                 TF_WARN("Failed to register shader fragment %s", fragmentName.asChar());
                 return shaderInstance;
             }
         }
 
+        // Only save the fragments which could be registered.
+        if (!isFragmentCached) {
+            diskCache.Save(fragmentKey, fragment);
+        }
+
         const MHWRender::MShaderManager* const shaderMgr = renderer->getShaderManager();
         if (!TF_VERIFY(shaderMgr)) {
             return shaderInstance;
@@ -3022,7 +3919,7 @@ MHWRender::MShaderInstance* HdVP2Material::CompiledNetwork::_CreateMaterialXShad
         }
 
         // Fixup inputs that were renamed because they conflicted with reserved keywords:
-        for (const auto& namePair : ogsFragment.getPathInputMap()) {
+        for (const auto& namePair : fragment.pathInputMap) {
             std::string path = namePair.first;
             std::string input = namePair.second;
             // Renaming adds digits at the end, so only compare the backs.
@@ -3527,29 +4424,55 @@ const HdVP2TextureInfo& HdVP2Material::_AcquireTexture(
         return *info;
     }
 
-    auto* task = new TextureLoadingTask(this, sceneDelegate, path, hasFallbackColor, fallbackColor);
+    auto task = std::make_shared<TextureLoadingTask>(
+        this, sceneDelegate, path, hasFallbackColor, fallbackColor);
     _textureLoadingTasks.emplace(path, task);
     return task->GetFallbackTextureInfo();
 }
 
-void HdVP2Material::EnqueueLoadTextures()
+void HdVP2Material::EnqueueLoadTextures(TextureLoadingPriority priority)
 {
     for (const auto& task : _textureLoadingTasks) {
-        if (task.second->EnqueueLoadOnIdle()) {
+        const int previousPriority = task.second->RaisePriority(priority);
+        if (previousPriority >= priority) {
+            continue;
+        }
+        _TextureDecodingQueue::GetInstance().Enqueue(task.first, task.second);
+        if (previousPriority < 0) {
             ++_runningTasksCounter;
         }
     }
 }
 
+void HdVP2Material::UpdateLoadTexturesPriority()
+{
+    TextureLoadingPriority priority = kVisiblePrimTextures;
+    {
+        auto* const param = static_cast<HdVP2RenderParam*>(_renderDelegate->GetRenderParam());
+        const ProxyRenderDelegate& drawScene = param->GetDrawScene();
+
+        std::lock_guard<std::mutex> lock(_materialSubscriptionsMutex);
+        for (const SdfPath& rprimId : _materialSubscriptions) {
+            if (drawScene.GetSelectionStatus(rprimId) != kUnselected) {
+                priority = kSelectedPrimTextures;
+                break;
+            }
+        }
+    }
+
+    for (const auto& task : _textureLoadingTasks) {
+        if (task.second->ChangePriority(priority)) {
+            _TextureDecodingQueue::GetInstance().UpdatePriority(task.first);
+        }
+    }
+}
+
 void HdVP2Material::ClearPendingTasks()
 {
     // Inform tasks that have not started or finished that this material object
     // is no longer valid
     for (auto& task : _textureLoadingTasks) {
-        if (task.second->Terminate()) {
-            // Delete the pointer: we can only do that outside of the object scope
-            delete task.second;
-        }
+        task.second->Terminate();
     }
 
     // Remove the reference of all the tasks
@@ -3575,10 +4498,9 @@ void HdVP2Material::_UpdateLoadedTexture(
         --_runningTasksCounter;
     }
 
-    // Pop the task object from the container, since this method is
-    // called directly from the task object method `loadOnIdle()`,
-    // we do not handle the deletion here, we will let the
-    // function on idle to delete the task object.
+    // Pop the task object from the container. The decoding queue still
+    // holds a reference to it, since this method is called directly from
+    // the task object method `Upload()`.
     _textureLoadingTasks.erase(path);
 
     // Check the cache again. If the texture is not in the cache
@@ -3699,6 +4621,7 @@ void HdVP2Material::MaterialChanged(HdSceneDelegate* sceneDelegate)
 
 void HdVP2Material::OnMayaExit()
 {
+    _TextureDecodingQueue::GetInstance().OnMayaExit();
     _TransientTexturePreserver::GetInstance().OnMayaExit();
     _globalTextureMap.clear();
     HdVP2RenderDelegate::OnMayaExit();
@@ -25,6 +25,7 @@
 #include <maya/MShaderManager.h>
 
 #include <chrono>
+#include <memory>
 #include <mutex>
 #include <set>
 #include <unordered_map>
@@ -38,6 +39,7 @@
 
 PXR_NAMESPACE_OPEN_SCOPE
 
+class HdRenderIndex;
 class HdSceneDelegate;
 class HdVP2RenderDelegate;
 
@@ -103,7 +105,22 @@ public:
     //! Get primvar tokens required by this material.
     const TfTokenVector& GetRequiredPrimvars(const TfToken& reprToken) const;
 
-    void EnqueueLoadTextures();
+    //! Priorities of the asynchronous texture loading, from the lowest to the highest.
+    enum TextureLoadingPriority
+    {
+        kHiddenPrimTextures = 0, //!< Textures of the prims which are not visible
+        kVisiblePrimTextures,    //!< Textures of the visible prims
+        kSelectedPrimTextures    //!< Textures of the selected prims
+    };
+
+    //! Queue the asynchronous loading of the textures of this material. The textures are
+    //! decoded in the background, in order of priority, and uploaded to VP2 on idle.
+    //! Queuing a texture again with a higher priority moves it up the queue.
+    void EnqueueLoadTextures(TextureLoadingPriority priority);
+
+    //! Move the queued textures of this material up or down the queue after the selection of
+    //! an Rprim using it changed: they go first while any of these Rprims is selected.
+    void UpdateLoadTexturesPriority();
     void ClearPendingTasks();
 
     //! The specified Rprim starts listening to changes on this material.
@@ -120,6 +137,16 @@ public:
 
     static void OnMayaExit();
 
+#ifdef WANT_MATERIALX_BUILD
+    //! Generate concurrently the MaterialX fragments which the sync of the dirty materials
+    //! will need, so that the sync only has to register them with VP2.
+    static void
+    PrepareMaterialXFragments(HdRenderIndex& renderIndex, HdSceneDelegate* sceneDelegate);
+
+    //! Release the prepared MaterialX fragments which were not used by the sync.
+    static void ReleaseMaterialXFragments();
+#endif
+
 private:
     class CompiledNetwork
     {
@@ -131,6 +158,15 @@ private:
 
         void Sync(HdSceneDelegate*, const HdMaterialNetworkMap&);
 
+#ifdef WANT_MATERIALX_BUILD
+        //! Return true and the network made VP2-friendly if the next sync will create a new
+        //! MaterialX shader instance for the network map. The converted surface network is
+        //! kept for the next sync, which then does not convert the network map again.
+        bool GetNewMaterialXNetwork(
+            const HdMaterialNetworkMap& networkMap,
+            HdMaterialNetwork2&         fixedNetwork);
+#endif
+
         MHWRender::MShaderInstance* GetSurfaceShader() const { return _surfaceShader.get(); }
         MHWRender::MShaderInstance* GetFrontFaceShader() const;
         MHWRender::MShaderInstance* GetPointShader() const;
@@ -183,6 +219,19 @@ private:
         // HdMaterialNetwork2 is complete.
         size_t _topoHash = 0;
 
+        //! Surface network of a MaterialX network map, with its topology hash.
+        struct _SurfaceNetwork
+        {
+            HdMaterialNetwork2 network;
+            bool               isVolume = false;
+            size_t             topoHash = 0;
+        };
+        static std::unique_ptr<_SurfaceNetwork>
+        _ConvertSurfaceNetwork(const HdMaterialNetworkMap& networkMap);
+
+        //! Surface network converted by GetNewMaterialXNetwork() for the next sync.
+        std::unique_ptr<_SurfaceNetwork> _preparedSurfaceNetwork;
+
         void _ApplyMtlxVP2Fixes(HdMaterialNetwork2& outNet, const HdMaterialNetwork2& inNet);
         MHWRender::MShaderInstance* _CreateMaterialXShaderInstance(
             SdfPath const&            materialId,
@@ -224,10 +273,21 @@ private:
         _renderDelegate; //!< VP2 render delegate for which this material was created
 
     CompiledNetwork              _compiledNetworks[kNumNetworkConfigs];
+
+#ifdef WANT_MATERIALX_BUILD
+    //! Material resource fetched by PrepareMaterialXFragments() for the next sync.
+    struct _PreparedResource
+    {
+        VtValue              materialResource;
+        HdMaterialNetworkMap untexturedNetworkMap;
+    };
+    std::unique_ptr<_PreparedResource> _preparedResource;
+#endif
+
     static HdVP2GlobalTextureMap _globalTextureMap; //!< Texture in use by all materials in MayaUSD
     HdVP2LocalTextureMap         _localTextureMap;  //!< Textures used by this material
 
-    std::unordered_map<std::string, TextureLoadingTask*> _textureLoadingTasks;
+    std::unordered_map<std::string, std::shared_ptr<TextureLoadingTask>> _textureLoadingTasks;
 
     //! Mutex protecting concurrent access to the Rprim set
     std::mutex _materialSubscriptionsMutex;
@@ -932,7 +932,20 @@ bool MayaUsdRPrim::_SyncCommon(
 
     // Update the selection status if it changed.
     if (*dirtyBits & DirtySelectionHighlight) {
-        _selectionStatus = drawScene.GetSelectionStatus(id);
+        const HdVP2SelectionStatus selectionStatus = drawScene.GetSelectionStatus(id);
+        if (selectionStatus != _selectionStatus) {
+            _selectionStatus = selectionStatus;
+
+            // Load the textures of the selected prims first.
+            const SdfPath& materialId = refThis.GetMaterialId();
+            if (!materialId.IsEmpty()) {
+                auto* material = dynamic_cast<HdVP2Material*>(
+                    delegate->GetRenderIndex().GetSprim(HdPrimTypeTokens->material, materialId));
+                if (material) {
+                    material->UpdateLoadTexturesPriority();
+                }
+            }
+        }
     } else {
         TF_VERIFY(_selectionStatus == drawScene.GetSelectionStatus(id));
     }
@@ -998,8 +1011,15 @@ SdfPath MayaUsdRPrim::_GetUpdatedMaterialId(HdRprim* rprim, HdSceneDelegate* del
         auto* material = dynamic_cast<HdVP2Material*>(
             renderIndex.GetSprim(HdPrimTypeTokens->material, materialId));
         if (material) {
-            // Load the textures if any
-            material->EnqueueLoadTextures();
+            // Load the textures if any, those of the selected prims first.
+            auto* const param = static_cast<HdVP2RenderParam*>(_delegate->GetRenderParam());
+            HdVP2Material::TextureLoadingPriority priority = HdVP2Material::kHiddenPrimTextures;
+            if (param->GetDrawScene().GetSelectionStatus(id) != kUnselected) {
+                priority = HdVP2Material::kSelectedPrimTextures;
+            } else if (rprim->IsVisible()) {
+                priority = HdVP2Material::kVisiblePrimTextures;
+            }
+            material->EnqueueLoadTextures(priority);
         }
     }
 
@@ -28,10 +28,10 @@
 
 #include <pxr/base/gf/matrix4d.h>
 #include <pxr/base/tf/getenv.h>
+#include <pxr/base/work/loops.h>
 #include <pxr/imaging/hd/extComputation.h>
 #include <pxr/imaging/hd/meshUtil.h>
 #include <pxr/imaging/hd/sceneDelegate.h>
-#include <pxr/imaging/hd/smoothNormals.h>
 #include <pxr/imaging/hd/version.h>
 #include <pxr/imaging/hd/vertexAdjacency.h>
 #include <pxr/pxr.h>
@@ -50,8 +50,11 @@
 #include <maya/MProfiler.h>
 #include <maya/MSelectionMask.h>
 
+#include <algorithm>
+#include <cstdint>
 #include <numeric>
 #include <type_traits>
+#include <vector>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
@@ -77,7 +80,7 @@ void _FillPrimvarData(
     size_t                   channelOffset,
     const VtIntArray&        renderingToSceneFaceVtxIds,
     const MString&           rprimId,
-    const HdMeshTopology&    topology,
+    const HdMeshTopology&    renderingTopology,
     const TfToken&           primvarName,
     const VtArray<SRC_TYPE>& primvarData,
     const HdInterpolation&   primvarInterp)
@@ -125,7 +128,8 @@ void _FillPrimvarData(
         }
         break;
     case HdInterpolationUniform: {
-        const VtIntArray& faceVertexCounts = topology.GetFaceVertexCounts();
+        const VtIntArray& faceVertexCounts = renderingTopology.GetFaceVertexCounts();
+        const VtIntArray& renderingFaceVtxIds = renderingTopology.GetFaceVertexIndices();
         const size_t      numFaces = faceVertexCounts.size();
         if (numFaces <= primvarData.size()) {
             // The primvar has more data than needed, we issue a warning but
@@ -147,7 +151,8 @@ void _FillPrimvarData(
                 const size_t faceVertexEnd = v + faceVertexCount;
                 for (; v < faceVertexEnd; v++) {
                     SRC_TYPE* pointer = reinterpret_cast<SRC_TYPE*>(
-                        reinterpret_cast<float*>(&vertexBuffer[v]) + channelOffset);
+                        reinterpret_cast<float*>(&vertexBuffer[renderingFaceVtxIds[v]])
+                        + channelOffset);
                     *pointer = primvarData[f];
                 }
             }
@@ -168,17 +173,16 @@ void _FillPrimvarData(
         }
         break;
     }
-    case HdInterpolationFaceVarying:
-        // Unshared vertex layout is required for face-varying primvars, in
-        // this case renderingToSceneFaceVtxIds is a natural sequence starting
-        // from 0, thus we can save a lookup into the table. If the assumption
-        // about the natural sequence is changed, we will need the lookup and
-        // remap indices.
-        if (numVertices <= primvarData.size()) {
+    case HdInterpolationFaceVarying: {
+        // The face-vertices welded into a rendering vertex have the same value,
+        // so writing the value of each face-vertex fills every rendering vertex.
+        const VtIntArray& renderingFaceVtxIds = renderingTopology.GetFaceVertexIndices();
+        const size_t      numFaceVertices = renderingFaceVtxIds.size();
+        if (numFaceVertices <= primvarData.size()) {
             // If the primvar has more data than needed, we issue a warning,
             // but don't skip the primvar update. Truncate the buffer to the
             // expected length.
-            if (numVertices < primvarData.size()) {
+            if (numFaceVertices < primvarData.size()) {
                 TF_DEBUG(HDVP2_DEBUG_MESH)
                     .Msg(
                         "Invalid Hydra prim '%s': "
@@ -187,17 +191,21 @@ void _FillPrimvarData(
                         rprimId.asChar(),
                         primvarName.GetText(),
                         primvarData.size(),
-                        numVertices);
+                        numFaceVertices);
             }
 
-            if (channelOffset == 0 && std::is_same<DEST_TYPE, SRC_TYPE>::value) {
+            // When no face-vertices were welded, the rendering vertices are
+            // numbered in face-vertex order and the data can be copied as-is.
+            if (numVertices == numFaceVertices && channelOffset == 0
+                && std::is_same<DEST_TYPE, SRC_TYPE>::value) {
                 const void* source = static_cast<const void*>(primvarData.cdata());
                 memcpy(vertexBuffer, source, sizeof(DEST_TYPE) * numVertices);
             } else {
-                for (size_t v = 0; v < numVertices; v++) {
+                for (size_t fv = 0; fv < numFaceVertices; fv++) {
                     SRC_TYPE* pointer = reinterpret_cast<SRC_TYPE*>(
-                        reinterpret_cast<float*>(&vertexBuffer[v]) + channelOffset);
-                    *pointer = primvarData[v];
+                        reinterpret_cast<float*>(&vertexBuffer[renderingFaceVtxIds[fv]])
+                        + channelOffset);
+                    *pointer = primvarData[fv];
                 }
             }
         } else {
@@ -211,11 +219,12 @@ void _FillPrimvarData(
                     rprimId.asChar(),
                     primvarName.GetText(),
                     primvarData.size(),
-                    numVertices);
+                    numFaceVertices);
 
             memset(vertexBuffer, 0, sizeof(DEST_TYPE) * numVertices);
         }
         break;
+    }
     default:
         TF_CODING_ERROR(
             "Invalid Hydra prim '%s': "
@@ -229,7 +238,8 @@ void _FillPrimvarData(
 
 //! If there is uniform or face-varying primvar, we have to create unshared
 //! vertex layout on CPU because SSBO technique is not widely supported by
-//! GPUs and 3D APIs.
+//! GPUs and 3D APIs. The scene points are only split at the seams of these
+//! primvars, see _WeldFaceVertices().
 bool _IsUnsharedVertexLayoutRequired(const PrimvarInfoMap& primvarInfo)
 {
     for (const auto& it : primvarInfo) {
@@ -242,6 +252,173 @@ bool _IsUnsharedVertexLayoutRequired(const PrimvarInfoMap& primvarInfo)
     return false;
 }
 
+//! Helper utility function to access the elements of a primvar as 32-bit words.
+template <class SRC_TYPE>
+bool _GetPrimvarWords(
+    const VtValue&   value,
+    const uint32_t** data,
+    size_t*          numWordsPerElement,
+    size_t*          numElements)
+{
+    static_assert(sizeof(SRC_TYPE) % sizeof(uint32_t) == 0, "Unexpected primvar element size");
+
+    if (!value.IsHolding<VtArray<SRC_TYPE>>()) {
+        return false;
+    }
+
+    const VtArray<SRC_TYPE>& array = value.UncheckedGet<VtArray<SRC_TYPE>>();
+    *data = reinterpret_cast<const uint32_t*>(array.cdata());
+    *numWordsPerElement = sizeof(SRC_TYPE) / sizeof(uint32_t);
+    *numElements = array.size();
+    return true;
+}
+
+//! Uniform or face-varying primvar splitting the scene points at its seams.
+struct _SeamPrimvar
+{
+    const uint32_t* data;
+    size_t          numWordsPerElement;
+    bool            isUniform;
+};
+
+/*! \brief  Computes the vertex layout used for drawing, returning the rendering
+            vertex of each scene face-vertex.
+
+    The face-vertices sharing a scene point are welded into a single rendering
+    vertex, unless a uniform or face-varying primvar has different values on
+    them. Without such primvars, there is one rendering vertex per scene point.
+    Rendering vertices are numbered in order of first use to avoid drastically
+    jumping indices, since cache efficiency is important to fast rendering
+    performance for dense meshes.
+*/
+VtIntArray _WeldFaceVertices(const HdMeshTopology& topology, const PrimvarInfoMap& primvarInfo)
+{
+    const VtIntArray& faceVertexCounts = topology.GetFaceVertexCounts();
+    const VtIntArray& faceVertexIndices = topology.GetFaceVertexIndices();
+    const size_t      numFaces = faceVertexCounts.size();
+    const size_t      numFaceVertices = faceVertexIndices.size();
+
+    std::vector<_SeamPrimvar> seamPrimvars;
+    bool                      hasUniformPrimvar = false;
+    for (const auto& it : primvarInfo) {
+        const PrimvarSource& source = it.second->_source;
+        const bool           isUniform = (source.interpolation == HdInterpolationUniform);
+        if (!isUniform && source.interpolation != HdInterpolationFaceVarying) {
+            continue;
+        }
+
+        // Only the primvar types filled into vertex buffers matter.
+        _SeamPrimvar primvar { nullptr, 0, isUniform };
+        size_t       numElements = 0;
+        if (!_GetPrimvarWords<float>(
+                source.data, &primvar.data, &primvar.numWordsPerElement, &numElements)
+            && !_GetPrimvarWords<GfVec2f>(
+                source.data, &primvar.data, &primvar.numWordsPerElement, &numElements)
+            && !_GetPrimvarWords<GfVec3f>(
+                source.data, &primvar.data, &primvar.numWordsPerElement, &numElements)
+            && !_GetPrimvarWords<GfVec4f>(
+                source.data, &primvar.data, &primvar.numWordsPerElement, &numElements)
+            && !_GetPrimvarWords<int>(
+                source.data, &primvar.data, &primvar.numWordsPerElement, &numElements)) {
+            continue;
+        }
+
+        // The buffers of primvars with missing elements are cleared.
+        if (numElements < (isUniform ? numFaces : numFaceVertices)) {
+            continue;
+        }
+
+        seamPrimvars.push_back(primvar);
+        hasUniformPrimvar = hasUniformPrimvar || isUniform;
+    }
+
+    VtIntArray renderingFaceVtxIds(numFaceVertices);
+    int        numRenderingVertices = 0;
+
+    if (seamPrimvars.empty()) {
+        std::vector<int> sceneToRenderingFaceVtxIds(topology.GetNumPoints(), -1);
+        for (size_t fv = 0; fv < numFaceVertices; fv++) {
+            int& renderingFaceVtxId = sceneToRenderingFaceVtxIds[faceVertexIndices[fv]];
+            if (renderingFaceVtxId < 0) {
+                renderingFaceVtxId = numRenderingVertices++;
+            }
+            renderingFaceVtxIds[fv] = renderingFaceVtxId;
+        }
+        return renderingFaceVtxIds;
+    }
+
+    std::vector<int> faceIds;
+    if (hasUniformPrimvar) {
+        faceIds.reserve(numFaceVertices);
+        for (size_t f = 0; f < numFaces; f++) {
+            faceIds.insert(
+                faceIds.end(), size_t(std::max(faceVertexCounts[f], 0)), static_cast<int>(f));
+        }
+        faceIds.resize(numFaceVertices, 0);
+    }
+
+    auto elementWords = [&faceIds](const _SeamPrimvar& primvar, size_t fv) {
+        const size_t element = primvar.isUniform ? faceIds[fv] : fv;
+        return primvar.data + element * primvar.numWordsPerElement;
+    };
+
+    auto hashFaceVertex = [&](size_t fv) {
+        // 64-bit FNV-1a over the scene point and the primvar values.
+        uint64_t hash = (14695981039346656037ull ^ uint32_t(faceVertexIndices[fv]))
+            * 1099511628211ull;
+        for (const _SeamPrimvar& primvar : seamPrimvars) {
+            const uint32_t* words = elementWords(primvar, fv);
+            for (size_t w = 0; w < primvar.numWordsPerElement; w++) {
+                hash = (hash ^ words[w]) * 1099511628211ull;
+            }
+        }
+        return static_cast<size_t>(hash ^ (hash >> 32));
+    };
+
+    // Values are compared bitwise: they are copied as-is into the vertex buffers.
+    auto isSameVertex = [&](size_t fv, size_t otherFv) {
+        if (faceVertexIndices[fv] != faceVertexIndices[otherFv]) {
+            return false;
+        }
+        for (const _SeamPrimvar& primvar : seamPrimvars) {
+            const uint32_t* words = elementWords(primvar, fv);
+            const uint32_t* otherWords = elementWords(primvar, otherFv);
+            if (!std::equal(words, words + primvar.numWordsPerElement, otherWords)) {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    // Open-addressing hash table of rendering vertices, with linear probing.
+    // It is at most half full, since there cannot be more rendering vertices
+    // than face-vertices.
+    size_t tableSize = 2;
+    while (tableSize < 2 * numFaceVertices) {
+        tableSize *= 2;
+    }
+    const size_t     tableMask = tableSize - 1;
+    std::vector<int> table(tableSize, -1);
+
+    // The first face-vertex welded into each rendering vertex.
+    std::vector<int> renderingToFirstFaceVtxIds;
+    renderingToFirstFaceVtxIds.reserve(numFaceVertices);
+
+    for (size_t fv = 0; fv < numFaceVertices; fv++) {
+        size_t slot = hashFaceVertex(fv) & tableMask;
+        while (table[slot] >= 0 && !isSameVertex(renderingToFirstFaceVtxIds[table[slot]], fv)) {
+            slot = (slot + 1) & tableMask;
+        }
+        if (table[slot] < 0) {
+            table[slot] = numRenderingVertices++;
+            renderingToFirstFaceVtxIds.push_back(static_cast<int>(fv));
+        }
+        renderingFaceVtxIds[fv] = table[slot];
+    }
+
+    return renderingFaceVtxIds;
+}
+
 //! Helper utility function to get number of edge indices
 unsigned int _GetNumOfEdgeIndices(const HdMeshTopology& topology)
 {
@@ -348,6 +525,65 @@ VtVec3fArray _points(PrimvarInfoMap& infoMap)
     return VtVec3fArray();
 }
 
+//! Meshes with fewer rendering vertices compute their smooth normals on the calling thread,
+//! since the rprims are already synchronized in parallel.
+constexpr size_t sMinParallelSmoothNormalsCount = 16384;
+
+/*! \brief  Computes the smooth normals straight into the normals vertex buffer.
+
+    Same result as Hd_SmoothNormals::ComputeSmoothNormals() gathered by _FillPrimvarData():
+    each rendering vertex accumulates the normals of the faces around its scene point, using
+    the vertex adjacency. The rendering vertices only duplicate scene points at the seams of
+    the unshared vertex layout, so few normals are computed twice. Large meshes are processed
+    in parallel chunks of rendering vertices, each writing its own range of the buffer.
+*/
+void _FillSmoothNormals(
+    GfVec3f*                  vertexBuffer,
+    size_t                    numVertices,
+    const VtIntArray&         renderingToSceneFaceVtxIds,
+    const Hd_VertexAdjacency& adjacency,
+    const VtVec3fArray&       points)
+{
+    if (!TF_VERIFY(numVertices <= renderingToSceneFaceVtxIds.size())) {
+        memset(vertexBuffer, 0, sizeof(GfVec3f) * numVertices);
+        return;
+    }
+
+    const size_t         numPoints = points.size();
+    const int* const     adjacencyTable = adjacency.GetAdjacencyTable().cdata();
+    const size_t         numAdjacentPoints = std::min(numPoints, size_t(adjacency.GetNumPoints()));
+    const int* const     scenePoints = renderingToSceneFaceVtxIds.cdata();
+    const GfVec3f* const positions = points.cdata();
+
+    auto fillNormals = [=](size_t begin, size_t end) {
+        for (size_t v = begin; v < end; v++) {
+            const size_t point = size_t(scenePoints[v]);
+            GfVec3f      normal(0.0f);
+            if (point < numAdjacentPoints) {
+                const int* const adjacentPoints = adjacencyTable + adjacencyTable[point * 2];
+                const int        valence = adjacencyTable[point * 2 + 1];
+                const GfVec3f&   curr = positions[point];
+                for (int i = 0; i < valence; i++) {
+                    const size_t prev = size_t(adjacentPoints[i * 2]);
+                    const size_t next = size_t(adjacentPoints[i * 2 + 1]);
+                    if (prev < numPoints && next < numPoints) {
+                        // All meshes have been converted to rightHanded by the adjacency.
+                        normal += GfCross(positions[next] - curr, positions[prev] - curr);
+                    }
+                }
+                normal.Normalize();
+            }
+            vertexBuffer[v] = normal;
+        }
+    };
+
+    if (numVertices < sMinParallelSmoothNormalsCount) {
+        fillNormals(0, numVertices);
+    } else {
+        WorkParallelForN(numVertices, fillNormals);
+    }
+}
+
 } // namespace
 
 void HdVP2Mesh::_InitGPUCompute()
@@ -444,28 +680,51 @@ void HdVP2Mesh::_PrepareSharedVertexBuffers(
                         _rprimId.asChar(),
                         "HdVP2Mesh::computeAdjacency");
 
-                    _meshSharedData->_adjacency.reset(new Hd_VertexAdjacency());
-
-                    _meshSharedData->_adjacency->BuildAdjacencyTable(&_meshSharedData->_topology);
+                    _meshSharedData->_adjacency
+                        = HdVP2MeshTopologyCache::GetAdjacency(_meshSharedData->_topology);
                 }
 
-                // Only the points referenced by the topology are used to compute
-                // smooth normals.
-                VtValue normals(Hd_SmoothNormals::ComputeSmoothNormals(
-                    _meshSharedData->_adjacency.get(),
-                    _points(_meshSharedData->_primvarInfo).size(),
-                    _points(_meshSharedData->_primvarInfo).cdata()));
+                MProfilingScope profilingScope(
+                    HdVP2RenderDelegate::sProfilerCategory,
+                    MProfiler::kColorC_L2,
+                    _rprimId.asChar(),
+                    "HdVP2Mesh::computeSmoothNormals");
 
+                // The normals are written straight into the vertex buffer and not kept in
+                // the primvar source: the buffer is only filled again along with
+                // DirtySmoothNormals, which computes them again.
                 if (!normalsInfo) {
-                    _meshSharedData->_primvarInfo[HdTokens->normals]
-                        = std::make_unique<PrimvarInfo>(
-                            PrimvarSource(
-                                normals, HdInterpolationVertex, PrimvarSource::CPUCompute),
-                            nullptr);
+                    auto info = std::make_unique<PrimvarInfo>(
+                        PrimvarSource(VtValue(), HdInterpolationVertex, PrimvarSource::CPUCompute),
+                        nullptr);
+                    normalsInfo = info.get();
+                    _meshSharedData->_primvarInfo[HdTokens->normals] = std::move(info);
                 } else {
-                    normalsInfo->_source.data = normals;
+                    normalsInfo->_source.data = VtValue();
                     normalsInfo->_source.interpolation = HdInterpolationVertex;
                 }
+
+                MHWRender::MVertexBuffer* buffer = normalsInfo->_buffer.get();
+                if (!buffer) {
+                    const MHWRender::MVertexBufferDescriptor vbDesc(
+                        "", MHWRender::MGeometry::kNormal, MHWRender::MGeometry::kFloat, 3);
+
+                    buffer = new MHWRender::MVertexBuffer(vbDesc);
+                    normalsInfo->_buffer.reset(buffer);
+                }
+
+                void* bufferData = _meshSharedData->_numVertices > 0
+                    ? buffer->acquire(_meshSharedData->_numVertices, true)
+                    : nullptr;
+                if (bufferData) {
+                    _FillSmoothNormals(
+                        static_cast<GfVec3f*>(bufferData),
+                        _meshSharedData->_numVertices,
+                        _meshSharedData->_renderingToSceneFaceVtxIds,
+                        *_meshSharedData->_adjacency,
+                        _points(_meshSharedData->_primvarInfo));
+                }
+                _CommitMVertexBuffer(buffer, bufferData);
             }
         }
 
@@ -556,7 +815,7 @@ void HdVP2Mesh::_PrepareSharedVertexBuffers(
                     0,
                     _meshSharedData->_renderingToSceneFaceVtxIds,
                     _rprimId,
-                    _meshSharedData->_topology,
+                    _meshSharedData->_renderingTopology,
                     HdTokens->displayColor,
                     colorArray,
                     colorInterp);
@@ -567,7 +826,7 @@ void HdVP2Mesh::_PrepareSharedVertexBuffers(
                     3,
                     _meshSharedData->_renderingToSceneFaceVtxIds,
                     _rprimId,
-                    _meshSharedData->_topology,
+                    _meshSharedData->_renderingTopology,
                     HdTokens->displayOpacity,
                     alphaArray,
                     alphaInterp);
@@ -632,7 +891,7 @@ void HdVP2Mesh::_PrepareSharedVertexBuffers(
                             0,
                             _meshSharedData->_renderingToSceneFaceVtxIds,
                             _rprimId,
-                            _meshSharedData->_topology,
+                            _meshSharedData->_renderingTopology,
                             token,
                             value.UncheckedGet<VtFloatArray>(),
                             interp);
@@ -658,7 +917,7 @@ void HdVP2Mesh::_PrepareSharedVertexBuffers(
                             0,
                             _meshSharedData->_renderingToSceneFaceVtxIds,
                             _rprimId,
-                            _meshSharedData->_topology,
+                            _meshSharedData->_renderingTopology,
                             token,
                             value.UncheckedGet<VtVec2fArray>(),
                             interp);
@@ -684,7 +943,7 @@ void HdVP2Mesh::_PrepareSharedVertexBuffers(
                             0,
                             _meshSharedData->_renderingToSceneFaceVtxIds,
                             _rprimId,
-                            _meshSharedData->_topology,
+                            _meshSharedData->_renderingTopology,
                             token,
                             value.UncheckedGet<VtVec3fArray>(),
                             interp);
@@ -710,7 +969,7 @@ void HdVP2Mesh::_PrepareSharedVertexBuffers(
                             0,
                             _meshSharedData->_renderingToSceneFaceVtxIds,
                             _rprimId,
-                            _meshSharedData->_topology,
+                            _meshSharedData->_renderingTopology,
                             token,
                             value.UncheckedGet<VtVec4fArray>(),
                             interp);
@@ -744,7 +1003,7 @@ void HdVP2Mesh::_PrepareSharedVertexBuffers(
                             0,
                             _meshSharedData->_renderingToSceneFaceVtxIds,
                             _rprimId,
-                            _meshSharedData->_topology,
+                            _meshSharedData->_renderingTopology,
                             token,
                             convertedPrimvarData,
                             interp);
@@ -938,9 +1197,23 @@ void HdVP2Mesh::Sync(
         if (_meshSharedData->_isVertexLayoutUnshared != requireUnsharedVertexLayout) {
             _meshSharedData->_isVertexLayoutUnshared = requireUnsharedVertexLayout;
             _ResetRenderingTopology();
+        } else if (
+            requireUnsharedVertexLayout
+            && !(_meshSharedData->_renderingTopology == HdMeshTopology())
+            && (HdChangeTracker::IsPrimvarDirty(*dirtyBits, id, HdTokens->normals)
+                || HdChangeTracker::IsPrimvarDirty(*dirtyBits, id, HdTokens->primvar))) {
+            // The seams of the unshared vertex layout follow the values of the uniform
+            // and face-varying primvars. Only rebuild the index buffers if they moved.
+            const VtIntArray renderingFaceVtxIds
+                = _WeldFaceVertices(_meshSharedData->_topology, _meshSharedData->_primvarInfo);
+            if (renderingFaceVtxIds
+                != _meshSharedData->_renderingTopology.GetFaceVertexIndices()) {
+                _ResetRenderingTopology();
+            }
         }
     }
 
+    HdDirtyBits vertexBufferDirtyBits = *dirtyBits;
     if (_meshSharedData->_renderingTopology == HdMeshTopology()) {
         MProfilingScope profilingScope(
             HdVP2RenderDelegate::sProfilerCategory,
@@ -952,61 +1225,38 @@ void HdVP2Mesh::Sync(
         const VtIntArray&     faceVertexIndices = topology.GetFaceVertexIndices();
         const size_t          numFaceVertexIndices = faceVertexIndices.size();
 
-        VtIntArray newFaceVertexIndices;
-        newFaceVertexIndices.resize(numFaceVertexIndices);
-
-        if (_meshSharedData->_isVertexLayoutUnshared) {
-            _meshSharedData->_numVertices = numFaceVertexIndices;
-            _meshSharedData->_renderingToSceneFaceVtxIds = faceVertexIndices;
-            _meshSharedData->_sceneToRenderingFaceVtxIds.clear();
-            _meshSharedData->_sceneToRenderingFaceVtxIds.resize(topology.GetNumPoints(), -1);
-
-            for (size_t i = 0; i < numFaceVertexIndices; i++) {
-                const int sceneFaceVtxId = faceVertexIndices[i];
-                _meshSharedData->_sceneToRenderingFaceVtxIds[sceneFaceVtxId]
-                    = i; // could check if the existing value is -1, but it doesn't matter.
-                         // we just need to map to a vertex in the position buffer that has
-                         // the correct value.
-            }
-
-            // Fill with sequentially increasing values, starting from 0. The new
-            // face vertex indices will be used to populate index data for unshared
-            // vertex layout. Note that _FillPrimvarData assumes this sequence to
-            // be used for face-varying primvars and saves lookup and remapping
-            // with _renderingToSceneFaceVtxIds, so in case we change the array we
-            // should update _FillPrimvarData() code to remap indices correctly.
-            std::iota(newFaceVertexIndices.begin(), newFaceVertexIndices.end(), 0);
-        } else {
-            _meshSharedData->_numVertices = topology.GetNumPoints();
-            _meshSharedData->_renderingToSceneFaceVtxIds.clear();
-
-            // Allocate large enough memory with initial value of -1 to indicate
-            // the rendering face vertex index is not determined yet.
-            _meshSharedData->_sceneToRenderingFaceVtxIds.clear();
-            _meshSharedData->_sceneToRenderingFaceVtxIds.resize(numFaceVertexIndices, -1);
-            unsigned int sceneToRenderingFaceVtxIdsCount = 0;
-
-            // Sort vertices to avoid drastically jumping indices. Cache efficiency
-            // is important to fast rendering performance for dense mesh.
-            for (size_t i = 0; i < numFaceVertexIndices; i++) {
-                const int sceneFaceVtxId = faceVertexIndices[i];
-
-                int renderFaceVtxId = _meshSharedData->_sceneToRenderingFaceVtxIds[sceneFaceVtxId];
-                if (renderFaceVtxId < 0) {
-                    renderFaceVtxId = _meshSharedData->_renderingToSceneFaceVtxIds.size();
-                    _meshSharedData->_renderingToSceneFaceVtxIds.push_back(sceneFaceVtxId);
-
-                    _meshSharedData->_sceneToRenderingFaceVtxIds[sceneFaceVtxId] = renderFaceVtxId;
-                    sceneToRenderingFaceVtxIdsCount++;
-                }
+        // The layout is only computed again when the topology or the seams of
+        // the unshared vertex layout change: deforming the mesh only gathers the
+        // points through _renderingToSceneFaceVtxIds.
+        const VtIntArray newFaceVertexIndices
+            = _WeldFaceVertices(topology, _meshSharedData->_primvarInfo);
+
+        _meshSharedData->_renderingToSceneFaceVtxIds.clear();
+        _meshSharedData->_sceneToRenderingFaceVtxIds.clear();
+        _meshSharedData->_sceneToRenderingFaceVtxIds.resize(topology.GetNumPoints(), -1);
+
+        for (size_t i = 0; i < numFaceVertexIndices; i++) {
+            const int sceneFaceVtxId = faceVertexIndices[i];
+            const int renderFaceVtxId = newFaceVertexIndices[i];
 
-                newFaceVertexIndices[i] = renderFaceVtxId;
+            // Rendering vertices are numbered in order of first use.
+            if (renderFaceVtxId == int(_meshSharedData->_renderingToSceneFaceVtxIds.size())) {
+                _meshSharedData->_renderingToSceneFaceVtxIds.push_back(sceneFaceVtxId);
             }
 
-            _meshSharedData->_sceneToRenderingFaceVtxIds.resize(
-                sceneToRenderingFaceVtxIdsCount); // drop any extra -1 values.
+            // Any rendering vertex of the scene point has the correct position.
+            if (_meshSharedData->_sceneToRenderingFaceVtxIds[sceneFaceVtxId] < 0) {
+                _meshSharedData->_sceneToRenderingFaceVtxIds[sceneFaceVtxId] = renderFaceVtxId;
+            }
         }
 
+        _meshSharedData->_numVertices = _meshSharedData->_renderingToSceneFaceVtxIds.size();
+
+        // All the vertex buffers have to be filled for the new layout.
+        // The CPU smooth normals are not kept, they are computed again into their buffer.
+        vertexBufferDirtyBits |= HdChangeTracker::DirtyPoints | HdChangeTracker::DirtyNormals
+            | HdChangeTracker::DirtyPrimvar | (_customDirtyBitsInUse & DirtySmoothNormals);
+
         _meshSharedData->_renderingTopology = HdMeshTopology(
             topology.GetScheme(),
             topology.GetOrientation(),
@@ -1017,13 +1267,8 @@ void HdVP2Mesh::Sync(
 
         // All the render items to draw the shaded (Hull) style share the topology
         // calculation
-        HdMeshUtil meshUtil(&_meshSharedData->_renderingTopology, GetId());
-        _meshSharedData->_trianglesFaceVertexIndices.clear();
-        _meshSharedData->_primitiveParam.clear();
-        meshUtil.ComputeTriangleIndices(
-            &_meshSharedData->_trianglesFaceVertexIndices,
-            &_meshSharedData->_primitiveParam,
-            nullptr);
+        _meshSharedData->_triangulation = HdVP2MeshTopologyCache::GetTriangulation(
+            _meshSharedData->_renderingTopology, GetId());
 
         // Decide if we should use GPU compute, and set up compute objects for later user
 #ifdef HDVP2_ENABLE_GPU_COMPUTE
@@ -1040,7 +1285,7 @@ void HdVP2Mesh::Sync(
 #endif
     }
 
-    _PrepareSharedVertexBuffers(delegate, *dirtyBits, reprToken);
+    _PrepareSharedVertexBuffers(delegate, vertexBufferDirtyBits, reprToken);
 
 #if PXR_VERSION > 2111
     const TfToken& renderTag = GetRenderTag();
@@ -1643,6 +1888,13 @@ void HdVP2Mesh::_UpdateDrawItem(
             // _trianglesFaceVertexIndices has the full triangulation calculated in
             // _updateRepr. Find the triangles which represent faces in the matching
             // geom subset and add those triangles to the index buffer for renderItem.
+            // The triangulation is computed along with the rendering topology in
+            // _UpdateRepr, so a missing one is a coding error.
+            if (!TF_VERIFY(_meshSharedData->_triangulation != nullptr)) {
+                _meshSharedData->_triangulation
+                    = HdVP2MeshTopologyCache::GetTriangulation(topologyToUse, GetId());
+            }
+            const HdVP2MeshTriangulation& triangulation = *_meshSharedData->_triangulation;
 
             VtVec3iArray     trianglesFaceVertexIndices; // for this item only!
             std::vector<int> faceIds;
@@ -1651,17 +1903,17 @@ void HdVP2Mesh::_UpdateDrawItem(
                 // If there is no mapping from face to render item or if this is the default
                 // material item then all the faces are on this render item. VtArray has
                 // copy-on-write semantics so this is fast
-                trianglesFaceVertexIndices = _meshSharedData->_trianglesFaceVertexIndices;
+                trianglesFaceVertexIndices = triangulation._trianglesFaceVertexIndices;
             } else {
-                for (size_t triangleId = 0; triangleId < _meshSharedData->_primitiveParam.size();
+                for (size_t triangleId = 0; triangleId < triangulation._primitiveParam.size();
                      triangleId++) {
                     size_t faceId = HdMeshUtil::DecodeFaceIndexFromCoarseFaceParam(
-                        _meshSharedData->_primitiveParam[triangleId]);
+                        triangulation._primitiveParam[triangleId]);
                     if (_meshSharedData->_faceIdToGeomSubsetId[faceId]
                         == renderItemData._geomSubset.id) {
                         faceIds.push_back(faceId);
                         trianglesFaceVertexIndices.push_back(
-                            _meshSharedData->_trianglesFaceVertexIndices[triangleId]);
+                            triangulation._trianglesFaceVertexIndices[triangleId]);
                     }
                 }
             }
@@ -18,6 +18,7 @@
 
 #include "draw_item.h"
 #include "mayaPrimCommon.h"
+#include "meshTopologyCache.h"
 #include "meshViewportCompute.h"
 #include "primvarInfo.h"
 
@@ -49,14 +50,17 @@ struct HdVP2MeshSharedData
     //! copy.
     HdMeshTopology _topology;
 
-    //! Adjacency based off of _topology
+    //! Adjacency based off of _topology, shared with the meshes having the same
+    //! topology.
     Hd_VertexAdjacencySharedPtr _adjacency;
 
     //! The rendering topology is to create unshared or sorted vertice layout
     //! for efficient GPU rendering.
     HdMeshTopology _renderingTopology;
 
-    //! Defines whether or not the vertex layout used for drawing is unshared
+    //! Defines whether or not the vertex layout used for drawing is unshared,
+    //! i.e. whether the scene points are split at the seams of uniform or
+    //! face-varying primvars.
     bool _isVertexLayoutUnshared { false };
 
     //! An array to store original scene face vertex index of each rendering
@@ -67,12 +71,9 @@ struct HdVP2MeshSharedData
     //! face vertex index.
     std::vector<int> _sceneToRenderingFaceVtxIds;
 
-    //! triangulation of the _renderingTopology
-    VtVec3iArray _trianglesFaceVertexIndices;
-
-    //! encoded triangleId to faceId of _trianglesFaceVertexIndices, use
-    //! HdMeshUtil::DecodeFaceIndexFromCoarseFaceParam when accessing.
-    VtIntArray _primitiveParam;
+    //! triangulation of the _renderingTopology, shared with the meshes having
+    //! the same rendering topology.
+    HdVP2MeshTriangulationSharedPtr _triangulation;
 
     //! Map from the original topology faceId to the void* pointer to
     //! the MRenderItem that face is a part of
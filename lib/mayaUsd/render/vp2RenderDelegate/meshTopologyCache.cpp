@@ -0,0 +1,133 @@
+//
+// Copyright 2024 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "meshTopologyCache.h"
+
+#include <pxr/imaging/hd/meshUtil.h>
+
+#include <algorithm>
+#include <mutex>
+#include <unordered_map>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+namespace {
+
+//! Minimum number of cache entries before removing the expired ones.
+constexpr size_t kMinRemovalSize = 64;
+
+/*! \brief  Weak references to the values computed from mesh topologies, by topology hash.
+ */
+template <class VALUE> class _TopologyKeyedCache
+{
+public:
+    template <class BUILD>
+    std::shared_ptr<VALUE> Get(const HdMeshTopology& topology, const BUILD& build)
+    {
+        const HdTopology::ID    hash = topology.ComputeHash();
+        std::shared_ptr<_Entry> entry;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+
+            const auto range = _entries.equal_range(hash);
+            for (auto it = range.first; it != range.second && !entry;) {
+                std::shared_ptr<_Entry> candidate = it->second.lock();
+                if (!candidate) {
+                    it = _entries.erase(it);
+                } else {
+                    if (candidate->_topology == topology) {
+                        entry = std::move(candidate);
+                    }
+                    ++it;
+                }
+            }
+
+            if (!entry) {
+                _RemoveExpiredEntries();
+
+                entry = std::make_shared<_Entry>();
+                entry->_topology = topology;
+                _entries.emplace(hash, entry);
+            }
+        }
+
+        // Build outside of the cache lock, so that different topologies are built
+        // concurrently.
+        std::call_once(entry->_built, [&]() { build(entry->_topology, entry->_value); });
+
+        return std::shared_ptr<VALUE>(entry, &entry->_value);
+    }
+
+private:
+    struct _Entry
+    {
+        HdMeshTopology _topology;
+        std::once_flag _built;
+        VALUE          _value;
+    };
+
+    //! Removes the entries of the topologies which are not used anymore, once the number
+    //! of entries doubled since the last removal.
+    void _RemoveExpiredEntries()
+    {
+        if (_entries.size() < _removalSize) {
+            return;
+        }
+
+        for (auto it = _entries.begin(); it != _entries.end();) {
+            if (it->second.expired()) {
+                it = _entries.erase(it);
+            } else {
+                ++it;
+            }
+        }
+        _removalSize = std::max(kMinRemovalSize, 2 * _entries.size());
+    }
+
+    std::mutex                                                     _mutex;
+    std::unordered_multimap<HdTopology::ID, std::weak_ptr<_Entry>> _entries;
+    size_t _removalSize { kMinRemovalSize };
+};
+
+_TopologyKeyedCache<Hd_VertexAdjacency>     sAdjacencyCache;
+_TopologyKeyedCache<HdVP2MeshTriangulation> sTriangulationCache;
+
+} // namespace
+
+/*static*/
+Hd_VertexAdjacencySharedPtr HdVP2MeshTopologyCache::GetAdjacency(const HdMeshTopology& topology)
+{
+    return sAdjacencyCache.Get(
+        topology, [](const HdMeshTopology& entryTopology, Hd_VertexAdjacency& adjacency) {
+            adjacency.BuildAdjacencyTable(&entryTopology);
+        });
+}
+
+/*static*/
+HdVP2MeshTriangulationSharedPtr
+HdVP2MeshTopologyCache::GetTriangulation(const HdMeshTopology& topology, const SdfPath& id)
+{
+    return sTriangulationCache.Get(
+        topology,
+        [&id](const HdMeshTopology& entryTopology, HdVP2MeshTriangulation& triangulation) {
+            HdMeshUtil meshUtil(&entryTopology, id);
+            meshUtil.ComputeTriangleIndices(
+                &triangulation._trianglesFaceVertexIndices,
+                &triangulation._primitiveParam,
+                nullptr);
+        });
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
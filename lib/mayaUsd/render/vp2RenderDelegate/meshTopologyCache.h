@@ -0,0 +1,68 @@
+//
+// Copyright 2024 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef HD_VP2_MESH_TOPOLOGY_CACHE
+#define HD_VP2_MESH_TOPOLOGY_CACHE
+
+#include <pxr/base/vt/array.h>
+#include <pxr/base/vt/types.h>
+#include <pxr/imaging/hd/meshTopology.h>
+#include <pxr/imaging/hd/vertexAdjacency.h>
+#include <pxr/pxr.h>
+#include <pxr/usd/sdf/path.h>
+
+#include <memory>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+/*! \brief  Triangulation of a mesh topology.
+    \class  HdVP2MeshTriangulation
+*/
+struct HdVP2MeshTriangulation
+{
+    //! Triangle face vertex indices, see HdMeshUtil::ComputeTriangleIndices().
+    VtVec3iArray _trianglesFaceVertexIndices;
+
+    //! encoded triangleId to faceId of _trianglesFaceVertexIndices, use
+    //! HdMeshUtil::DecodeFaceIndexFromCoarseFaceParam when accessing.
+    VtIntArray _primitiveParam;
+};
+
+using HdVP2MeshTriangulationSharedPtr = std::shared_ptr<const HdVP2MeshTriangulation>;
+
+/*! \brief  Thread-safe cache of the data computed from mesh topologies, shared by
+            all the meshes with identical topologies.
+    \class  HdVP2MeshTopologyCache
+
+    Crowds and set dressing often have many meshes with identical topologies which
+    are not instanced. The data is computed by the first mesh requesting it, while
+    the other meshes with the same topology wait for it. The data is immutable and
+    the cache only keeps weak references to it, so it is released along with the
+    last mesh using it.
+*/
+class HdVP2MeshTopologyCache
+{
+public:
+    //! Returns the vertex adjacency of the topology, which must not be modified.
+    static Hd_VertexAdjacencySharedPtr GetAdjacency(const HdMeshTopology& topology);
+
+    //! Returns the triangulation of the topology. The id is only used to report errors.
+    static HdVP2MeshTriangulationSharedPtr
+    GetTriangulation(const HdMeshTopology& topology, const SdfPath& id);
+};
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif // HD_VP2_MESH_TOPOLOGY_CACHE
@@ -19,6 +19,7 @@
 #ifdef HDVP2_ENABLE_GPU_COMPUTE
 
 #include "mesh.h"
+#include "meshTopologyCache.h"
 #include "render_delegate.h"
 
 #include <mayaUsd/render/vp2RenderDelegate/proxyRenderDelegate.h>
@@ -355,10 +356,10 @@ void MeshViewportCompute::createConsolidatedAdjacency()
         MProfiler::kColorD_L2,
         "MeshViewportCompute:createConsolidatedAdjacency");
 
-    Hd_VertexAdjacency adjacency;
-    adjacency.BuildAdjacencyTable(&_meshSharedData->_topology);
+    const Hd_VertexAdjacencySharedPtr adjacency
+        = HdVP2MeshTopologyCache::GetAdjacency(_meshSharedData->_topology);
 
-    const VtIntArray& adjacencyTable = adjacency.GetAdjacencyTable();
+    const VtIntArray& adjacencyTable = adjacency->GetAdjacencyTable();
     size_t            adjacencyBufferSize = adjacencyTable.size();
     int*              adjCopy = new int[adjacencyBufferSize];
     memcpy(adjCopy, adjacencyTable.data(), adjacencyBufferSize * sizeof(int));
@@ -1200,7 +1200,17 @@ void ProxyRenderDelegate::_Execute(const MHWRender::MFrameContext& frameContext)
             }
         }
 
+#ifdef WANT_MATERIALX_BUILD
+        // Generate the MaterialX fragments of the dirty materials concurrently, rather than one
+        // at a time during the sync of the materials.
+        HdVP2Material::PrepareMaterialXFragments(*_renderIndex, _sceneDelegate.get());
+#endif
+
         _engine.Execute(_renderIndex.get(), &_dummyTasks);
+
+#ifdef WANT_MATERIALX_BUILD
+        HdVP2Material::ReleaseMaterialXFragments();
+#endif
     }
 }
 
@@ -0,0 +1,62 @@
+//
+// Copyright 2024 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "textureLoadingQueue.h"
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+bool HdVP2TextureLoadingQueue::Push(const std::string& path, int priority)
+{
+    auto found = _entryByPath.find(path);
+    if (found == _entryByPath.end()) {
+        const _Entry entry { priority, _sequence++, path };
+        _entries.insert(entry);
+        _entryByPath.emplace(path, entry);
+        return true;
+    }
+
+    _Entry& entry = found->second;
+    if (entry.priority != priority) {
+        _entries.erase(entry);
+        entry.priority = priority;
+        _entries.insert(entry);
+    }
+    return false;
+}
+
+bool HdVP2TextureLoadingQueue::Pop(std::string* path)
+{
+    if (_entries.empty()) {
+        return false;
+    }
+
+    *path = _entries.begin()->path;
+    _entries.erase(_entries.begin());
+    _entryByPath.erase(*path);
+    return true;
+}
+
+bool HdVP2TextureLoadingQueue::IsQueued(const std::string& path) const
+{
+    return _entryByPath.find(path) != _entryByPath.end();
+}
+
+void HdVP2TextureLoadingQueue::Clear()
+{
+    _entries.clear();
+    _entryByPath.clear();
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
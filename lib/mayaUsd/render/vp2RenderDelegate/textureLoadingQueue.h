@@ -0,0 +1,81 @@
+//
+// Copyright 2024 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef HD_VP2_TEXTURE_LOADING_QUEUE
+#define HD_VP2_TEXTURE_LOADING_QUEUE
+
+#include <mayaUsd/base/api.h>
+
+#include <pxr/pxr.h>
+
+#include <cstddef>
+#include <set>
+#include <string>
+#include <unordered_map>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+/*! \brief  Order in which the asynchronous texture loading decodes the queued textures.
+
+    Textures with the highest priority come first, then the first queued. Changing the
+    priority of a queued texture moves it up or down the queue, but keeps its rank among the
+    textures of its new priority. Not thread-safe.
+*/
+class MAYAUSD_CORE_PUBLIC HdVP2TextureLoadingQueue
+{
+public:
+    //! Queue the texture with the priority, or move it to the priority if it is already
+    //! queued. Returns false if the texture was already queued.
+    bool Push(const std::string& path, int priority);
+
+    //! Remove the first texture of the queue. Returns false if the queue is empty.
+    bool Pop(std::string* path);
+
+    //! Get whether the texture is queued.
+    bool IsQueued(const std::string& path) const;
+
+    //! Get the number of queued textures.
+    size_t GetSize() const { return _entries.size(); }
+
+    //! Get whether no texture is queued.
+    bool IsEmpty() const { return _entries.empty(); }
+
+    //! Remove all the textures of the queue.
+    void Clear();
+
+private:
+    struct _Entry
+    {
+        int         priority;
+        size_t      sequence;
+        std::string path;
+
+        bool operator<(const _Entry& other) const
+        {
+            if (priority != other.priority) {
+                return priority > other.priority;
+            }
+            return sequence < other.sequence;
+        }
+    };
+
+    std::set<_Entry>                        _entries;     //!< Queued textures, in order
+    std::unordered_map<std::string, _Entry> _entryByPath; //!< Queued textures, by path
+    size_t                                  _sequence { 0 };
+};
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif // HD_VP2_TEXTURE_LOADING_QUEUE
@@ -18,6 +18,7 @@
 #include <mayaUsd/ufe/Global.h>
 #include <mayaUsd/ufe/Utils.h>
 
+#include <usdUfe/ufe/UsdHierarchy.h>
 #include <usdUfe/ufe/UsdUndoCreateGroupCommand.h>
 #include <usdUfe/ufe/UsdUndoInsertChildCommand.h>
 #include <usdUfe/ufe/UsdUndoReorderCommand.h>
@@ -130,21 +131,31 @@ Ufe::SceneItem::Ptr ProxyShapeHierarchy::sceneItem() const { return fItem; }
 
 bool ProxyShapeHierarchy::hasChildren() const
 {
-    // We have an extra logic in createUFEChildList to remap and filter
-    // prims. Going this direction is more costly, but easier to maintain.
-    //
-    // I don't have data that proves we need to worry about performance in here,
-    // so going after maintainability.
-    return !children().empty();
+    const UsdPrim& rootPrim = getUsdRootPrim();
+    if (!rootPrim.IsValid())
+        return false;
+
+    // The outliner calls this for every row: do not create the scene items
+    // of all the children like children() does.
+    return hasUFEChildren(getUSDFilteredChildren(rootPrim), true /*filterInactive*/);
 }
 
 bool ProxyShapeHierarchy::hasFilteredChildren(const ChildFilter& childFilter) const
 {
-    // We have an extra logic in createUFEChildList to remap and filter
-    // prims. Going this direction is more costly, but easier to maintain.
-    //
-    // I don't have data that proves we need to worry about performance in here,
-    // so going after maintainability.
+    const UsdPrim& rootPrim = getUsdRootPrim();
+    if (!rootPrim.IsValid())
+        return false;
+
+    // Note: for now the only child filter flag we support is "Inactive Prims".
+    //       See UsdHierarchyHandler::childFilter()
+    if ((childFilter.size() == 1) && (childFilter.front().name == "InactivePrims")) {
+        // See uniqueChildName() for explanation of USD filter predicate.
+        const bool             showInactive = childFilter.front().value;
+        Usd_PrimFlagsPredicate flags
+            = showInactive ? UsdPrimIsDefined && !UsdPrimIsAbstract : MayaUsdPrimDefaultPredicate;
+        return hasUFEChildren(getUSDFilteredChildren(rootPrim, flags), !showInactive);
+    }
+
     return !filteredChildren(childFilter).empty();
 }
 
@@ -157,12 +168,7 @@ bool ProxyShapeHierarchy::hasChildren() const
     if (!rootPrim.IsValid())
         return false;
 
-    // We have an extra logic in createUFEChildList to remap and filter
-    // prims. Going this direction is more costly, but easier to maintain.
-    //
-    // I don't have data that proves we need to worry about performance in here,
-    // so going after maintainability.
-    return !createUFEChildList(getUSDFilteredChildren(rootPrim), false /*filterInactive*/).empty();
+    return hasUFEChildren(getUSDFilteredChildren(rootPrim), false /*filterInactive*/);
 }
 
 #endif
@@ -231,6 +237,33 @@ ProxyShapeHierarchy::createUFEChildList(const UsdPrimSiblingRange& range, bool f
     return children;
 }
 
+bool ProxyShapeHierarchy::hasUFEChildren(
+    const UsdPrimSiblingRange& range,
+    bool                       filterInactive) const
+{
+    if (range.empty())
+        return false;
+
+    // Without filtering, createUFEChildList() lists an item for every child.
+    if (!filterInactive)
+        return true;
+
+    if (UsdUfe::UsdHierarchy::hasActiveChild(getUsdRootPrim()))
+        return true;
+
+#ifdef UFE_V3_FEATURES_AVAILABLE
+    // Inactive children are only listed when they were pulled to Maya.
+    std::string dagPathStr;
+    for (const auto& child : range) {
+        if (!child.IsActive() && MayaUsd::readPullInformation(child, dagPathStr)
+            && Ufe::Hierarchy::createItem(Ufe::PathString::path(dagPathStr))) {
+            return true;
+        }
+    }
+#endif
+    return false;
+}
+
 Ufe::SceneItem::Ptr ProxyShapeHierarchy::parent() const { return fMayaHierarchy->parent(); }
 
 Ufe::InsertChildCommand::Ptr ProxyShapeHierarchy::insertChildCmd(
@@ -89,6 +89,7 @@ private:
     const PXR_NS::UsdPrim& getUsdRootPrim() const;
     Ufe::SceneItemList
     createUFEChildList(const PXR_NS::UsdPrimSiblingRange& range, bool filterInactive) const;
+    bool hasUFEChildren(const PXR_NS::UsdPrimSiblingRange& range, bool filterInactive) const;
 
 private:
     Ufe::SceneItem::Ptr        fItem;
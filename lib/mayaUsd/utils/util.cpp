@@ -25,12 +25,14 @@
 #include <pxr/base/gf/vec4f.h>
 #include <pxr/base/js/json.h>
 #include <pxr/base/tf/hashmap.h>
+#include <pxr/base/tf/span.h>
 #include <pxr/base/tf/staticTokens.h>
 #include <pxr/base/tf/stringUtils.h>
 #include <pxr/base/tf/token.h>
 #include <pxr/base/vt/array.h>
 #include <pxr/base/vt/types.h>
 #include <pxr/base/vt/value.h>
+#include <pxr/base/work/loops.h>
 #include <pxr/usd/sdf/path.h>
 #include <pxr/usd/sdf/tokens.h>
 #include <pxr/usd/sdr/registry.h>
@@ -61,10 +63,10 @@
 #include <maya/MFnStandardSurfaceShader.h>
 #include <maya/MFnTypedAttribute.h>
 #include <maya/MGlobal.h>
+#include <maya/MIntArray.h>
 #include <maya/MItDag.h>
 #include <maya/MItDependencyGraph.h>
 #include <maya/MItDependencyNodes.h>
-#include <maya/MItMeshFaceVertex.h>
 #include <maya/MItMeshPolygon.h>
 #include <maya/MMatrix.h>
 #include <maya/MObject.h>
@@ -78,11 +80,13 @@
 
 #include <boost/functional/hash.hpp>
 
+#include <algorithm>
+#include <atomic>
 #include <cctype>
+#include <memory>
 #include <regex>
 #include <sstream>
 #include <string>
-#include <unordered_map>
 #include <vector>
 
 PXR_NAMESPACE_USING_DIRECTIVE
@@ -117,18 +121,6 @@ bool shouldAddToSet(const MDagPath& toAdd, const UsdMayaUtil::MDagPathSet& dagPa
 
     return true;
 }
-
-bool GetMayaExtent(const UsdPrim& prim, GfRange3d& range)
-{
-    if (prim.IsA<UsdGeomCamera>()) {
-        // UsdGeomCamera, not being a UsdGeomBoundable, doesn't provide any extent information.
-        // So let's add Maya camera dimensions here
-        range = GfRange3d(GfVec3d(-0.4f, -0.3f, -2.0f), GfVec3d(0.4f, 1.0f, 2.0f));
-        return true;
-    }
-
-    return false;
-}
 } // namespace
 
 double UsdMayaUtil::ConvertMDistanceUnitToUsdGeomLinearUnit(const MDistance::Unit mdistanceUnit)
@@ -1034,6 +1026,24 @@ template <typename T> struct _ValuesEqual
     bool operator()(const T& a, const T& b) const { return GfIsClose(a, b, 1e-9); }
 };
 
+// Arrays with fewer elements are processed on the calling thread.
+constexpr size_t _kMinParallelPrimvarSize = 1 << 16;
+
+template <typename Fn> void _ForEachChunk(size_t count, const Fn& fn)
+{
+    if (count < _kMinParallelPrimvarSize) {
+        fn(0, count);
+    } else {
+        WorkParallelForN(count, fn);
+    }
+}
+
+TfSpan<const int> _AsSpan(MIntArray& array)
+{
+    const unsigned int length = array.length();
+    return TfSpan<const int>(length > 0 ? &array[0] : nullptr, length);
+}
+
 } // anonymous namespace
 
 template <typename T>
@@ -1048,40 +1058,69 @@ static void _MergeEquivalentIndexedValues(VtArray<T>* valueData, VtIntArray* ass
         return;
     }
 
-    // We maintain a map of values to that value's index in our uniqueValues
-    // array.
-    std::unordered_map<T, size_t, _ValuesHash<T>, _ValuesEqual<T>> valuesMap;
-    VtArray<T>                                                     uniqueValues;
-    VtIntArray                                                     uniqueIndices;
+    const T* const   values = valueData->cdata();
+    const size_t     numIndices = assignmentIndices->size();
+    const int* const indices = assignmentIndices->cdata();
 
-    for (int index : *assignmentIndices) {
+    // Hashing dominates for wide values, so hash them all upfront.
+    std::vector<size_t> hashes(numValues);
+    _ForEachChunk(numValues, [values, &hashes](size_t begin, size_t end) {
+        const _ValuesHash<T> hash;
+        for (size_t i = begin; i < end; ++i) {
+            hashes[i] = hash(values[i]);
+        }
+    });
+
+    // Open-addressing hash table of indices in uniqueValues, with linear
+    // probing. It is at most half full, since there cannot be more unique
+    // values than values.
+    size_t tableSize = 2;
+    while (tableSize < 2 * numValues) {
+        tableSize *= 2;
+    }
+    const size_t     tableMask = tableSize - 1;
+    std::vector<int> table(tableSize, -1);
+
+    // Value indices are often shared between face-vertices, so remember
+    // which unique value each value index maps to.
+    std::vector<int> uniqueIndexOfValue(numValues, -1);
+
+    const _ValuesEqual<T> equal;
+    VtArray<T>            uniqueValues;
+    uniqueValues.reserve(numValues);
+    VtIntArray uniqueIndices(numIndices);
+    int*       uniqueIndicesData = uniqueIndices.data();
+
+    for (size_t i = 0; i < numIndices; ++i) {
+        const int index = indices[i];
         if (index < 0 || static_cast<size_t>(index) >= numValues) {
             // This is an unassigned or otherwise unknown index, so just keep it.
-            uniqueIndices.push_back(index);
+            uniqueIndicesData[i] = index;
             continue;
         }
 
-        const T value = (*valueData)[index];
-
-        int uniqueIndex = -1;
-
-        auto inserted = valuesMap.insert(std::pair<T, size_t>(value, uniqueValues.size()));
-        if (inserted.second) {
-            // This is a new value, so add it to the array.
-            uniqueValues.push_back(value);
-            uniqueIndex = uniqueValues.size() - 1;
-        } else {
-            // This is an existing value, so re-use the original's index.
-            uniqueIndex = inserted.first->second;
+        int& uniqueIndex = uniqueIndexOfValue[index];
+        if (uniqueIndex < 0) {
+            const T& value = values[index];
+            size_t   slot = hashes[index] & tableMask;
+            while (table[slot] >= 0 && !equal(uniqueValues[table[slot]], value)) {
+                slot = (slot + 1) & tableMask;
+            }
+            if (table[slot] < 0) {
+                // This is a new value, so add it to the array.
+                table[slot] = static_cast<int>(uniqueValues.size());
+                uniqueValues.push_back(value);
+            }
+            uniqueIndex = table[slot];
         }
 
-        uniqueIndices.push_back(uniqueIndex);
+        uniqueIndicesData[i] = uniqueIndex;
     }
 
     // If we reduced the number of values by merging, copy the results back.
     if (uniqueValues.size() < numValues) {
-        (*valueData) = uniqueValues;
-        (*assignmentIndices) = uniqueIndices;
+        valueData->swap(uniqueValues);
+        assignmentIndices->swap(uniqueIndices);
     }
 }
 
@@ -1122,68 +1161,155 @@ void UsdMayaUtil::CompressFaceVaryingPrimvarIndices(
         return;
     }
 
+    MIntArray faceVertexCounts;
+    MIntArray faceVertexIndices;
+    if (!mesh.getVertices(faceVertexCounts, faceVertexIndices)) {
+        return;
+    }
+
+    CompressFaceVaryingPrimvarIndices(
+        _AsSpan(faceVertexCounts),
+        _AsSpan(faceVertexIndices),
+        mesh.numVertices(),
+        interpolation,
+        assignmentIndices);
+}
+
+void UsdMayaUtil::CompressFaceVaryingPrimvarIndices(
+    TfSpan<const int> faceVertexCounts,
+    TfSpan<const int> faceVertexIndices,
+    int               numVertices,
+    TfToken*          interpolation,
+    VtIntArray*       assignmentIndices)
+{
+    if (!interpolation || !assignmentIndices || assignmentIndices->size() == 0u) {
+        return;
+    }
+
+    const size_t numFaceVertices = faceVertexIndices.size();
+    if (assignmentIndices->size() != numFaceVertices) {
+        TF_CODING_ERROR(
+            "Unequal sizes for face-vertices (%zu) and assignments (%zu)",
+            numFaceVertices,
+            assignmentIndices->size());
+        return;
+    }
+
+    const size_t        numFaces = faceVertexCounts.size();
+    std::vector<size_t> faceOffsets(numFaces + 1, 0u);
+    for (size_t face = 0; face < numFaces; ++face) {
+        faceOffsets[face + 1] = faceOffsets[face] + std::max(faceVertexCounts[face], 0);
+    }
+    if (faceOffsets[numFaces] != numFaceVertices) {
+        TF_CODING_ERROR(
+            "Face vertex counts add up to %zu instead of %zu",
+            faceOffsets[numFaces],
+            numFaceVertices);
+        return;
+    }
+
     // Use -2 as the initial "un-stored" sentinel value, since -1 is the
     // default unauthored value index for primvars.
-    int        numPolygons = mesh.numPolygons();
-    VtIntArray uniformAssignments;
-    uniformAssignments.assign((size_t)numPolygons, -2);
+    const int  unstored = -2;
+    VtIntArray uniformAssignments(numFaces);
+    int*       uniformData = uniformAssignments.data();
 
-    int        numVertices = mesh.numVertices();
-    VtIntArray vertexAssignments;
-    vertexAssignments.assign((size_t)numVertices, -2);
+    // Vertices are shared between faces processed by different threads.
+    const size_t numVerts = static_cast<size_t>(std::max(numVertices, 0));
+    std::unique_ptr<std::atomic_int[]> vertexAssignments(new std::atomic_int[numVerts]);
+    _ForEachChunk(numVerts, [&vertexAssignments, unstored](size_t begin, size_t end) {
+        for (size_t vertex = begin; vertex < end; ++vertex) {
+            vertexAssignments[vertex].store(unstored, std::memory_order_relaxed);
+        }
+    });
 
     // We assume that the data is constant/uniform/vertex until we can
     // prove otherwise that two components have differing values.
-    bool isConstant = true;
-    bool isUniform = true;
-    bool isVertex = true;
+    std::atomic_bool isConstant { true };
+    std::atomic_bool isUniform { true };
+    std::atomic_bool isVertex { true };
+
+    const int* const assigned = assignmentIndices->cdata();
+    const int        firstAssigned = assigned[0];
+
+    const auto compressFaces = [&](size_t beginFace, size_t endFace) {
+        bool chunkIsConstant = isConstant.load(std::memory_order_relaxed);
+        bool chunkIsUniform = isUniform.load(std::memory_order_relaxed);
+        bool chunkIsVertex = isVertex.load(std::memory_order_relaxed);
+
+        for (size_t face = beginFace; face < endFace; ++face) {
+            if (!chunkIsConstant && !chunkIsUniform && !chunkIsVertex) {
+                // No compression will be possible, so stop trying.
+                break;
+            }
 
-    MItMeshFaceVertex itFV(mesh.object());
-    unsigned int      fvi = 0;
-    for (itFV.reset(); !itFV.isDone(); itFV.next(), ++fvi) {
-        int faceIndex = itFV.faceId();
-        int vertexIndex = itFV.vertId();
+            const size_t beginFV = faceOffsets[face];
+            const size_t endFV = faceOffsets[face + 1];
+            if (beginFV == endFV) {
+                uniformData[face] = unstored;
+                continue;
+            }
 
-        int assignedIndex = (*assignmentIndices)[fvi];
+            const int faceAssigned = assigned[beginFV];
+            uniformData[face] = faceAssigned;
 
-        if (isConstant) {
-            if (assignedIndex != (*assignmentIndices)[0]) {
-                isConstant = false;
-            }
-        }
+            for (size_t fvi = beginFV; fvi < endFV; ++fvi) {
+                const int assignedIndex = assigned[fvi];
+                chunkIsConstant = chunkIsConstant && assignedIndex == firstAssigned;
+                chunkIsUniform = chunkIsUniform && assignedIndex == faceAssigned;
 
-        if (isUniform) {
-            if (uniformAssignments[faceIndex] < -1) {
-                // No value for this face yet, so store one.
-                uniformAssignments[faceIndex] = assignedIndex;
-            } else if (assignedIndex != uniformAssignments[faceIndex]) {
-                isUniform = false;
+                if (chunkIsVertex) {
+                    const int vertex = faceVertexIndices[fvi];
+                    if (vertex < 0 || static_cast<size_t>(vertex) >= numVerts) {
+                        chunkIsVertex = false;
+                        continue;
+                    }
+                    // Store a value if this vertex has none yet.
+                    int stored = unstored;
+                    if (!vertexAssignments[vertex].compare_exchange_strong(
+                            stored, assignedIndex, std::memory_order_relaxed)
+                        && stored != assignedIndex) {
+                        chunkIsVertex = false;
+                    }
+                }
             }
-        }
 
-        if (isVertex) {
-            if (vertexAssignments[vertexIndex] < -1) {
-                // No value for this vertex yet, so store one.
-                vertexAssignments[vertexIndex] = assignedIndex;
-            } else if (assignedIndex != vertexAssignments[vertexIndex]) {
-                isVertex = false;
-            }
+            // Stop early when another chunk already proved otherwise.
+            chunkIsConstant = chunkIsConstant && isConstant.load(std::memory_order_relaxed);
+            chunkIsUniform = chunkIsUniform && isUniform.load(std::memory_order_relaxed);
+            chunkIsVertex = chunkIsVertex && isVertex.load(std::memory_order_relaxed);
         }
 
-        if (!isConstant && !isUniform && !isVertex) {
-            // No compression will be possible, so stop trying.
-            break;
+        if (!chunkIsConstant) {
+            isConstant.store(false, std::memory_order_relaxed);
+        }
+        if (!chunkIsUniform) {
+            isUniform.store(false, std::memory_order_relaxed);
         }
+        if (!chunkIsVertex) {
+            isVertex.store(false, std::memory_order_relaxed);
+        }
+    };
+
+    if (numFaceVertices < _kMinParallelPrimvarSize) {
+        compressFaces(0, numFaces);
+    } else {
+        WorkParallelForN(numFaces, compressFaces);
     }
 
     if (isConstant) {
         assignmentIndices->resize(1);
         *interpolation = UsdGeomTokens->constant;
     } else if (isUniform) {
-        *assignmentIndices = uniformAssignments;
+        assignmentIndices->swap(uniformAssignments);
         *interpolation = UsdGeomTokens->uniform;
     } else if (isVertex) {
-        *assignmentIndices = vertexAssignments;
+        VtIntArray vertexAssignmentsData(numVerts);
+        int*       vertexData = vertexAssignmentsData.data();
+        for (size_t vertex = 0; vertex < numVerts; ++vertex) {
+            vertexData[vertex] = vertexAssignments[vertex].load(std::memory_order_relaxed);
+        }
+        assignmentIndices->swap(vertexAssignmentsData);
         *interpolation = UsdGeomTokens->vertex;
     } else {
         *interpolation = UsdGeomTokens->faceVarying;
@@ -2515,6 +2641,18 @@ MString UsdMayaUtil::GetCurrentSceneFilePath()
     return currentSceneFilePath;
 }
 
+bool UsdMayaUtil::GetMayaExtent(const UsdPrim& prim, GfRange3d& range)
+{
+    if (prim.IsA<UsdGeomCamera>()) {
+        // UsdGeomCamera, not being a UsdGeomBoundable, doesn't provide any extent information.
+        // So let's add Maya camera dimensions here
+        range = GfRange3d(GfVec3d(-0.4f, -0.3f, -2.0f), GfVec3d(0.4f, 1.0f, 2.0f));
+        return true;
+    }
+
+    return false;
+}
+
 void UsdMayaUtil::AddMayaExtents(GfBBox3d& bbox, const UsdPrim& root, const UsdTimeCode time)
 {
     GfRange3d localExtents;
@@ -21,11 +21,13 @@
 
 #include <usdUfe/utils/Utils.h>
 
+#include <pxr/base/gf/range3d.h>
 #include <pxr/base/gf/vec2f.h>
 #include <pxr/base/gf/vec3f.h>
 #include <pxr/base/gf/vec4f.h>
 #include <pxr/base/tf/declarePtrs.h>
 #include <pxr/base/tf/refPtr.h>
+#include <pxr/base/tf/span.h>
 #include <pxr/base/tf/token.h>
 #include <pxr/base/vt/dictionary.h>
 #include <pxr/base/vt/types.h>
@@ -370,6 +372,18 @@ void CompressFaceVaryingPrimvarIndices(
     PXR_NS::TfToken*    interpolation,
     PXR_NS::VtIntArray* assignmentIndices);
 
+/// Attempt to compress faceVarying primvar indices to uniform, vertex, or
+/// constant interpolation if possible, for a mesh of \p numVertices vertices
+/// with the \p faceVertexCounts and \p faceVertexIndices returned by
+/// MFnMesh::getVertices(). Large meshes are processed in parallel.
+MAYAUSD_CORE_PUBLIC
+void CompressFaceVaryingPrimvarIndices(
+    PXR_NS::TfSpan<const int> faceVertexCounts,
+    PXR_NS::TfSpan<const int> faceVertexIndices,
+    int                       numVertices,
+    PXR_NS::TfToken*          interpolation,
+    PXR_NS::VtIntArray*       assignmentIndices);
+
 /// Get whether \p plug is authored in the Maya scene.
 ///
 /// A plug is considered authored if its value has been changed from the
@@ -678,6 +692,12 @@ MString GetCurrentMayaWorkspacePath();
 MAYAUSD_CORE_PUBLIC
 MString GetCurrentSceneFilePath();
 
+/// Gets the Maya-specific extent of the supplied prim, for prims that Maya
+/// draws with a size but that USD does not consider boundable, like cameras.
+/// Returns false if Maya adds no extent for that prim.
+MAYAUSD_CORE_PUBLIC
+bool GetMayaExtent(const PXR_NS::UsdPrim& prim, PXR_NS::GfRange3d& range);
+
 /// Takes the supplied bounding box and adds to it Maya-specific extents
 /// that come from the nodes originating from the supplied root node
 MAYAUSD_CORE_PUBLIC
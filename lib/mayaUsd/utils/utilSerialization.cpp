@@ -236,6 +236,23 @@ USDUnsavedEditsOption serializeUsdEditsLocationOption()
     }
 } // namespace MAYAUSD_NS_DEF
 
+USDSerializedEditsFormat serializedUsdEditsFormatOption()
+{
+    static const MString kSerializedUsdEditsFormat(
+        MayaUsdOptionVars->SerializedUsdEditsFormat.GetText());
+
+    bool optVarExists = true;
+    int  formatOption = MGlobal::optionVarIntValue(kSerializedUsdEditsFormat, &optVarExists);
+
+    // Default is to serialize as text, which older versions of the plugin can read back.
+    if (!optVarExists || formatOption < kSerializeAsText
+        || formatOption > kSerializeAsCompressedBinary) {
+        return kSerializeAsText;
+    }
+
+    return static_cast<USDSerializedEditsFormat>(formatOption);
+}
+
 void setNewProxyPath(
     const MString&        proxyNodeName,
     const MString&        newRootLayerPath,
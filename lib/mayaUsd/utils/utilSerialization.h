@@ -64,6 +64,18 @@ enum USDUnsavedEditsOption
 MAYAUSD_CORE_PUBLIC
 USDUnsavedEditsOption serializeUsdEditsLocationOption();
 
+enum USDSerializedEditsFormat
+{
+    kSerializeAsText = 0,
+    kSerializeAsBinary,
+    kSerializeAsCompressedBinary
+};
+/*! \brief Queries the Maya optionVar that decides in which format Usd edits
+    are serialized when they are saved into the Maya scene file.
+ */
+MAYAUSD_CORE_PUBLIC
+USDSerializedEditsFormat serializedUsdEditsFormatOption();
+
 /*! \brief Utility function to update the file path attribute on the proxy shape
     when an anonymous root layer gets exported to disk. Also optionally updates
     the target layer if the anonymous layer was the target layer.
@@ -406,6 +406,15 @@ bool PxrUsdTranslators_InstancerWriter::writeInstancerAttrs(
     return true;
 }
 
+/* virtual */
+void PxrUsdTranslators_InstancerWriter::FlushTimeSamples()
+{
+    UsdMayaPrimWriter::FlushTimeSamples();
+    for (UsdMayaPrimWriterSharedPtr& writer : _prototypeWriters) {
+        writer->FlushTimeSamples();
+    }
+}
+
 /* virtual */
 void PxrUsdTranslators_InstancerWriter::PostExport()
 {
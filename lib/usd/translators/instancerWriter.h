@@ -56,6 +56,7 @@ public:
         UsdMayaWriteJobContext&  jobCtx);
 
     void                 Write(const UsdTimeCode& usdTime) override;
+    void                 FlushTimeSamples() override;
     void                 PostExport() override;
     bool                 ShouldPruneChildren() const override;
     const SdfPathVector& GetModelPaths() const override;
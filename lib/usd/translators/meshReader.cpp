@@ -58,6 +58,13 @@ public:
     ~MayaUsdPrimReaderMesh() override { }
 
     bool Read(UsdMayaPrimReaderContext& context) override;
+
+    bool SupportsParallelPrefetch() const override { return true; }
+    void Prefetch() override;
+
+private:
+    MayaUsd::TranslatorMeshReadData _prefetchedData;
+    bool                            _hasPrefetchedData = false;
 };
 
 TF_REGISTRY_FUNCTION_WITH_TAG(UsdMayaPrimReaderRegistry, UsdGeomMesh)
@@ -67,6 +74,17 @@ TF_REGISTRY_FUNCTION_WITH_TAG(UsdMayaPrimReaderRegistry, UsdGeomMesh)
     });
 }
 
+void MayaUsdPrimReaderMesh::Prefetch()
+{
+    auto mesh = UsdGeomMesh(_GetArgs().GetUsdPrim());
+    if (!mesh) {
+        return;
+    }
+
+    _prefetchedData.fetch(mesh, _GetArgs().GetTimeInterval());
+    _hasPrefetchedData = true;
+}
+
 bool MayaUsdPrimReaderMesh::Read(UsdMayaPrimReaderContext& context)
 {
     MStatus status { MS::kSuccess };
@@ -107,7 +125,8 @@ bool MayaUsdPrimReaderMesh::Read(UsdMayaPrimReaderContext& context)
         _GetArgs().GetTimeInterval(),
         _GetArgs().GetUseAsAnimationCache(),
         &context,
-        &status);
+        &status,
+        _hasPrefetchedData ? &_prefetchedData : nullptr);
     CHECK_MSTATUS_AND_RETURN(status, false);
 
     // mesh is a shape, so read Gprim properties
@@ -293,6 +293,7 @@ PxrUsdTranslators_MeshWriter::PxrUsdTranslators_MeshWriter(
 void PxrUsdTranslators_MeshWriter::PostExport()
 {
     cleanupPrimvars();
+    _topologyCache = UsdMayaMeshWriteUtils::MeshTopologyCache();
     if (this->mBlendShapesAnimWeightPlugs.length() != 0) {
         // NOTE: (yliangsiew) Really, clearing it once is enough, but due to the constraints on what
         // should go in the WriteJobContext, there's not really a better place to put this cache for
@@ -320,6 +321,13 @@ bool PxrUsdTranslators_MeshWriter::writeAnimatedMeshExtents(
     VtVec3fArray   vtMeshPts(pVtMeshPts, pVtMeshPts + numVertices);
     VtVec3fArray   meshBBox(2);
     UsdGeomPointBased::ComputeExtent(vtMeshPts, &meshBBox);
+    return updateSkelBindingsExtent(meshBBox, usdTime);
+}
+
+bool PxrUsdTranslators_MeshWriter::updateSkelBindingsExtent(
+    const VtVec3fArray& meshBBox,
+    const UsdTimeCode&  usdTime)
+{
     bool bStat = true;
     if (meshBBox != this->_prevMeshExtentsSample) {
         bStat = this->_writeJobCtx.UpdateSkelBindingsWithExtent(
@@ -338,6 +346,120 @@ void PxrUsdTranslators_MeshWriter::Write(const UsdTimeCode& usdTime)
     writeMeshAttrs(usdTime, primSchema);
 }
 
+/* virtual */
+bool PxrUsdTranslators_MeshWriter::SupportsParallelWrite() const
+{
+    // Only the time samples of meshes neither skinned nor driven by blend
+    // shapes are split, so that their points are those of the final mesh.
+    return isMeshAnimated() && !_GetExportArgs().exportBlendShapes;
+}
+
+/* virtual */
+void PxrUsdTranslators_MeshWriter::GatherFrameData(const UsdTimeCode& usdTime)
+{
+    UsdMayaPrimWriter::Write(usdTime);
+
+    _frameData = FrameData();
+
+    MStatus status { MS::kSuccess };
+    MFnMesh finalMesh(GetDagPath(), &status);
+    if (!status) {
+        TF_RUNTIME_ERROR(
+            "Failed to get final mesh at DAG path: %s", GetDagPath().fullPathName().asChar());
+        return;
+    }
+
+    // Only the raw points and normals are copied here, their conversion is
+    // left to ComputeFrameData(). The other attributes are cheap to convert,
+    // they are written right away like those of the base class.
+    const unsigned int numVertices = finalMesh.numVertices();
+    const float*       pointsData = finalMesh.getRawPoints(&status);
+    if (!status) {
+        MGlobal::displayError(
+            MString("Unable to access mesh vertices on mesh: ") + finalMesh.fullPathName());
+        return;
+    }
+    const GfVec3f* vecData = reinterpret_cast<const GfVec3f*>(pointsData);
+    _frameData.points.assign(vecData, vecData + numVertices);
+    _frameData.hasPoints = true;
+
+    UsdGeomMesh primSchema(_usdPrim);
+    UsdMayaMeshWriteUtils::writeFaceVertexIndicesData(
+        finalMesh, primSchema, usdTime, _GetSparseValueWriter(), &_topologyCache);
+
+    const TfToken sdScheme = getSubdivScheme(finalMesh);
+    if (sdScheme == UsdGeomTokens->none) {
+        bool emitNormals = true;
+        UsdMayaMeshReadUtils::getEmitNormalsTag(finalMesh, &emitNormals);
+        if (emitNormals && finalMesh.numNormals() != 0
+            && finalMesh.getNormals(_frameData.mayaNormals)) {
+            MIntArray normalCounts;
+            finalMesh.getNormalIds(normalCounts, _frameData.mayaNormalIds);
+            _frameData.numFaceVertices = finalMesh.numFaceVertices();
+            _frameData.hasNormals = true;
+        }
+    }
+
+    writeSubdivAndPrimvarAttrs(usdTime, finalMesh, sdScheme, primSchema);
+}
+
+/* virtual */
+void PxrUsdTranslators_MeshWriter::ComputeFrameData(const UsdTimeCode&)
+{
+    if (!_frameData.hasPoints) {
+        return;
+    }
+
+    // The skel bindings get the extent of the points in Maya units.
+    _frameData.skelExtent.resize(2);
+    UsdGeomPointBased::ComputeExtent(_frameData.points, &_frameData.skelExtent);
+
+    const double distanceConversionScalar
+        = UsdMayaUtil::GetExportDistanceConversionScalar(_GetExportArgs().metersPerUnit);
+    if (distanceConversionScalar != 1.0) {
+        _frameData.points = _frameData.points * distanceConversionScalar;
+        _frameData.extent.resize(2);
+        UsdGeomPointBased::ComputeExtent(_frameData.points, &_frameData.extent);
+    } else {
+        _frameData.extent = _frameData.skelExtent;
+    }
+
+    if (_frameData.hasNormals) {
+        UsdMayaMeshWriteUtils::getFaceVaryingNormals(
+            _frameData.mayaNormals,
+            _frameData.mayaNormalIds,
+            _frameData.numFaceVertices,
+            &_frameData.normals);
+    }
+}
+
+/* virtual */
+void PxrUsdTranslators_MeshWriter::CommitFrameData(const UsdTimeCode& usdTime)
+{
+    if (!_frameData.hasPoints) {
+        return;
+    }
+
+    if (!updateSkelBindingsExtent(_frameData.skelExtent, usdTime)) {
+        return;
+    }
+
+    UsdGeomMesh primSchema(_usdPrim);
+    UsdMayaWriteUtil::SetAttribute(
+        primSchema.GetPointsAttr(), &_frameData.points, usdTime, _GetSparseValueWriter());
+    UsdMayaWriteUtil::SetAttribute(
+        primSchema.CreateExtentAttr(), &_frameData.extent, usdTime, _GetSparseValueWriter());
+
+    if (_frameData.hasNormals) {
+        UsdMayaWriteUtil::SetAttribute(
+            primSchema.GetNormalsAttr(), &_frameData.normals, usdTime, _GetSparseValueWriter());
+        primSchema.SetNormalsInterpolation(UsdGeomTokens->faceVarying);
+    }
+
+    // Release the arrays now, the next frame gathers new ones.
+    _frameData = FrameData();
+}
+
 bool PxrUsdTranslators_MeshWriter::writeMeshAttrs(
     const UsdTimeCode& usdTime,
     UsdGeomMesh&       primSchema)
@@ -598,16 +720,9 @@ bool PxrUsdTranslators_MeshWriter::writeMeshAttrs(
 
     // Write faceVertexIndices
     UsdMayaMeshWriteUtils::writeFaceVertexIndicesData(
-        geomMesh, primSchema, usdTime, _GetSparseValueWriter());
-
-    // Read subdiv scheme tagging. If not set, we default to defaultMeshScheme
-    // flag (this is specified by the job args but defaults to catmullClark).
-    TfToken sdScheme = UsdMayaMeshWriteUtils::getSubdivScheme(finalMesh);
-    if (sdScheme.IsEmpty()) {
-        sdScheme = exportArgs.defaultMeshScheme;
-    }
-    primSchema.CreateSubdivisionSchemeAttr(VtValue(sdScheme), true);
+        geomMesh, primSchema, usdTime, _GetSparseValueWriter(), &_topologyCache);
 
+    const TfToken sdScheme = getSubdivScheme(finalMesh);
     if (sdScheme == UsdGeomTokens->none) {
         // Polygonal mesh - export normals.
         bool emitNormals = true; // Write mesh normals if USD_EmitNormals is not present
@@ -616,7 +731,40 @@ bool PxrUsdTranslators_MeshWriter::writeMeshAttrs(
             UsdMayaMeshWriteUtils::writeNormalsData(
                 geomMesh, primSchema, usdTime, _GetSparseValueWriter());
         }
-    } else {
+    }
+
+    return writeSubdivAndPrimvarAttrs(usdTime, finalMesh, sdScheme, primSchema);
+}
+
+TfToken PxrUsdTranslators_MeshWriter::getSubdivScheme(const MFnMesh& finalMesh) const
+{
+    // Read subdiv scheme tagging. If not set, we default to defaultMeshScheme
+    // flag (this is specified by the job args but defaults to catmullClark).
+    TfToken sdScheme = UsdMayaMeshWriteUtils::getSubdivScheme(finalMesh);
+    if (sdScheme.IsEmpty()) {
+        sdScheme = _GetExportArgs().defaultMeshScheme;
+    }
+    return sdScheme;
+}
+
+bool PxrUsdTranslators_MeshWriter::writeSubdivAndPrimvarAttrs(
+    const UsdTimeCode& usdTime,
+    MFnMesh&           finalMesh,
+    const TfToken&     sdScheme,
+    UsdGeomMesh&       primSchema)
+{
+    MStatus status { MS::kSuccess };
+
+    const UsdMayaJobExportArgs& exportArgs = _GetExportArgs();
+
+    // Subdivision tags and holes are only written at the default time, so
+    // only author them again when they or the topology changed.
+    const bool writeTopologyTags
+        = UsdMayaMeshWriteUtils::subdivTagsChanged(finalMesh, &_topologyCache);
+
+    primSchema.CreateSubdivisionSchemeAttr(VtValue(sdScheme), true);
+
+    if (sdScheme != UsdGeomTokens->none) {
         // Subdivision surface - export subdiv-specific attributes.
         UsdMayaMeshWriteUtils::writeSubdivInterpBound(
             finalMesh, primSchema, _GetSparseValueWriter());
@@ -624,12 +772,17 @@ bool PxrUsdTranslators_MeshWriter::writeMeshAttrs(
         UsdMayaMeshWriteUtils::writeSubdivFVLinearInterpolation(
             finalMesh, primSchema, _GetSparseValueWriter());
 
-        UsdMayaMeshWriteUtils::assignSubDivTagsToUSDPrim(
-            finalMesh, primSchema, _GetSparseValueWriter());
+        if (writeTopologyTags) {
+            UsdMayaMeshWriteUtils::assignSubDivTagsToUSDPrim(
+                finalMesh, primSchema, _GetSparseValueWriter());
+        }
     }
 
     // Holes - we treat InvisibleFaces as holes
-    UsdMayaMeshWriteUtils::writeInvisibleFacesData(finalMesh, primSchema, _GetSparseValueWriter());
+    if (writeTopologyTags) {
+        UsdMayaMeshWriteUtils::writeInvisibleFacesData(
+            finalMesh, primSchema, _GetSparseValueWriter());
+    }
 
     // == Write UVSets as Vec2f Primvars
     if (exportArgs.exportMeshUVs) {
@@ -639,7 +792,8 @@ bool PxrUsdTranslators_MeshWriter::writeMeshAttrs(
             usdTime,
             _GetSparseValueWriter(),
             exportArgs.preserveUVSetNames,
-            exportArgs.remapUVSetsTo);
+            exportArgs.remapUVSetsTo,
+            &_topologyCache);
     }
 
     // == Gather ColorSets
@@ -19,6 +19,7 @@
 /// \file
 
 #include <mayaUsd/fileio/primWriter.h>
+#include <mayaUsd/fileio/utils/meshWriteUtils.h>
 #include <mayaUsd/fileio/writeJobContext.h>
 
 #include <pxr/base/gf/vec2f.h>
@@ -35,8 +36,10 @@
 #include <pxr/usd/usdSkel/animation.h>
 
 #include <maya/MBoundingBox.h>
+#include <maya/MFloatVectorArray.h>
 #include <maya/MFnDependencyNode.h>
 #include <maya/MFnMesh.h>
+#include <maya/MIntArray.h>
 #include <maya/MString.h>
 
 #include <set>
@@ -58,9 +61,26 @@ public:
     bool ExportsGprims() const override;
     void PostExport() override;
 
+    bool SupportsParallelWrite() const override;
+    void GatherFrameData(const UsdTimeCode& usdTime) override;
+    void ComputeFrameData(const UsdTimeCode& usdTime) override;
+    void CommitFrameData(const UsdTimeCode& usdTime) override;
+
 private:
     bool writeMeshAttrs(const UsdTimeCode& usdTime, UsdGeomMesh& primSchema);
 
+    /// Writes the subdivision attributes, holes, UV sets, color sets and
+    /// component tags of \p finalMesh.
+    bool writeSubdivAndPrimvarAttrs(
+        const UsdTimeCode& usdTime,
+        MFnMesh&           finalMesh,
+        const TfToken&     sdScheme,
+        UsdGeomMesh&       primSchema);
+
+    /// Subdivision scheme of \p finalMesh, or the default mesh scheme of the
+    /// export if the mesh is not tagged with one.
+    TfToken getSubdivScheme(const MFnMesh& finalMesh) const;
+
     /// Cleans up any extra data authored by SetPrimvar().
     void cleanupPrimvars();
 
@@ -73,6 +93,7 @@ private:
     MObject writeBlendShapeData(UsdGeomMesh& primSchema);
     bool    writeBlendShapeAnimation(const UsdTimeCode& usdTime);
     bool    writeAnimatedMeshExtents(const MObject& deformedMesh, const UsdTimeCode& usdTime);
+    bool    updateSkelBindingsExtent(const VtVec3fArray& meshBBox, const UsdTimeCode& usdTime);
 
     /// Used to cache the animated blend shape weight plugs that need to be
     /// sampled per-frame.  Becuase UsdSkelBlendShape stores animation in an
@@ -89,8 +110,28 @@ private:
     /// The previous sample for the mesh extents. Cached between iterations.
     VtVec3fArray _prevMeshExtentsSample;
 
+    /// Topology and UV index arrays of the previous sample. Cached between
+    /// iterations.
+    UsdMayaMeshWriteUtils::MeshTopologyCache _topologyCache;
+
     UsdSkelAnimation _skelAnim;
 
+    /// Per-frame data of a parallel write, filled by GatherFrameData() and
+    /// ComputeFrameData(), and consumed by CommitFrameData().
+    struct FrameData
+    {
+        bool              hasPoints { false };
+        VtVec3fArray      points;
+        VtVec3fArray      extent;
+        VtVec3fArray      skelExtent;
+        bool              hasNormals { false };
+        MFloatVectorArray mayaNormals;
+        MIntArray         mayaNormalIds;
+        unsigned int      numFaceVertices { 0 };
+        VtVec3fArray      normals;
+    };
+    FrameData _frameData;
+
     /// Set of color sets that should be excluded.
     /// Intermediate processes may alter this set prior to writeMeshAttrs().
     std::set<std::string> _excludeColorSets;
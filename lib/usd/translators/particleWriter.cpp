@@ -66,39 +66,37 @@ template <typename T> inline void _convertVector(T& t, const MVector& v)
     t[2] = static_cast<_t>(v.z);
 }
 
-template <typename T> using _sharedVtArray = std::shared_ptr<VtArray<T>>;
-
-template <typename T> _sharedVtArray<T> _convertVectorArray(const MVectorArray& a)
+template <typename T> VtArray<T> _convertVectorArray(const MVectorArray& a)
 {
     const auto count = a.length();
-    auto*      ret = new VtArray<T>(count);
+    VtArray<T> ret(count);
     for (auto i = decltype(count) { 0 }; i < count; ++i) {
-        _convertVector<T>(ret->operator[](i), a[i]);
+        _convertVector<T>(ret[i], a[i]);
     }
-    return _sharedVtArray<T>(ret);
+    return ret;
 }
 
-template <typename T> _sharedVtArray<T> _convertArray(const MDoubleArray& a)
+template <typename T> VtArray<T> _convertArray(const MDoubleArray& a)
 {
     const auto count = a.length();
-    auto*      ret = new VtArray<T>(count);
+    VtArray<T> ret(count);
     for (auto i = decltype(count) { 0 }; i < count; ++i) {
-        ret->operator[](i) = static_cast<T>(a[i]);
+        ret[i] = static_cast<T>(a[i]);
     }
-    return _sharedVtArray<T>(ret);
+    return ret;
 }
 
-template <typename T> _sharedVtArray<T> _convertArray(const MIntArray& a)
+template <typename T> VtArray<T> _convertArray(const MIntArray& a)
 {
     const auto count = a.length();
-    auto*      ret = new VtArray<T>(count);
+    VtArray<T> ret(count);
     for (auto i = decltype(count) { 0 }; i < count; ++i) {
-        ret->operator[](i) = static_cast<T>(a[i]);
+        ret[i] = static_cast<T>(a[i]);
     }
-    return _sharedVtArray<T>(ret);
+    return ret;
 }
 
-template <typename T> using _strVecPair = std::pair<TfToken, _sharedVtArray<T>>;
+template <typename T> using _strVecPair = std::pair<TfToken, VtArray<T>>;
 
 template <typename T> using _strVecPairVec = std::vector<_strVecPair<T>>;
 
@@ -106,7 +104,7 @@ template <typename T> size_t _minCount(const _strVecPairVec<T>& a)
 {
     auto mn = std::numeric_limits<size_t>::max();
     for (const auto& v : a) {
-        mn = std::min(mn, v.second->size());
+        mn = std::min(mn, v.second.size());
     }
 
     return mn;
@@ -114,8 +112,8 @@ template <typename T> size_t _minCount(const _strVecPairVec<T>& a)
 
 template <typename T> void _resizeVectors(_strVecPairVec<T>& a, size_t size)
 {
-    for (const auto& v : a) {
-        v.second->resize(size);
+    for (auto& v : a) {
+        v.second.resize(size);
     }
 }
 
@@ -124,12 +122,12 @@ inline void _addAttr(
     UsdGeomPoints&             points,
     const TfToken&             name,
     const SdfValueTypeName&    typeName,
-    const VtArray<T>&          a,
+    VtArray<T>&                a,
     const UsdTimeCode&         usdTime,
     FlexibleSparseValueWriter* valueWriter)
 {
     auto    attr = points.GetPrim().CreateAttribute(name, typeName, false, SdfVariabilityVarying);
-    VtValue val(a);
+    VtValue val = VtValue::Take(a);
     valueWriter->SetAttribute(attr, &val, usdTime);
 }
 
@@ -143,12 +141,12 @@ template <typename T>
 void _addAttrVec(
     UsdGeomPoints&             points,
     const SdfValueTypeName&    typeName,
-    const _strVecPairVec<T>&   a,
+    _strVecPairVec<T>&         a,
     const UsdTimeCode&         usdTime,
     FlexibleSparseValueWriter* valueWriter)
 {
-    for (const auto& v : a) {
-        _addAttr(points, v.first, typeName, *v.second, usdTime, valueWriter);
+    for (auto& v : a) {
+        _addAttr(points, v.first, typeName, v.second, usdTime, valueWriter);
     }
 }
 
@@ -217,6 +215,7 @@ PxrUsdTranslators_ParticleWriter::PxrUsdTranslators_ParticleWriter(
     UsdMayaWriteJobContext&  jobCtx)
     : UsdMayaTransformWriter(depNodeFn, usdPath, jobCtx)
     , mInitialFrameDone(false)
+    , mHasParams(false)
 {
     if (!TF_VERIFY(GetDagPath().isValid())) {
         return;
@@ -240,17 +239,37 @@ PxrUsdTranslators_ParticleWriter::PxrUsdTranslators_ParticleWriter(
 
 /* virtual */
 void PxrUsdTranslators_ParticleWriter::Write(const UsdTimeCode& usdTime)
+{
+    GatherFrameData(usdTime);
+    ComputeFrameData(usdTime);
+    CommitFrameData(usdTime);
+}
+
+/* virtual */
+bool PxrUsdTranslators_ParticleWriter::SupportsParallelWrite() const { return true; }
+
+/* virtual */
+void PxrUsdTranslators_ParticleWriter::GatherFrameData(const UsdTimeCode& usdTime)
 {
     UsdMayaTransformWriter::Write(usdTime);
 
+    gatherParams(usdTime);
+}
+
+/* virtual */
+void PxrUsdTranslators_ParticleWriter::ComputeFrameData(const UsdTimeCode&) { computeParams(); }
+
+/* virtual */
+void PxrUsdTranslators_ParticleWriter::CommitFrameData(const UsdTimeCode& usdTime)
+{
     UsdGeomPoints primSchema(_usdPrim);
-    writeParams(usdTime, primSchema);
+    commitParams(usdTime, primSchema);
 }
 
-void PxrUsdTranslators_ParticleWriter::writeParams(
-    const UsdTimeCode& usdTime,
-    UsdGeomPoints&     points)
+void PxrUsdTranslators_ParticleWriter::gatherParams(const UsdTimeCode& usdTime)
 {
+    mMayaParams = MayaParams();
+
     // XXX: Check this properly, static particles are uncommon, but used.
     if (usdTime.IsDefault()) {
         return;
@@ -280,55 +299,39 @@ void PxrUsdTranslators_ParticleWriter::writeParams(
         }
     }
 
-    // In some cases, especially whenever particles are dying,
-    // the length of the attribute vector returned
-    // from Maya is smaller than the total number of particles.
-    // So we have to first read all the attributes, then
-    // determine the minimum amount of particles that all have valid data
-    // then write the data out for them in one go.
-
     const auto particleCount = particleSys.count();
     if (particleCount == 0) {
         return;
     }
 
-    _strVecPairVec<GfVec3f> vectors;
-    _strVecPairVec<float>   floats;
-    _strVecPairVec<int>     ints;
+    deformedParticleSys.position(mMayaParams.positions);
+    particleSys.velocity(mMayaParams.velocities);
+    particleSys.particleIds(mMayaParams.ids);
+    particleSys.radius(mMayaParams.radii);
+    particleSys.mass(mMayaParams.masses);
 
     MVectorArray mayaVectors;
     MDoubleArray mayaDoubles;
     MIntArray    mayaInts;
 
-    deformedParticleSys.position(mayaVectors);
-    auto positions = _convertVectorArray<GfVec3f>(mayaVectors);
-    particleSys.velocity(mayaVectors);
-    auto velocities = _convertVectorArray<GfVec3f>(mayaVectors);
-    particleSys.particleIds(mayaInts);
-    auto ids = _convertArray<int64_t>(mayaInts);
-    particleSys.radius(mayaDoubles);
-    auto radii = _convertArray<float>(mayaDoubles);
-    particleSys.mass(mayaDoubles);
-    auto masses = _convertArray<float>(mayaDoubles);
-
     if (particleSys.hasRgb()) {
         particleSys.rgb(mayaVectors);
-        vectors.emplace_back(_rgbName, _convertVectorArray<GfVec3f>(mayaVectors));
+        mMayaParams.vectors.emplace_back(_rgbName, mayaVectors);
     }
 
     if (particleSys.hasEmission()) {
         particleSys.rgb(mayaVectors);
-        vectors.emplace_back(_emissionName, _convertVectorArray<GfVec3f>(mayaVectors));
+        mMayaParams.vectors.emplace_back(_emissionName, mayaVectors);
     }
 
     if (particleSys.hasOpacity()) {
         particleSys.opacity(mayaDoubles);
-        floats.emplace_back(_opacityName, _convertArray<float>(mayaDoubles));
+        mMayaParams.floats.emplace_back(_opacityName, mayaDoubles);
     }
 
     if (particleSys.hasLifespan()) {
         particleSys.lifespan(mayaDoubles);
-        floats.emplace_back(_lifespanName, _convertArray<float>(mayaDoubles));
+        mMayaParams.floats.emplace_back(_lifespanName, mayaDoubles);
     }
 
     for (const auto& attr : mUserAttributes) {
@@ -337,73 +340,121 @@ void PxrUsdTranslators_ParticleWriter::writeParams(
         case PER_PARTICLE_INT:
             particleSys.getPerParticleAttribute(std::get<1>(attr), mayaInts, &status);
             if (status) {
-                ints.emplace_back(std::get<0>(attr), _convertArray<int>(mayaInts));
+                mMayaParams.ints.emplace_back(std::get<0>(attr), mayaInts);
             }
             break;
         case PER_PARTICLE_DOUBLE:
             particleSys.getPerParticleAttribute(std::get<1>(attr), mayaDoubles, &status);
             if (status) {
-                floats.emplace_back(std::get<0>(attr), _convertArray<float>(mayaDoubles));
+                mMayaParams.floats.emplace_back(std::get<0>(attr), mayaDoubles);
             }
             break;
         case PER_PARTICLE_VECTOR:
             particleSys.getPerParticleAttribute(std::get<1>(attr), mayaVectors, &status);
             if (status) {
-                vectors.emplace_back(std::get<0>(attr), _convertVectorArray<GfVec3f>(mayaVectors));
+                mMayaParams.vectors.emplace_back(std::get<0>(attr), mayaVectors);
             }
             break;
         }
     }
+}
+
+void PxrUsdTranslators_ParticleWriter::computeParams()
+{
+    mUsdParams = UsdParams();
+    mHasParams = false;
+
+    // In some cases, especially whenever particles are dying,
+    // the length of the attribute vector returned
+    // from Maya is smaller than the total number of particles.
+    // So we have to first read all the attributes, then
+    // determine the minimum amount of particles that all have valid data
+    // then write the data out for them in one go.
+
+    const MayaParams& maya = mMayaParams;
+    UsdParams&        usd = mUsdParams;
+
+    usd.positions = _convertVectorArray<GfVec3f>(maya.positions);
+    usd.velocities = _convertVectorArray<GfVec3f>(maya.velocities);
+    usd.ids = _convertArray<int64_t>(maya.ids);
+    usd.widths = _convertArray<float>(maya.radii);
+    usd.masses = _convertArray<float>(maya.masses);
+
+    for (const auto& v : maya.vectors) {
+        usd.vectors.emplace_back(v.first, _convertVectorArray<GfVec3f>(v.second));
+    }
+    for (const auto& v : maya.floats) {
+        usd.floats.emplace_back(v.first, _convertArray<float>(v.second));
+    }
+    for (const auto& v : maya.ints) {
+        usd.ints.emplace_back(v.first, _convertArray<int>(v.second));
+    }
 
-    const auto minSize = std::min({ _minCount(vectors),
-                                    _minCount(floats),
-                                    _minCount(ints),
-                                    positions->size(),
-                                    velocities->size(),
-                                    ids->size(),
-                                    radii->size(),
-                                    masses->size() });
+    const auto minSize = std::min({ _minCount(usd.vectors),
+                                    _minCount(usd.floats),
+                                    _minCount(usd.ints),
+                                    usd.positions.size(),
+                                    usd.velocities.size(),
+                                    usd.ids.size(),
+                                    usd.widths.size(),
+                                    usd.masses.size() });
 
     if (minSize == 0) {
         return;
     }
 
-    _resizeVectors(vectors, minSize);
-    _resizeVectors(floats, minSize);
-    _resizeVectors(ints, minSize);
-    positions->resize(minSize);
-    velocities->resize(minSize);
-    ids->resize(minSize);
-    radii->resize(minSize);
-    masses->resize(minSize);
-
-    UsdMayaWriteUtil::SetAttribute(
-        points.GetPointsAttr(), positions.get(), usdTime, _GetSparseValueWriter());
-    UsdMayaWriteUtil::SetAttribute(
-        points.GetVelocitiesAttr(), velocities.get(), usdTime, _GetSparseValueWriter());
-    UsdMayaWriteUtil::SetAttribute(
-        points.GetIdsAttr(), ids.get(), usdTime, _GetSparseValueWriter());
+    _resizeVectors(usd.vectors, minSize);
+    _resizeVectors(usd.floats, minSize);
+    _resizeVectors(usd.ints, minSize);
+    usd.positions.resize(minSize);
+    usd.velocities.resize(minSize);
+    usd.ids.resize(minSize);
+    usd.widths.resize(minSize);
+    usd.masses.resize(minSize);
 
     // radius -> width conversion
-    for (auto& r : *radii) {
+    for (auto& r : usd.widths) {
         r = r * 2.0f;
     }
 
+    mHasParams = true;
+}
+
+void PxrUsdTranslators_ParticleWriter::commitParams(
+    const UsdTimeCode& usdTime,
+    UsdGeomPoints&     points)
+{
+    if (!mHasParams) {
+        return;
+    }
+
+    UsdParams& usd = mUsdParams;
+
+    UsdMayaWriteUtil::SetAttribute(
+        points.GetPointsAttr(), &usd.positions, usdTime, _GetSparseValueWriter());
+    UsdMayaWriteUtil::SetAttribute(
+        points.GetVelocitiesAttr(), &usd.velocities, usdTime, _GetSparseValueWriter());
     UsdMayaWriteUtil::SetAttribute(
-        points.GetWidthsAttr(), radii.get(), usdTime, _GetSparseValueWriter());
+        points.GetIdsAttr(), &usd.ids, usdTime, _GetSparseValueWriter());
+    UsdMayaWriteUtil::SetAttribute(
+        points.GetWidthsAttr(), &usd.widths, usdTime, _GetSparseValueWriter());
 
     _addAttr(
         points,
         _massName,
         SdfValueTypeNames->FloatArray,
-        *masses,
+        usd.masses,
         usdTime,
         _GetSparseValueWriter());
     // TODO: check if we need the array suffix!!
     _addAttrVec(
-        points, SdfValueTypeNames->Vector3fArray, vectors, usdTime, _GetSparseValueWriter());
-    _addAttrVec(points, SdfValueTypeNames->FloatArray, floats, usdTime, _GetSparseValueWriter());
-    _addAttrVec(points, SdfValueTypeNames->IntArray, ints, usdTime, _GetSparseValueWriter());
+        points, SdfValueTypeNames->Vector3fArray, usd.vectors, usdTime, _GetSparseValueWriter());
+    _addAttrVec(
+        points, SdfValueTypeNames->FloatArray, usd.floats, usdTime, _GetSparseValueWriter());
+    _addAttrVec(points, SdfValueTypeNames->IntArray, usd.ints, usdTime, _GetSparseValueWriter());
+
+    mUsdParams = UsdParams();
+    mHasParams = false;
 }
 
 void PxrUsdTranslators_ParticleWriter::initializeUserAttributes()
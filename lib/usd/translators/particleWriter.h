@@ -22,13 +22,17 @@
 #include <mayaUsd/fileio/writeJobContext.h>
 
 #include <pxr/base/tf/token.h>
+#include <pxr/base/vt/types.h>
 #include <pxr/pxr.h>
 #include <pxr/usd/sdf/path.h>
 #include <pxr/usd/usd/timeCode.h>
 #include <pxr/usd/usdGeom/points.h>
 
+#include <maya/MDoubleArray.h>
 #include <maya/MFnDependencyNode.h>
+#include <maya/MIntArray.h>
 #include <maya/MString.h>
+#include <maya/MVectorArray.h>
 
 #include <utility>
 #include <vector>
@@ -45,8 +49,15 @@ public:
 
     void Write(const UsdTimeCode& usdTime) override;
 
+    bool SupportsParallelWrite() const override;
+    void GatherFrameData(const UsdTimeCode& usdTime) override;
+    void ComputeFrameData(const UsdTimeCode& usdTime) override;
+    void CommitFrameData(const UsdTimeCode& usdTime) override;
+
 private:
-    void writeParams(const UsdTimeCode& usdTime, UsdGeomPoints& points);
+    void gatherParams(const UsdTimeCode& usdTime);
+    void computeParams();
+    void commitParams(const UsdTimeCode& usdTime, UsdGeomPoints& points);
 
     enum ParticleType
     {
@@ -58,6 +69,36 @@ private:
     std::vector<std::tuple<TfToken, MString, ParticleType>> mUserAttributes;
     bool                                                    mInitialFrameDone;
 
+    // Per-frame Maya data, filled by gatherParams().
+    struct MayaParams
+    {
+        MVectorArray                                  positions;
+        MVectorArray                                  velocities;
+        MIntArray                                     ids;
+        MDoubleArray                                  radii;
+        MDoubleArray                                  masses;
+        std::vector<std::pair<TfToken, MVectorArray>> vectors;
+        std::vector<std::pair<TfToken, MDoubleArray>> floats;
+        std::vector<std::pair<TfToken, MIntArray>>    ints;
+    };
+    MayaParams mMayaParams;
+
+    // Per-frame USD values, filled by computeParams() and consumed by
+    // commitParams().
+    struct UsdParams
+    {
+        VtVec3fArray                                  positions;
+        VtVec3fArray                                  velocities;
+        VtInt64Array                                  ids;
+        VtFloatArray                                  widths;
+        VtFloatArray                                  masses;
+        std::vector<std::pair<TfToken, VtVec3fArray>> vectors;
+        std::vector<std::pair<TfToken, VtFloatArray>> floats;
+        std::vector<std::pair<TfToken, VtIntArray>>   ints;
+    };
+    UsdParams mUsdParams;
+    bool      mHasParams;
+
     void initializeUserAttributes();
 };
 
@@ -993,6 +993,142 @@ bool compareArray(
 #endif
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+bool isLinearInterpolation(
+    const float* const start,
+    const float* const end,
+    const float* const value,
+    const size_t       count,
+    const float        t,
+    const float        eps)
+{
+#ifdef __AVX2__
+    const f256   eps8 = splat8f(eps);
+    const f256   t8 = splat8f(t);
+    const size_t count8 = count & ~0x7ULL;
+    size_t       i = 0;
+
+    // check all values that can be processed in blocks of 8
+    for (; i < count8; i += 8) {
+        const f256 s = loadu8f(start + i);
+        const f256 e = loadu8f(end + i);
+        const f256 v = loadu8f(value + i);
+        const f256 lerp = add8f(s, mul8f(t8, sub8f(e, s)));
+        const f256 cmp = cmpnle8f(abs8f(sub8f(lerp, v)), eps8);
+        if (movemask8f(cmp)) {
+            return false;
+        }
+    }
+
+    // use a masked load to load the last 0 -> 7 elements in each array. The unused
+    // elements will be set to zero, so the interpolated value is zero as well.
+    const f256 s = loadmask7f(start + i, count);
+    const f256 e = loadmask7f(end + i, count);
+    const f256 v = loadmask7f(value + i, count);
+    const f256 lerp = add8f(s, mul8f(t8, sub8f(e, s)));
+    const f256 cmp = cmpnle8f(abs8f(sub8f(lerp, v)), eps8);
+    return movemask8f(cmp) == 0;
+
+#elif defined(__SSE__)
+    const f128   eps4 = splat4f(eps);
+    const f128   t4 = splat4f(t);
+    const size_t count4 = count & ~0x3ULL;
+    size_t       i = 0;
+    for (; i < count4; i += 4) {
+        const f128 s = loadu4f(start + i);
+        const f128 e = loadu4f(end + i);
+        const f128 v = loadu4f(value + i);
+        const f128 lerp = add4f(s, mul4f(t4, sub4f(e, s)));
+        const f128 cmp = cmpnle4f(abs4f(sub4f(lerp, v)), eps4);
+        if (movemask4f(cmp)) {
+            return false;
+        }
+    }
+
+    for (; i < count; ++i) {
+        if (!(std::abs(start[i] + t * (end[i] - start[i]) - value[i]) <= eps)) {
+            return false;
+        }
+    }
+    return true;
+#else
+    for (size_t i = 0; i < count; ++i) {
+        if (!(std::abs(start[i] + t * (end[i] - start[i]) - value[i]) <= eps)) {
+            return false;
+        }
+    }
+    return true;
+#endif
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+bool isLinearInterpolation(
+    const double* const start,
+    const double* const end,
+    const double* const value,
+    const size_t        count,
+    const double        t,
+    const double        eps)
+{
+#ifdef __AVX2__
+    const d256   eps4 = splat4d(eps);
+    const d256   t4 = splat4d(t);
+    const size_t count4 = count & ~0x3ULL;
+    size_t       i = 0;
+
+    // check all values that can be processed in blocks of 4
+    for (; i < count4; i += 4) {
+        const d256 s = loadu4d(start + i);
+        const d256 e = loadu4d(end + i);
+        const d256 v = loadu4d(value + i);
+        const d256 lerp = add4d(s, mul4d(t4, sub4d(e, s)));
+        const d256 cmp = cmpnle4d(abs4d(sub4d(lerp, v)), eps4);
+        if (movemask4d(cmp)) {
+            return false;
+        }
+    }
+
+    // use a masked load to load the last 0 -> 3 elements in each array. The unused
+    // elements will be set to zero, so the interpolated value is zero as well.
+    const d256 s = loadmask3d(start + i, count);
+    const d256 e = loadmask3d(end + i, count);
+    const d256 v = loadmask3d(value + i, count);
+    const d256 lerp = add4d(s, mul4d(t4, sub4d(e, s)));
+    const d256 cmp = cmpnle4d(abs4d(sub4d(lerp, v)), eps4);
+    return movemask4d(cmp) == 0;
+
+#elif defined(__SSE__)
+    const d128   eps2 = splat2d(eps);
+    const d128   t2 = splat2d(t);
+    const size_t count2 = count & ~0x1ULL;
+    size_t       i = 0;
+    for (; i < count2; i += 2) {
+        const d128 s = loadu2d(start + i);
+        const d128 e = loadu2d(end + i);
+        const d128 v = loadu2d(value + i);
+        const d128 lerp = add2d(s, mul2d(t2, sub2d(e, s)));
+        const d128 cmp = cmpnle2d(abs2d(sub2d(lerp, v)), eps2);
+        if (movemask2d(cmp)) {
+            return false;
+        }
+    }
+
+    // check the final element (If it's there)
+    bool result = true;
+    if (count & 0x1) {
+        result = std::abs(start[i] + t * (end[i] - start[i]) - value[i]) <= eps;
+    }
+    return result;
+#else
+    for (size_t i = 0; i < count; ++i) {
+        if (!(std::abs(start[i] + t * (end[i] - start[i]) - value[i]) <= eps)) {
+            return false;
+        }
+    }
+    return true;
+#endif
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 bool compareUvArray(
     const float* const u0,
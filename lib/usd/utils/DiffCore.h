@@ -434,6 +434,48 @@ inline bool compareArray(
     return compareArray((const int32_t*)input0, (const int32_t*)input1, count0 << 1, count1 << 1);
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/// \brief  tests whether an array can be reconstructed by linearly interpolating between two other
+///         arrays, i.e. whether every element of value is within eps of start + t * (end - start).
+/// \param  start the array at the start of the interpolation
+/// \param  end the array at the end of the interpolation
+/// \param  value the array to test
+/// \param  count number of elements in each of the arrays
+/// \param  t the interpolation parameter, usually in the range [0, 1]
+/// \param  eps and epsilon value for the element comparisons
+/// \return true if all elements of value match the interpolated values, false if any element of
+///         the three arrays is NaN or infinite
+//----------------------------------------------------------------------------------------------------------------------
+MAYA_USD_UTILS_PUBLIC
+bool isLinearInterpolation(
+    const float* const start,
+    const float* const end,
+    const float* const value,
+    const size_t       count,
+    const float        t,
+    const float        eps = 1e-5f);
+
+//----------------------------------------------------------------------------------------------------------------------
+/// \brief  tests whether an array can be reconstructed by linearly interpolating between two other
+///         arrays, i.e. whether every element of value is within eps of start + t * (end - start).
+/// \param  start the array at the start of the interpolation
+/// \param  end the array at the end of the interpolation
+/// \param  value the array to test
+/// \param  count number of elements in each of the arrays
+/// \param  t the interpolation parameter, usually in the range [0, 1]
+/// \param  eps and epsilon value for the element comparisons
+/// \return true if all elements of value match the interpolated values, false if any element of
+///         the three arrays is NaN or infinite
+//----------------------------------------------------------------------------------------------------------------------
+MAYA_USD_UTILS_PUBLIC
+bool isLinearInterpolation(
+    const double* const start,
+    const double* const end,
+    const double* const value,
+    const size_t        count,
+    const double        t,
+    const double        eps = 1e-5);
+
 //----------------------------------------------------------------------------------------------------------------------
 /// \brief  tests the differences between a pair of arrays of UV.
 /// \param  u0 the U values of the first input array to test
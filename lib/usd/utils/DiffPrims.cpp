@@ -15,7 +15,13 @@
 //
 #include "DiffPrims.h"
 
+#include <pxr/base/work/loops.h>
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
 #include <map>
+#include <vector>
 
 namespace MayaUsdUtils {
 
@@ -143,23 +149,78 @@ comparePrimsChildren(const UsdPrim& modified, const UsdPrim& baseline, DiffResul
         }
     }
 
-    // Compare the children from the modified prim.
-    // Baseline children map won't change from now on, so cache the end.
+    // Pair the children from the modified prim with their baseline, in order.
+    // A child without a baseline pairs with an invalid prim and is created.
+    struct ChildDiff
+    {
+        UsdPrim    modified;
+        UsdPrim    baseline;
+        DiffResult result;
+        DiffResult quickResult;
+    };
+    std::vector<ChildDiff> childDiffs;
     {
         const auto baselineEnd = baselineChildren.end();
         for (const UsdPrim& child : modified.GetAllChildren()) {
-            const SdfPath& path = child.GetPath();
-            const auto     iter = baselineChildren.find(path);
+            const auto iter = baselineChildren.find(child.GetPath());
             if (iter == baselineEnd) {
-                USD_MAYA_RETURN_QUICK_RESULT(DiffResult::Created, results);
-                results[path] = DiffResult::Created;
+                childDiffs.push_back(
+                    { child, UsdPrim(), DiffResult::Created, DiffResult::Created });
             } else {
-                results[path] = comparePrims(child, iter->second, quickDiff);
-                USD_MAYA_RETURN_QUICK_RESULT(*quickDiff, results);
+                childDiffs.push_back({ child, iter->second, DiffResult::Same, DiffResult::Same });
             }
         }
     }
 
+    // Sibling sub-trees are compared in parallel, each task writing its own results.
+    //
+    // For a quick diff, the children following the first known difference are skipped,
+    // while all the children preceding it are still compared, so that the reported
+    // difference is the same as when comparing the children in order.
+    const size_t        noDiffIndex = std::numeric_limits<size_t>::max();
+    std::atomic<size_t> firstDiffIndex(noDiffIndex);
+    if (quickDiff) {
+        for (size_t i = 0; i < childDiffs.size(); ++i) {
+            if (!childDiffs[i].baseline.IsValid()) {
+                firstDiffIndex = i;
+                break;
+            }
+        }
+    }
+
+    PXR_NS::WorkParallelForN(childDiffs.size(), [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            ChildDiff& childDiff = childDiffs[i];
+            if (!childDiff.baseline.IsValid())
+                continue;
+            if (quickDiff && i > firstDiffIndex.load())
+                return;
+
+            childDiff.result = comparePrims(
+                childDiff.modified,
+                childDiff.baseline,
+                quickDiff ? &childDiff.quickResult : nullptr);
+
+            if (quickDiff && childDiff.quickResult != DiffResult::Same) {
+                size_t diffIndex = firstDiffIndex.load();
+                while (i < diffIndex && !firstDiffIndex.compare_exchange_weak(diffIndex, i)) { }
+                return;
+            }
+        }
+    });
+
+    // Merge the per-child results, in order.
+    const size_t mergedCount = std::min(childDiffs.size(), firstDiffIndex.load());
+    for (size_t i = 0; i < mergedCount; ++i) {
+        results[childDiffs[i].modified.GetPath()] = childDiffs[i].result;
+    }
+    if (mergedCount < childDiffs.size()) {
+        const ChildDiff& childDiff = childDiffs[mergedCount];
+        if (childDiff.baseline.IsValid())
+            results[childDiff.modified.GetPath()] = childDiff.result;
+        USD_MAYA_RETURN_QUICK_RESULT(childDiff.quickResult, results);
+    }
+
     // Identify children that are absent in the modified prim.
     for (const auto& pathAndPrim : baselineChildren) {
         const auto& path = pathAndPrim.first;
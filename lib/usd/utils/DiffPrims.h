@@ -114,6 +114,7 @@ DiffResult comparePrimsOnly(
 
 //----------------------------------------------------------------------------------------------------------------------
 /// \brief  compares all the children of a modified prim to a baseline one.
+/// The sub-trees of the children are compared in parallel.
 /// \param  modified the potentially modified prim that is compared.
 /// \param  baseline the prim that is used as the baseline for the comparison.
 /// \param  quickDiff if not null, returns a result other than Same when a difference is found.
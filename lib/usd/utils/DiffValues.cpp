@@ -33,6 +33,10 @@
 #include <pxr/base/vt/value.h>
 #include <pxr/usd/sdf/valueTypeName.h>
 
+#include <functional>
+#include <typeindex>
+#include <unordered_map>
+
 namespace MayaUsdUtils {
 
 using VtValue = PXR_NS::VtValue;
@@ -50,7 +54,17 @@ namespace {
 
 using DiffFunc = std::function<DiffResult(const VtValue& modified, const VtValue& baseline)>;
 using DiffKey = std::pair<std::type_index, std::type_index>;
-using DiffFuncMap = std::map<DiffKey, DiffFunc>;
+
+struct DiffKeyHash
+{
+    size_t operator()(const DiffKey& key) const
+    {
+        return std::hash<std::type_index>()(key.first) * 31u
+            + std::hash<std::type_index>()(key.second);
+    }
+};
+
+using DiffFuncMap = std::unordered_map<DiffKey, DiffFunc, DiffKeyHash>;
 
 template <class T1, class T2>
 DiffResult diffTwoTypesWithEps(const VtValue& modified, const VtValue& baseline)
@@ -137,6 +151,21 @@ DiffResult diffTwoQuatArrays(const VtValue& modified, const VtValue& baseline)
         : DiffResult::Differ;
 }
 
+DiffResult diffBoolArrays(const VtValue& modified, const VtValue& baseline)
+{
+    // Booleans are compared bytewise with the SIMD comparator for 8-bit integers.
+    static_assert(sizeof(bool) == sizeof(int8_t), "bool arrays are compared as int8_t arrays");
+    const VtArray<bool>& v1 = modified.Get<VtArray<bool>>();
+    const VtArray<bool>& v2 = baseline.Get<VtArray<bool>>();
+    return compareArray(
+               reinterpret_cast<const int8_t*>(v1.cdata()),
+               reinterpret_cast<const int8_t*>(v2.cdata()),
+               modified.GetArraySize(),
+               baseline.GetArraySize())
+        ? DiffResult::Same
+        : DiffResult::Differ;
+}
+
 DiffResult diffByDefault(const VtValue& modified, const VtValue& baseline)
 {
     return modified == baseline ? DiffResult::Same : DiffResult::Differ;
@@ -260,6 +289,8 @@ const DiffFuncMap& getDiffFuncs()
         MAYA_USD_DIFF_FUNC_FOR_QUATS(GfQuath, GfQuatd, 4),
         MAYA_USD_DIFF_FUNC_FOR_QUATS(GfQuath, GfQuatf, 4),
 
+        { DiffKey(typeid(VtArray<bool>), typeid(VtArray<bool>)), diffBoolArrays },
+
         // TODO: separate U,V vs combined UV diff. DiffCore support this, but we don't expect
         // USD to ever have UV that are sometimes spearate attributes, sometimes a single attribute.
         // TODO: diff accross different integer types, like int_8 to int16_t.
@@ -270,13 +301,15 @@ const DiffFuncMap& getDiffFuncs()
     return diffs;
 };
 
-DiffFunc getDiffFunction(const VtValue& modified, const VtValue& baseline)
+const DiffFunc& getDiffFunction(const VtValue& modified, const VtValue& baseline)
 {
+    static const DiffFunc defaultDiff = diffByDefault;
+
     const DiffFuncMap& diffs = getDiffFuncs();
     const DiffKey      typeKey(modified.GetTypeid(), baseline.GetTypeid());
     const auto         func = diffs.find(typeKey);
     if (func == diffs.end())
-        return diffByDefault;
+        return defaultDiff;
     return func->second;
 }
 
@@ -284,7 +317,7 @@ DiffFunc getDiffFunction(const VtValue& modified, const VtValue& baseline)
 
 DiffResult compareValues(const VtValue& modified, const VtValue& baseline)
 {
-    DiffFunc diff = getDiffFunction(modified, baseline);
+    const DiffFunc& diff = getDiffFunction(modified, baseline);
     return diff(modified, baseline);
 }
 
@@ -18,13 +18,17 @@
 #include "DiffPrims.h"
 
 #include <pxr/base/tf/stringUtils.h>
+#include <pxr/base/work/loops.h>
 #include <pxr/usd/sdf/copyUtils.h>
 #include <pxr/usd/usd/editContext.h>
 #include <pxr/usd/usd/variantSets.h>
 #include <pxr/usd/usdGeom/xformCommonAPI.h>
 
 #include <algorithm>
+#include <unordered_map>
+#include <unordered_set>
 #include <utility>
+#include <vector>
 
 namespace MayaUsdUtils {
 
@@ -36,6 +40,11 @@ namespace {
 // Utilities
 //----------------------------------------------------------------------------------------------------------------------
 
+//----------------------------------------------------------------------------------------------------------------------
+/// Whether the source prims and attributes, indexed by their path without variant selections,
+/// are modified compared to their destination.
+using ModifiedPaths = std::unordered_map<SdfPath, bool, SdfPath::Hash>;
+
 //----------------------------------------------------------------------------------------------------------------------
 // Data used for merging passed to all helper functions.
 struct MergeContext
@@ -45,6 +54,7 @@ struct MergeContext
     const SdfPath&           srcRootPath;
     const UsdStageRefPtr&    dstStage;
     const SdfPath&           dstRootPath;
+    const ModifiedPaths&     modifiedPaths;
 };
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -375,6 +385,19 @@ bool isMetadataAtPathModified(
     return changed;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/// Retrieves whether the prim or attribute at the given source path was found to be modified
+/// before merging. Returns false if it was not compared beforehand.
+bool findModifiedPath(const MergeContext& ctx, const SdfPath& srcPath, bool* modified)
+{
+    const auto iter = ctx.modifiedPaths.find(srcPath);
+    if (iter == ctx.modifiedPaths.end())
+        return false;
+
+    *modified = iter->second;
+    return true;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /// Verifies if the data at the given path have been modified.
 bool isDataAtPathsModified(
@@ -427,8 +450,11 @@ bool isDataAtPathsModified(
             if (srcProp.Is<UsdAttribute>()) {
                 const UsdAttribute srcAttr = srcProp.As<UsdAttribute>();
                 const UsdAttribute dstAttr = dstProp.As<UsdAttribute>();
-                compareAttributes(srcAttr, dstAttr, &quickDiff);
-                const bool changed = (quickDiff != DiffResult::Same);
+                bool               changed = false;
+                if (!findModifiedPath(ctx, srcAttr.GetPath(), &changed)) {
+                    compareAttributes(srcAttr, dstAttr, &quickDiff);
+                    changed = (quickDiff != DiffResult::Same);
+                }
                 printChangedField(ctx, src, "attribute", changed);
                 return changed;
             } else {
@@ -445,8 +471,11 @@ bool isDataAtPathsModified(
             return isMetadataAtPathModified(
                 ctx, src, dst, "prim metadata", srcPrim, dstPrim, ctx.options.propMetadataHandling);
         } else {
-            comparePrimsOnly(srcPrim, dstPrim, &quickDiff);
-            const bool changed = (quickDiff != DiffResult::Same);
+            bool changed = false;
+            if (!findModifiedPath(ctx, srcPrim.GetPath(), &changed)) {
+                comparePrimsOnly(srcPrim, dstPrim, &quickDiff);
+                changed = (quickDiff != DiffResult::Same);
+            }
             printChangedField(ctx, src, "prim", changed);
             return changed;
         }
@@ -924,6 +953,70 @@ bool shouldMergeChildren(
     return filterChildren(ctx, src, dst, **srcChildren, **dstChildren);
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/// Compares the source prims that can be merged, and their attributes, to their destination.
+///
+/// SdfCopySpec() visits one field at a time and each prim field would otherwise compare the
+/// whole prim again, so all the comparisons are done beforehand, the prims being compared in
+/// parallel. Each prim gets its own result buffer, which are merged once all are compared.
+ModifiedPaths computeModifiedPaths(
+    const MergePrimsOptions& options,
+    const UsdStageRefPtr&    srcStage,
+    const SdfLayerRefPtr&    srcLayer,
+    const SdfPath&           srcPath,
+    const UsdStageRefPtr&    dstStage,
+    const SdfPath&           dstPath)
+{
+    const SdfPath srcRootPath = srcPath.StripAllVariantSelections();
+    const SdfPath dstRootPath = dstPath.StripAllVariantSelections();
+
+    std::vector<SdfPath> primPaths;
+    if (options.mergeChildren) {
+        std::unordered_set<SdfPath, SdfPath::Hash> visited;
+        srcLayer->Traverse(srcPath, [&primPaths, &visited](const SdfPath& path) {
+            if (!path.IsPrimPath())
+                return;
+            const SdfPath primPath = path.StripAllVariantSelections();
+            if (visited.insert(primPath).second)
+                primPaths.push_back(primPath);
+        });
+    } else {
+        primPaths.push_back(srcRootPath);
+    }
+
+    std::vector<std::vector<std::pair<SdfPath, bool>>> primResults(primPaths.size());
+    WorkParallelForN(primPaths.size(), [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            const SdfPath& primPath = primPaths[i];
+            const UsdPrim  srcPrim = srcStage->GetPrimAtPath(primPath);
+            const UsdPrim  dstPrim
+                = dstStage->GetPrimAtPath(primPath.ReplacePrefix(srcRootPath, dstRootPath));
+            if (!srcPrim.IsValid() || !dstPrim.IsValid())
+                continue;
+
+            auto&      results = primResults[i];
+            DiffResult quickDiff = DiffResult::Same;
+            comparePrimsOnly(srcPrim, dstPrim, &quickDiff);
+            results.emplace_back(primPath, quickDiff != DiffResult::Same);
+
+            for (const UsdAttribute& srcAttr : srcPrim.GetAuthoredAttributes()) {
+                const UsdAttribute dstAttr = dstPrim.GetAttribute(srcAttr.GetName());
+                if (!dstAttr.IsValid())
+                    continue;
+
+                compareAttributes(srcAttr, dstAttr, &quickDiff);
+                results.emplace_back(srcAttr.GetPath(), quickDiff != DiffResult::Same);
+            }
+        }
+    });
+
+    ModifiedPaths modifiedPaths;
+    for (const auto& results : primResults)
+        modifiedPaths.insert(results.begin(), results.end());
+
+    return modifiedPaths;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /// Copies a minimal prim using diff and merge, printing all fields that are copied to the Maya
 /// console.
@@ -936,7 +1029,9 @@ bool mergeDiffPrims(
     const SdfLayerRefPtr&    dstLayer,
     const SdfPath&           dstPath)
 {
-    const MergeContext ctx = { options, srcStage, srcPath, dstStage, dstPath };
+    const ModifiedPaths modifiedPaths
+        = computeModifiedPaths(options, srcStage, srcLayer, srcPath, dstStage, dstPath);
+    const MergeContext ctx = { options, srcStage, srcPath, dstStage, dstPath, modifiedPaths };
 
     auto copyValue = makeFuncWithContext(ctx, shouldMergeValue);
     auto copyChildren = makeFuncWithContext(ctx, shouldMergeChildren);
@@ -105,7 +105,12 @@ AL_DLL_HIDDEN inline i128 cmplt16i8(const i128 a, const i128 b) { return _mm_cmp
 AL_DLL_HIDDEN inline i128 cmpgt16i8(const i128 a, const i128 b) { return _mm_cmpgt_epi8(a, b); }
 
 AL_DLL_HIDDEN inline f128 cmpgt4f(const f128 a, const f128 b) { return _mm_cmpgt_ps(a, b); }
+AL_DLL_HIDDEN inline f128 cmpge4f(const f128 a, const f128 b) { return _mm_cmpge_ps(a, b); }
+AL_DLL_HIDDEN inline f128 cmplt4f(const f128 a, const f128 b) { return _mm_cmplt_ps(a, b); }
 AL_DLL_HIDDEN inline d128 cmpgt2d(const d128 a, const d128 b) { return _mm_cmpgt_pd(a, b); }
+// true where a > b, or where either a or b is NaN
+AL_DLL_HIDDEN inline f128 cmpnle4f(const f128 a, const f128 b) { return _mm_cmpnle_ps(a, b); }
+AL_DLL_HIDDEN inline d128 cmpnle2d(const d128 a, const d128 b) { return _mm_cmpnle_pd(a, b); }
 AL_DLL_HIDDEN inline f128 cmpne4f(const f128 a, const f128 b) { return _mm_cmpneq_ps(a, b); }
 AL_DLL_HIDDEN inline d128 cmpne2d(const d128 a, const d128 b) { return _mm_cmpneq_pd(a, b); }
 AL_DLL_HIDDEN inline i128 cmpeq8i16(const i128 a, const i128 b) { return _mm_cmpeq_epi16(a, b); }
@@ -205,6 +210,7 @@ AL_DLL_HIDDEN inline i128 and4i(const i128 a, const i128 b) { return _mm_and_si1
 AL_DLL_HIDDEN inline i128 andnot4i(const i128 a, const i128 b) { return _mm_andnot_si128(a, b); }
 
 AL_DLL_HIDDEN inline f128 mul4f(const f128 a, const f128 b) { return _mm_mul_ps(a, b); }
+AL_DLL_HIDDEN inline f128 div4f(const f128 a, const f128 b) { return _mm_div_ps(a, b); }
 AL_DLL_HIDDEN inline d128 mul2d(const d128 a, const d128 b) { return _mm_mul_pd(a, b); }
 
 AL_DLL_HIDDEN inline f128 add4f(const f128 a, const f128 b) { return _mm_add_ps(a, b); }
@@ -473,6 +479,9 @@ AL_DLL_HIDDEN inline f256 set2f128(const f128 lo, const f128 hi)
 
 inline f256 cmpgt8f(const f256 a, const f256 b) { return _mm256_cmp_ps(a, b, _CMP_GT_OQ); }
 inline d256 cmpgt4d(const d256 a, const d256 b) { return _mm256_cmp_pd(a, b, _CMP_GT_OQ); }
+// true where a > b, or where either a or b is NaN
+inline f256 cmpnle8f(const f256 a, const f256 b) { return _mm256_cmp_ps(a, b, _CMP_NLE_UQ); }
+inline d256 cmpnle4d(const d256 a, const d256 b) { return _mm256_cmp_pd(a, b, _CMP_NLE_UQ); }
 inline f256 cmpne8f(const f256 a, const f256 b) { return _mm256_cmp_ps(a, b, _CMP_NEQ_OQ); }
 inline d256 cmpne4d(const d256 a, const d256 b) { return _mm256_cmp_pd(a, b, _CMP_NEQ_OQ); }
 inline i256 cmpeq4i64(const i256 a, const i256 b) { return _mm256_cmpeq_epi64(a, b); }
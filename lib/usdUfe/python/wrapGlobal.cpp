@@ -23,5 +23,7 @@ using namespace boost::python;
 void wrapGlobal()
 {
     def("getUsdRunTimeId", UsdUfe::getUsdRunTimeId);
+    def("setSceneNotificationBatchSize", UsdUfe::StagesSubject::setSceneNotificationBatchSize);
+    def("sceneNotificationBatchSize", UsdUfe::StagesSubject::sceneNotificationBatchSize);
 }
 // clang-format on
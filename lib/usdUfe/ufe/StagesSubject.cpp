@@ -20,9 +20,11 @@
 #include <usdUfe/ufe/Global.h>
 #include <usdUfe/ufe/UfeVersionCompat.h>
 #include <usdUfe/ufe/UsdCamera.h>
+#include <usdUfe/ufe/UsdHierarchy.h>
 #include <usdUfe/ufe/Utils.h>
 #include <usdUfe/undo/UsdUndoManager.h>
 
+#include <pxr/base/tf/envSetting.h>
 #include <pxr/usd/usd/prim.h>
 #include <pxr/usd/usdGeom/pointInstancer.h>
 #include <pxr/usd/usdGeom/tokens.h>
@@ -37,11 +39,107 @@
 #include <ufe/sceneNotification.h>
 #include <ufe/transform3d.h>
 
+#include <algorithm>
+#include <memory>
 #include <regex>
+#include <unordered_set>
 #include <vector>
 
 namespace {
 
+TF_DEFINE_ENV_SETTING(
+    USDUFE_SCENE_NOTIFICATION_BATCH_SIZE,
+    0,
+    "Maximum number of scene changes sent in a single UFE composite notification when a USD "
+    "stage changes. Zero sends every scene change in its own notification.");
+
+size_t& sceneNotificationBatchSizeRef()
+{
+    static size_t batchSize
+        = static_cast<size_t>(std::max(TfGetEnvSetting(USDUFE_SCENE_NOTIFICATION_BATCH_SIZE), 0));
+    return batchSize;
+}
+
+#ifdef UFE_V4_FEATURES_AVAILABLE
+// Scene notifications queued while a stage change is processed in batching
+// mode. They are sent in composite notifications of at most batchSize changes.
+class SceneChangedBatch
+{
+public:
+    SceneChangedBatch(size_t batchSize)
+        : _batchSize(batchSize)
+        , _previous(_current)
+    {
+        _current = this;
+    }
+
+    ~SceneChangedBatch()
+    {
+        flush();
+        _current = _previous;
+    }
+
+    SceneChangedBatch(const SceneChangedBatch&) = delete;
+    SceneChangedBatch& operator=(const SceneChangedBatch&) = delete;
+
+    static SceneChangedBatch* current() { return _current; }
+
+    void append(const Ufe::SceneChanged& notif)
+    {
+        if (!_notif) {
+            _notif = std::make_unique<Ufe::SceneCompositeNotification>();
+        }
+        _notif->appendSceneChanged(notif);
+        if (++_size >= _batchSize) {
+            flush();
+        }
+    }
+
+    void flush()
+    {
+        if (!_notif) {
+            return;
+        }
+
+        // Reset the batch before notifying, in case an observer changes the stage.
+        const std::unique_ptr<Ufe::SceneCompositeNotification> notif = std::move(_notif);
+        _size = 0;
+
+        try {
+            Ufe::Scene::instance().notify(*notif);
+        } catch (const std::exception& ex) {
+            TF_WARN("Caught error during notification: %s", ex.what());
+        }
+    }
+
+private:
+    std::unique_ptr<Ufe::SceneCompositeNotification> _notif;
+    size_t                                           _size { 0 };
+    const size_t                                     _batchSize;
+    SceneChangedBatch* const                         _previous;
+
+    static SceneChangedBatch* _current;
+};
+
+SceneChangedBatch* SceneChangedBatch::_current = nullptr;
+#endif
+
+void sendSceneChanged(const Ufe::SceneChanged& notif)
+{
+#ifdef UFE_V4_FEATURES_AVAILABLE
+    if (auto batch = SceneChangedBatch::current()) {
+        batch->append(notif);
+        return;
+    }
+#endif
+
+    try {
+        Ufe::Scene::instance().notify(notif);
+    } catch (const std::exception& ex) {
+        TF_WARN("Caught error during notification: %s", ex.what());
+    }
+}
+
 bool isTransformChange(const TfToken& nameToken)
 {
     return nameToken == UsdGeomTokens->xformOpOrder || UsdGeomXformOp::IsXformOp(nameToken);
@@ -382,18 +480,55 @@ StagesSubject::~StagesSubject() { }
 /*static*/
 StagesSubject::RefPtr StagesSubject::create() { return TfCreateRefPtr(new StagesSubject); }
 
+/*static*/
+void StagesSubject::setSceneNotificationBatchSize(size_t batchSize)
+{
+    sceneNotificationBatchSizeRef() = batchSize;
+}
+
+/*static*/
+size_t StagesSubject::sceneNotificationBatchSize() { return sceneNotificationBatchSizeRef(); }
+
 void StagesSubject::stageChanged(
     UsdNotice::ObjectsChanged const& notice,
     UsdStageWeakPtr const&           sender)
 {
+    // Before anything reacts to the notifications sent below.
+    UsdHierarchy::invalidateCachedChildren(notice);
+
     // If the stage path has not been initialized yet, do nothing
     if (stagePath(sender).empty())
         return;
 
+    // In batching mode, the scene changes of the prims below a resynced prim
+    // are collapsed into the notification of the prim, since USD resyncs imply
+    // the invalidation of the whole subtree. Property changes are not scene
+    // changes, so their attribute and transform notifications are always sent.
+    bool isBatching = false;
+#ifdef UFE_V4_FEATURES_AVAILABLE
+    std::unique_ptr<SceneChangedBatch> batch;
+    if (sceneNotificationBatchSize() > 0) {
+        batch = std::make_unique<SceneChangedBatch>(sceneNotificationBatchSize());
+        isBatching = true;
+    }
+#endif
+    std::unordered_set<SdfPath, SdfPath::Hash> notifiedSubtrees;
+    const auto isInNotifiedSubtree = [&notifiedSubtrees](const SdfPath& path) {
+        for (SdfPath ancestor = path.GetParentPath(); !ancestor.IsEmpty();
+             ancestor = ancestor.GetParentPath()) {
+            if (notifiedSubtrees.count(ancestor) > 0)
+                return true;
+        }
+        return false;
+    };
+
     auto stage = notice.GetStage();
     auto resyncPaths = notice.GetResyncedPaths();
     for (auto it = resyncPaths.begin(), end = resyncPaths.end(); it != end; ++it) {
         const auto& changedPath = *it;
+        if (isBatching && changedPath.IsPrimPath() && isInNotifiedSubtree(changedPath))
+            continue;
+
         if (changedPath.IsPrimPropertyPath()) {
             // Special case to detect when an xformop is added or removed from a prim.
             // We need to send some notifications so DCC can update (such as on undo
@@ -508,8 +643,16 @@ void StagesSubject::stageChanged(
                 sendSubtreeInvalidate(sceneItem);
             }
         }
+
+        if (isBatching)
+            notifiedSubtrees.insert(changedPath);
     }
 
+#ifdef UFE_V4_FEATURES_AVAILABLE
+    // Send the remaining scene changes before the attribute changes below.
+    batch.reset();
+#endif
+
     auto changedInfoOnlyPaths = notice.GetChangedInfoOnlyPaths();
     for (auto it = changedInfoOnlyPaths.begin(), end = changedInfoOnlyPaths.end(); it != end;
          ++it) {
@@ -616,38 +759,22 @@ void StagesSubject::stageEditTargetChanged(
 
 void StagesSubject::sendObjectAdd(const Ufe::SceneItem::Ptr& sceneItem) const
 {
-    try {
-        Ufe::Scene::instance().notify(Ufe::ObjectAdd(sceneItem));
-    } catch (const std::exception& ex) {
-        TF_WARN("Caught error during notification: %s", ex.what());
-    }
+    sendSceneChanged(Ufe::ObjectAdd(sceneItem));
 }
 
 void StagesSubject::sendObjectPostDelete(const Ufe::SceneItem::Ptr& sceneItem) const
 {
-    try {
-        Ufe::Scene::instance().notify(Ufe::ObjectPostDelete(sceneItem));
-    } catch (const std::exception& ex) {
-        TF_WARN("Caught error during notification: %s", ex.what());
-    }
+    sendSceneChanged(Ufe::ObjectPostDelete(sceneItem));
 }
 
 void StagesSubject::sendObjectDestroyed(const Ufe::Path& ufePath) const
 {
-    try {
-        Ufe::Scene::instance().notify(Ufe::ObjectDestroyed(ufePath));
-    } catch (const std::exception& ex) {
-        TF_WARN("Caught error during notification: %s", ex.what());
-    }
+    sendSceneChanged(Ufe::ObjectDestroyed(ufePath));
 }
 
 void StagesSubject::sendSubtreeInvalidate(const Ufe::SceneItem::Ptr& sceneItem) const
 {
-    try {
-        Ufe::Scene::instance().notify(Ufe::SubtreeInvalidate(sceneItem));
-    } catch (const std::exception& ex) {
-        TF_WARN("Caught error during notification: %s", ex.what());
-    }
+    sendSceneChanged(Ufe::SubtreeInvalidate(sceneItem));
 }
 AttributeChangedNotificationGuard::AttributeChangedNotificationGuard()
 {
@@ -68,7 +68,19 @@ public:
     StagesSubject(StagesSubject&&) = delete;
     StagesSubject& operator=(StagesSubject&&) = delete;
 
+    //! Set the maximum number of scene changes sent in a single
+    //! Ufe::SceneCompositeNotification while processing a stage change.
+    //! With a non-zero batch size, the changes of a stage notice are also
+    //! collapsed: a resynced prim subsumes the changes of its descendants.
+    //! Zero sends every scene change in its own notification, which is the
+    //! default unless the USDUFE_SCENE_NOTIFICATION_BATCH_SIZE environment
+    //! variable is set. Batching requires UFE v4.
+    static void   setSceneNotificationBatchSize(size_t batchSize);
+    static size_t sceneNotificationBatchSize();
+
     // Ufe notification helpers - send notification trapping any exception.
+    // While a stage change is processed in batching mode, the notifications
+    // are queued and sent in composite notifications.
     void sendObjectAdd(const Ufe::SceneItem::Ptr& sceneItem) const;
     void sendObjectPostDelete(const Ufe::SceneItem::Ptr& sceneItem) const;
     void sendObjectDestroyed(const Ufe::Path& ufePath) const;
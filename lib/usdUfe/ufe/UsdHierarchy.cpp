@@ -25,6 +25,7 @@
 #include <pxr/base/tf/stringUtils.h>
 #include <pxr/usd/sdf/copyUtils.h>
 #include <pxr/usd/sdf/layer.h>
+#include <pxr/usd/sdf/pathTable.h>
 #include <pxr/usd/usd/prim.h>
 #include <pxr/usd/usd/stage.h>
 #include <pxr/usd/usdGeom/xform.h>
@@ -38,6 +39,7 @@
 #include <cassert>
 #include <stdexcept>
 #include <string>
+#include <unordered_map>
 
 #ifdef UFE_V3_FEATURES_AVAILABLE
 #include <usdUfe/ufe/UsdUndoUngroupCommand.h>
@@ -115,6 +117,70 @@ UsdPrimSiblingRange getUSDFilteredChildren(
     //
     return prim.GetFilteredChildren(UsdTraverseInstanceProxies(pred));
 }
+
+// Cached result of UsdHierarchy::hasActiveChild() for a prim.
+enum class ActiveChildState
+{
+    Unknown,
+    None,
+    Some
+};
+
+struct StageActiveChildStates
+{
+    // Holding the stage keeps its unique identifier from being reused by
+    // another stage.
+    UsdStageWeakPtr                stage;
+    SdfPathTable<ActiveChildState> states;
+};
+
+std::unordered_map<const void*, StageActiveChildStates>& activeChildStates()
+{
+    static std::unordered_map<const void*, StageActiveChildStates> states;
+    return states;
+}
+
+ActiveChildState& cachedActiveChildState(const UsdPrim& prim)
+{
+    const UsdStageWeakPtr stage = prim.GetStage();
+    auto&                 allStates = activeChildStates();
+    auto                  found = allStates.find(stage.GetUniqueIdentifier());
+    if (found == allStates.end()) {
+        // Forget the stages which were closed since the last new stage.
+        for (auto iter = allStates.begin(); iter != allStates.end();) {
+            iter = iter->second.stage ? std::next(iter) : allStates.erase(iter);
+        }
+        found = allStates.emplace(stage.GetUniqueIdentifier(), StageActiveChildStates { stage })
+                    .first;
+    }
+    return found->second.states[prim.GetPath()];
+}
+
+void invalidateActiveChildStates(const UsdNotice::ObjectsChanged& notice)
+{
+    auto&      allStates = activeChildStates();
+    const auto found = allStates.find(UsdStageWeakPtr(notice.GetStage()).GetUniqueIdentifier());
+    if (found == allStates.end())
+        return;
+
+    SdfPathTable<ActiveChildState>& states = found->second.states;
+    for (const SdfPath& path : notice.GetResyncedPaths()) {
+        if (path == SdfPath::AbsoluteRootPath()) {
+            states.clear();
+            return;
+        }
+        if (!path.IsPrimPath())
+            continue;
+
+        // A resynced prim may have been added, removed, activated or
+        // deactivated, which changes the children of its parent, and all
+        // the prims below it may have changed.
+        states.erase(path);
+        const auto parent = states.find(path.GetParentPath());
+        if (parent != states.end())
+            parent->second = ActiveChildState::Unknown;
+    }
+}
 } // namespace
 
 namespace USDUFE_NS_DEF {
@@ -149,21 +215,23 @@ Ufe::SceneItem::Ptr UsdHierarchy::sceneItem() const { return fItem; }
 
 bool UsdHierarchy::hasChildren() const
 {
-    // We have an extra logic in createUFEChildList to remap and filter
-    // prims. Going this direction is more costly, but easier to maintain.
-    //
-    // I don't have data that proves we need to worry about performance in here,
-    // so going after maintainability.
-    return !children().empty();
+    // The outliner calls this for every row: do not create the scene items
+    // of all the children like children() does.
+    return hasUFEChildren(getUSDFilteredChildren(fItem), true /*filterInactive*/);
 }
 
 bool UsdHierarchy::hasFilteredChildren(const ChildFilter& childFilter) const
 {
-    // We have an extra logic in createUFEChildList to remap and filter
-    // prims. Going this direction is more costly, but easier to maintain.
-    //
-    // I don't have data that proves we need to worry about performance in here,
-    // so going after maintainability.
+    // Note: for now the only child filter flag we support is "Inactive Prims".
+    //       See UsdHierarchyHandler::childFilter()
+    if ((childFilter.size() == 1) && (childFilter.front().name == "InactivePrims")) {
+        // See uniqueChildName() for explanation of USD filter predicate.
+        const bool             showInactive = childFilter.front().value;
+        Usd_PrimFlagsPredicate flags
+            = showInactive ? UsdPrimIsDefined && !UsdPrimIsAbstract : UsdUfePrimDefaultPredicate;
+        return hasUFEChildren(getUSDFilteredChildren(fItem, flags), !showInactive);
+    }
+
     return !filteredChildren(childFilter).empty();
 }
 
@@ -171,13 +239,8 @@ bool UsdHierarchy::hasFilteredChildren(const ChildFilter& childFilter) const
 
 bool UsdHierarchy::hasChildren() const
 {
-    // We have an extra logic in createUFEChildList to remap and filter
-    // prims. Going this direction is more costly, but easier to maintain.
-    //
-    // I don't have data that proves we need to worry about performance in here,
-    // so going after maintainability.
     const bool isFilteringInactive = false;
-    return !createUFEChildList(getUSDFilteredChildren(fItem), isFilteringInactive).empty();
+    return hasUFEChildren(getUSDFilteredChildren(fItem), isFilteringInactive);
 }
 
 #endif
@@ -233,6 +296,60 @@ UsdHierarchy::createUFEChildList(const UsdPrimSiblingRange& range, bool filterIn
     return children;
 }
 
+bool UsdHierarchy::hasUFEChildren(const UsdPrimSiblingRange& range, bool filterInactive) const
+{
+    if (range.empty())
+        return false;
+
+    // Without filtering, createUFEChildList() lists an item for every child.
+    if (!filterInactive)
+        return true;
+
+    // Active children are always listed, whether a derived class remaps them or not.
+    if (hasActiveChild(fItem->prim()))
+        return true;
+
+    // Inactive children are only listed when a derived class processes them.
+    Ufe::SceneItemList hookedChildren;
+    for (const auto& child : range) {
+        if (!child.IsActive() && childrenHook(child, hookedChildren, filterInactive))
+            return true;
+    }
+    return false;
+}
+
+/*static*/
+bool UsdHierarchy::hasActiveChild(const UsdPrim& prim)
+{
+    if (!prim.IsValid())
+        return false;
+
+    const auto hasActive = [&prim]() {
+        for (const auto& child : prim.GetFilteredChildren(
+                 UsdTraverseInstanceProxies(UsdUfePrimDefaultPredicate))) {
+            if (child.IsActive())
+                return true;
+        }
+        return false;
+    };
+
+    // The stage notices only report changes to the children of instance
+    // proxies through their prototype, so do not cache them.
+    if (prim.IsInstanceProxy())
+        return hasActive();
+
+    ActiveChildState& state = cachedActiveChildState(prim);
+    if (state == ActiveChildState::Unknown)
+        state = hasActive() ? ActiveChildState::Some : ActiveChildState::None;
+    return state == ActiveChildState::Some;
+}
+
+/*static*/
+void UsdHierarchy::invalidateCachedChildren(const UsdNotice::ObjectsChanged& notice)
+{
+    invalidateActiveChildStates(notice);
+}
+
 Ufe::SceneItem::Ptr UsdHierarchy::parent() const
 {
     // We do not have a special case for point instances here. If fItem
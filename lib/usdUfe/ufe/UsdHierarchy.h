@@ -19,6 +19,8 @@
 #include <usdUfe/ufe/UfeVersionCompat.h>
 #include <usdUfe/ufe/UsdSceneItem.h>
 
+#include <pxr/usd/usd/notice.h>
+
 #include <ufe/hierarchy.h>
 #include <ufe/path.h>
 #include <ufe/selection.h>
@@ -60,6 +62,16 @@ public:
 
     UsdSceneItem::Ptr usdSceneItem() const;
 
+    //! Return true if the prim has an active child among the children listed
+    //! by the hierarchy, stopping at the first one. The result is cached per
+    //! prim until invalidateCachedChildren() receives a resync of the prim or
+    //! of one of its children.
+    static bool hasActiveChild(const PXR_NS::UsdPrim& prim);
+
+    //! Discard the cached results of hasActiveChild() affected by the changes
+    //! of the stage \p notice. Called by the StagesSubject.
+    static void invalidateCachedChildren(const PXR_NS::UsdNotice::ObjectsChanged& notice);
+
     // Ufe::Hierarchy overrides
     Ufe::SceneItem::Ptr sceneItem() const override;
     bool                hasChildren() const override;
@@ -104,6 +116,10 @@ private:
     Ufe::SceneItemList
     createUFEChildList(const PXR_NS::UsdPrimSiblingRange& range, bool filterInactive) const;
 
+    //! Return whether createUFEChildList() would return a non-empty list,
+    //! without creating the scene items of the children.
+    bool hasUFEChildren(const PXR_NS::UsdPrimSiblingRange& range, bool filterInactive) const;
+
 private:
     UsdSceneItem::Ptr fItem;
 
@@ -15,6 +15,14 @@
 //
 #include "AL/usd/transaction/TransactionManager.h"
 
+#include <pxr/base/tf/notice.h>
+#include <pxr/base/tf/weakBase.h>
+#include <pxr/usd/sdf/changeList.h>
+#include <pxr/usd/sdf/notice.h>
+
+#include <algorithm>
+#include <unordered_map>
+
 PXR_NAMESPACE_USING_DIRECTIVE
 
 namespace AL {
@@ -22,77 +30,180 @@ namespace usd {
 namespace transaction {
 
 namespace {
-template <class T, class CompareEqualFunc>
-void compareSpecViews(
-    const T&         a,
-    const T&         b,
-    SdfPathVector&   output,
-    SdfPathVector&   extra,
-    CompareEqualFunc compareEqual)
+/// \brief  returns the property owning the given property, target, connection or mapper path
+SdfPath getOwningPropertyPath(const SdfPath& path)
 {
-    const auto aEnd = a.end();
-    const auto bEnd = b.end();
-    auto       aIt = a.begin();
-    auto       bIt = b.begin();
-    while (aIt != aEnd && bIt != bEnd) {
-        const auto aName = (*aIt)->GetNameToken();
-        const auto bName = (*bIt)->GetNameToken();
-        if (aName == bName) {
-            compareEqual(*aIt, *bIt, output, extra);
-            ++aIt;
-            ++bIt;
-        } else if (aName > bName) {
-            output.push_back((*aIt)->GetPath());
-            ++aIt;
-        } else {
-            output.push_back((*bIt)->GetPath());
-            ++bIt;
-        }
+    SdfPath propertyPath = path;
+    while (!propertyPath.IsEmpty() && !propertyPath.IsPrimPropertyPath()) {
+        propertyPath = propertyPath.GetParentPath();
     }
-    /// Append remaining specs
-    size_t remaining = std::distance(aIt, aEnd) + std::distance(bIt, bEnd);
-    if (remaining) {
-        auto   transformToPath = [](const typename T::value_type& spec) { return spec->GetPath(); };
-        size_t offset = output.size();
-        output.resize(offset + remaining);
-        std::transform(aIt, aEnd, output.begin() + offset, transformToPath);
-        offset += std::distance(aIt, aEnd);
-        std::transform(bIt, bEnd, output.begin() + offset, transformToPath);
+    return propertyPath;
+}
+
+/// \brief  checks whether the given path or one of its ancestors is in the sorted paths vector
+bool hasPrefixIn(const SdfPathVector& sortedPaths, const SdfPath& path)
+{
+    for (SdfPath prefix = path; !prefix.IsAbsoluteRootPath() && !prefix.IsEmpty();
+         prefix = prefix.GetParentPath()) {
+        if (std::binary_search(sortedPaths.begin(), sortedPaths.end(), prefix)) {
+            return true;
+        }
     }
+    return false;
 }
+} // anonymous namespace
 
-void comparePrims(
-    const SdfPrimSpecHandle& a,
-    const SdfPrimSpecHandle& b,
-    SdfPathVector&           resynced,
-    SdfPathVector&           changed)
+//----------------------------------------------------------------------------------------------------------------------
+/// \brief  Records the prims and properties edited in a layer while a transaction is opened, along
+///         with the original value of every edited property field, so that the changes can be
+///         computed at close without having to copy the layer at open.
+//----------------------------------------------------------------------------------------------------------------------
+class TransactionManager::ChangeJournal : public TfWeakBase
 {
-    assert(a && b);
-    /// Compare children
-    compareSpecViews(a->GetNameChildren(), b->GetNameChildren(), resynced, changed, comparePrims);
-    // Compare properties
-    auto compareProps = [](const SdfPropertySpecHandle& a,
-                           const SdfPropertySpecHandle& b,
-                           SdfPathVector&               output,
-                           SdfPathVector&               extra) {
-        const auto aFields = a->ListFields();
-        const auto bFields = b->ListFields();
-
-        if (aFields != bFields)
-            output.push_back(a->GetPath());
-        else {
-            /// Check field values
-            for (const auto& name : aFields) {
-                if (a->GetField(name) != b->GetField(name)) {
-                    output.push_back(a->GetPath());
-                    return;
+public:
+    ChangeJournal(const SdfLayerHandle& layer)
+        : m_layer(layer)
+    {
+        TfWeakPtr<ChangeJournal> self(this);
+        m_noticeKey = TfNotice::Register(self, &ChangeJournal::onLayersDidChange);
+    }
+
+    ~ChangeJournal() { TfNotice::Revoke(m_noticeKey); }
+
+    /// \brief  computes the topmost added or removed prims, and the changed properties outside of
+    ///         them, same as comparing the current layer content with a copy taken at open would.
+    ///         Prims that were removed and then added back are reported as resynced, even if they
+    ///         are identical to the original ones, since their original content is not recorded.
+    void computeChanges(SdfPathVector& resynced, SdfPathVector& changed) const
+    {
+        for (const auto& pathAndRecord : m_prims) {
+            if (pathAndRecord.second.existedBefore || m_layer->HasSpec(pathAndRecord.first)) {
+                resynced.push_back(pathAndRecord.first);
+            }
+        }
+        std::sort(resynced.begin(), resynced.end());
+        SdfPath::RemoveDescendentPaths(&resynced);
+
+        for (const auto& pathAndRecord : m_properties) {
+            const SdfPath&    path = pathAndRecord.first;
+            const SpecRecord& record = pathAndRecord.second;
+            if (hasPrefixIn(resynced, path.GetPrimPath())) {
+                continue;
+            }
+
+            const bool existsNow = m_layer->HasSpec(path);
+            if (!record.existedBefore && !existsNow) {
+                continue;
+            }
+            bool isChanged = record.existenceChanged || record.valuesUnknown;
+            for (const auto& fieldAndValue : record.originalFields) {
+                if (isChanged) {
+                    break;
                 }
+                isChanged = m_layer->GetField(path, fieldAndValue.first) != fieldAndValue.second;
+            }
+            if (isChanged) {
+                changed.push_back(path);
             }
         }
+        std::sort(changed.begin(), changed.end());
+    }
+
+private:
+    struct SpecRecord
+    {
+        bool existedBefore = true;
+        bool existenceChanged = false;
+        bool valuesUnknown = false;
+        std::unordered_map<TfToken, VtValue, TfToken::HashFunctor> originalFields;
     };
-    compareSpecViews(a->GetProperties(), b->GetProperties(), changed, resynced, compareProps);
-}
-} // anonymous namespace
+    typedef std::unordered_map<SdfPath, SpecRecord, SdfPath::Hash> SpecRecords;
+
+    /// \brief  gets the record of the given path, the first edit of a spec tells whether it existed
+    ///         when the transaction was opened
+    static SpecRecord& touch(SpecRecords& records, const SdfPath& path, bool isAdded)
+    {
+        auto pair = records.emplace(path, SpecRecord());
+        if (pair.second) {
+            pair.first->second.existedBefore = !isAdded;
+        }
+        return pair.first->second;
+    }
+
+    void recordExistence(SpecRecords& records, const SdfPath& path, bool isAdded)
+    {
+        touch(records, path, isAdded).existenceChanged = true;
+    }
+
+    void recordEntry(const SdfPath& path, const SdfChangeList::Entry& entry)
+    {
+        const auto& flags = entry.flags;
+        if (path.IsPrimPath()) {
+            // Prim fields are not reported, same as the children and properties of added prims.
+            if (flags.didRename) {
+                recordExistence(m_prims, entry.oldPath, false);
+                recordExistence(m_prims, path, true);
+            } else if (flags.didRemoveInertPrim || flags.didRemoveNonInertPrim) {
+                recordExistence(m_prims, path, false);
+            } else if (flags.didAddInertPrim || flags.didAddNonInertPrim) {
+                recordExistence(m_prims, path, true);
+            }
+            return;
+        }
+
+        const SdfPath propertyPath = getOwningPropertyPath(path);
+        if (propertyPath.IsEmpty()) {
+            return;
+        }
+        if (propertyPath != path) {
+            // Edits of targets, connections and mappers have no recorded value to compare with.
+            touch(m_properties, propertyPath, false).valuesUnknown = true;
+            return;
+        }
+
+        const bool isAdded = flags.didAddProperty || flags.didAddPropertyWithOnlyRequiredFields;
+        const bool isRemoved
+            = flags.didRemoveProperty || flags.didRemovePropertyWithOnlyRequiredFields;
+        if (flags.didRename) {
+            recordExistence(m_properties, entry.oldPath, false);
+            recordExistence(m_properties, path, true);
+        } else if (isAdded || isRemoved) {
+            recordExistence(m_properties, path, !isRemoved);
+        }
+
+        SpecRecord& record = touch(m_properties, path, false);
+        if (flags.didChangeAttributeTimeSamples || flags.didChangeAttributeConnection
+            || flags.didChangeRelationshipTargets) {
+            record.valuesUnknown = true;
+        }
+        // Only keep the value of the first edit of each field, which is the original one.
+        for (const auto& info : entry.infoChanged) {
+            record.originalFields.emplace(info.first, info.second.first);
+        }
+    }
+
+    void onLayersDidChange(const SdfNotice::LayersDidChange& notice)
+    {
+        for (const auto& layerAndChanges : notice.GetChangeListVec()) {
+            if (layerAndChanges.first != m_layer) {
+                continue;
+            }
+            for (const auto& pathAndEntry : layerAndChanges.second.GetEntryList()) {
+                const SdfPath& path = pathAndEntry.first;
+                // The full-layer comparison did not look into variants either.
+                if (path.IsAbsoluteRootPath() || path.ContainsPrimVariantSelection()) {
+                    continue;
+                }
+                recordEntry(path, pathAndEntry.second);
+            }
+        }
+    }
+
+    const SdfLayerHandle m_layer;
+    TfNotice::Key        m_noticeKey;
+    SpecRecords          m_prims;
+    SpecRecords          m_properties;
+};
 
 //----------------------------------------------------------------------------------------------------------------------
 TransactionManager::StageManagerMap& TransactionManager::GetManagers()
@@ -116,9 +227,7 @@ bool TransactionManager::Open(const SdfLayerHandle& layer)
     if (m_stage && layer) {
         auto pair = m_transactions.emplace(get_pointer(layer), TransactionData { nullptr, 1 });
         if (pair.second) {
-            auto& base = pair.first->second.base;
-            base = SdfLayer::CreateAnonymous("transaction_base");
-            base->TransferContent(layer);
+            pair.first->second.journal = std::make_shared<ChangeJournal>(layer);
             OpenNotice(layer).Send(m_stage);
         } else {
             ++pair.first->second.count;
@@ -137,11 +246,7 @@ bool TransactionManager::Close(const SdfLayerHandle& layer)
         if (it != m_transactions.end()) {
             if (--it->second.count == 0) {
                 SdfPathVector changedInfo, resynched;
-                comparePrims(
-                    it->second.base->GetPseudoRoot(),
-                    layer->GetPseudoRoot(),
-                    resynched,
-                    changedInfo);
+                it->second.journal->computeChanges(resynched, changedInfo);
                 CloseNotice(layer, std::move(changedInfo), std::move(resynched)).Send(m_stage);
                 m_transactions.erase(it);
             }
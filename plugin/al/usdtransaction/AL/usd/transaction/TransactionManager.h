@@ -20,6 +20,8 @@
 #include <pxr/base/tf/weakPtr.h>
 #include <pxr/pxr.h>
 
+#include <memory>
+
 namespace AL {
 namespace usd {
 namespace transaction {
@@ -32,9 +34,14 @@ namespace transaction {
 ///         as well as static interface where stage needs to be provided.
 ///
 ///         Whenever a new transaction (first one targeting given layer) is opened an OpenNotice is
-///         being emitted and snapshot of given layer is taken. Whenever last transaction targeting
-///         given layer for given stage is closed, targetted layer content is being compared against
-///         previously taken snapshot and CloseNotice is emitted with delta information.
+///         being emitted and edits of given layer start being recorded, along with the original
+///         value of every edited field. Whenever last transaction targeting given layer for given
+///         stage is closed, recorded edits are compared against the current layer content and
+///         CloseNotice is emitted with delta information. The cost of both is proportional to the
+///         edits made during the transaction, not to the size of the layer.
+///
+///         Edits are recorded from SdfNotice::LayersDidChange, so edits made inside an
+///         SdfChangeBlock are only taken into account once the change block is closed.
 ///
 /// \note   It's user responsibilty to pair Open with Close calls, otherwise clients might not
 /// respond to any
@@ -50,8 +57,8 @@ public:
     bool InProgress(const PXR_NS::SdfLayerHandle& layer) const;
 
     /// \brief  opens transaction, when transaction is opened for the first time OpenNotice is
-    /// emitted and current
-    ///         state of layer is recorded.
+    /// emitted and edits
+    ///         of layer start being recorded.
     /// \note   It's valid to call Open multiple times, but they need to balance Close calls
     /// \param  layer targetted by transaction
     /// \return true on success, false when layer or stage became invalid
@@ -60,7 +67,7 @@ public:
 
     /// \brief  closes transaction, when transaction is closed for the last time CloseNotice is
     /// emitted with change
-    ///         information based of difference between current and recorded layer states.
+    ///         information based of difference between current layer state and recorded edits.
     /// \note   It's valid to call Close multiple times, but they need to balance Open calls
     /// \param  layer targetted by transaction
     /// \return true on success, false when layer or stage became invalid or transaction wasn't
@@ -96,8 +103,8 @@ public:
     InProgress(const PXR_NS::UsdStageWeakPtr& stage, const PXR_NS::SdfLayerHandle& layer);
 
     /// \brief  opens transaction, when transaction is opened for the first time OpenNotice is
-    /// emitted and current
-    ///         state of layer is recorded.
+    /// emitted and edits
+    ///         of layer start being recorded.
     /// \note   It's valid to call Open multiple times, but they need to balance Close calls
     /// \param  stage that will be notified about transaction open/close
     /// \param  layer targetted by transaction
@@ -107,7 +114,7 @@ public:
 
     /// \brief  closes transaction, when transaction is closed for the last time CloseNotice is
     /// emitted with change
-    ///         information based of difference between current and recorded layer states.
+    ///         information based of difference between current layer state and recorded edits.
     /// \note   It's valid to call Close multiple times, but they need to balance Open calls
     /// \param  stage that will be notified about transaction open/close
     /// \param  layer targetted by transaction
@@ -130,10 +137,11 @@ private:
         : m_stage(stage)
     {
     }
+    class ChangeJournal;
     struct TransactionData
     {
-        PXR_NS::SdfLayerRefPtr base;
-        int                    count;
+        std::shared_ptr<ChangeJournal> journal;
+        int                            count;
     };
     const PXR_NS::UsdStageWeakPtr                          m_stage;
     std::unordered_map<PXR_NS::SdfLayer*, TransactionData> m_transactions;
@@ -296,6 +296,26 @@ TEST_F(TransactionTest, Clear)
         createPrimWithAttribute("/root");
         createPrimWithAttribute("/root/A");
         createPrimWithAttribute("/root/A/B");
+        /// the content of removed prims is not recorded, so recreating them is a resync
+    }
+    EXPECT_EQ(sorted(getChanged()), empty());
+    EXPECT_EQ(sorted(getResynced()), sorted({ "/root" }));
+}
+
+/// Test that CloseNotice ignores prims and properties created and removed during the transaction
+TEST_F(TransactionTest, Transient)
+{
+    {
+        ScopedTransaction transaction(m_stage, m_stage->GetSessionLayer());
+        createPrimWithAttribute("/root");
+    }
+    EXPECT_EQ(sorted(getResynced()), sorted({ "/root" }));
+    {
+        ScopedTransaction transaction(m_stage, m_stage->GetSessionLayer());
+        createPrimWithAttribute("/root/A");
+        createPrimWithAttribute("/root", "foo");
+        EXPECT_TRUE(m_stage->RemovePrim(SdfPath("/root/A")));
+        EXPECT_TRUE(m_stage->GetPrimAtPath(SdfPath("/root")).RemoveProperty(TfToken("foo")));
         /// effectively no change
     }
     EXPECT_EQ(sorted(getChanged()), empty());
@@ -193,6 +193,21 @@ class TestTransaction(unittest.TestCase):
             self.createPrimWithAttribute('/root')
             self.createPrimWithAttribute('/root/A')
             self.createPrimWithAttribute('/root/A/B')
+            ### the content of removed prims is not recorded, so recreating them is a resync
+        self.assertItemsEqual(self._changed, [])
+        self.assertItemsEqual(self._resynced, [Sdf.Path(x) for x in ['/root']])
+
+    ## Test that CloseNotice ignores prims and properties created and removed during the transaction
+    def test_Transient(self):
+        with transaction.ScopedTransaction(self._stage, self._stage.GetSessionLayer()):
+            self.createPrimWithAttribute('/root')
+        self.assertItemsEqual(self._resynced, [Sdf.Path(x) for x in ['/root']])
+
+        with transaction.ScopedTransaction(self._stage, self._stage.GetSessionLayer()):
+            self.createPrimWithAttribute('/root/A')
+            self.createPrimWithAttribute('/root', 'foo')
+            self._stage.RemovePrim('/root/A')
+            self._stage.GetPrimAtPath('/root').RemoveProperty('foo')
             ### effectively no change
         self.assertItemsEqual(self._changed, [])
         self.assertItemsEqual(self._resynced, [])
@@ -81,6 +81,31 @@ class EditAsMayaTestCase(unittest.TestCase):
             self.assertFalse(mayaUsd.lib.PrimUpdaterManager.canEditAsMaya(aUsdUfePathStr))
             self.assertFalse(mayaUsd.lib.PrimUpdaterManager.editAsMaya(aUsdUfePathStr))
 
+    def testCanEditAsMayaAnAncestorAfterDiscard(self):
+        '''Test that discarding the edits of a prim allows editing its ancestors again.'''
+
+        (_, _, _, aUsdUfePathStr, _, _,
+             _, _, bUsdUfePathStr, _, _) = createSimpleXformScene()
+
+        # Edit "B" Prim as Maya data.
+        with mayaUsd.lib.OpUndoItemList():
+            self.assertTrue(mayaUsd.lib.PrimUpdaterManager.editAsMaya(bUsdUfePathStr))
+
+        self.assertFalse(mayaUsd.lib.PrimUpdaterManager.canEditAsMaya(aUsdUfePathStr))
+        self.assertFalse(mayaUsd.lib.PrimUpdaterManager.canEditAsMaya(bUsdUfePathStr))
+
+        # Discard the "B" edits: its ancestor "A" Prim can be edited again.
+        bMayaPathStr = ufe.PathString.string(ufe.GlobalSelection.get().front().path())
+        cmds.mayaUsdDiscardEdits(bMayaPathStr)
+
+        self.assertTrue(mayaUsd.lib.PrimUpdaterManager.canEditAsMaya(aUsdUfePathStr))
+        self.assertTrue(mayaUsd.lib.PrimUpdaterManager.canEditAsMaya(bUsdUfePathStr))
+
+        # Undoing the discard brings the "B" edits back.
+        cmds.undo()
+
+        self.assertFalse(mayaUsd.lib.PrimUpdaterManager.canEditAsMaya(aUsdUfePathStr))
+
     @unittest.skipIf(os.getenv('HAS_ORPHANED_NODES_MANAGER', '0') != '1', 'Test only available when UFE supports the orphaned nodes manager')
     def testRenameAncestorOfEditAsMaya(self):
         '''Test that renaming an ancestor correctly updates the internal data.'''
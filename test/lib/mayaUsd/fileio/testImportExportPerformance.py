@@ -0,0 +1,256 @@
+#!/usr/bin/env mayapy
+#
+# Copyright 2024 Autodesk
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+'''
+Benchmarks of the mayaUSDExport and mayaUSDImport commands on procedurally
+generated scenes.
+
+Each benchmark records its wall time, the peak resident set size of the
+process and the time spent in each import and export job phase and in each
+translator and chaser, as measured by the perfReport option of the commands.
+The results of all the benchmarks
+are written to importExportPerformance.json in the test output directory.
+
+The size of the generated scenes can be multiplied by setting the
+MAYAUSD_BENCHMARK_SCALE environment variable, for example to profile exports
+of production-sized scenes.
+'''
+
+from pxr import Tf
+from pxr import Usd
+
+from maya import cmds
+from maya import standalone
+
+import fixturesUtils
+
+import contextlib
+import json
+import os
+import sys
+import unittest
+
+try:
+    import resource
+except ImportError:
+    # Not available on Windows: peak memory is not reported there.
+    resource = None
+
+
+def _getPeakRSSMegabytes():
+    if resource is None:
+        return None
+    peakRSS = resource.getrusage(resource.RUSAGE_SELF).ru_maxrss
+    # Reported in bytes on macOS and in kilobytes on Linux.
+    if sys.platform == 'darwin':
+        return peakRSS / (1024.0 * 1024.0)
+    return peakRSS / 1024.0
+
+
+class testImportExportPerformance(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        fixturesUtils.setUpClass(__file__)
+
+        cls._testDir = os.path.abspath('.')
+        cls._scale = max(1, int(os.environ.get('MAYAUSD_BENCHMARK_SCALE', '1')))
+        cls._results = dict()
+
+    @classmethod
+    def tearDownClass(cls):
+        resultsFilePath = os.path.join(cls._testDir, 'importExportPerformance.json')
+        with open(resultsFilePath, 'w') as resultsFile:
+            json.dump(cls._results, resultsFile, indent=4, sort_keys=True)
+
+        standalone.uninitialize()
+
+    def setUp(self):
+        cmds.file(new=True, force=True)
+
+    @staticmethod
+    def _ReadPerfReportTotals(perfReportFilePath):
+        '''
+        Returns the total time in seconds and the number of calls of each
+        timed scope of the job that wrote the given performance report.
+        '''
+        if not os.path.exists(perfReportFilePath):
+            return None
+        with open(perfReportFilePath) as perfReportFile:
+            return json.load(perfReportFile)['totals']
+
+    @contextlib.contextmanager
+    def _Benchmark(self, benchmarkName, perfReportFilePath, **sceneDescription):
+        '''
+        A context manager that measures the execution of its body, which must
+        run a job writing its performance report to perfReportFilePath, and
+        stores the results in the class' results dictionary.
+        '''
+        stopwatch = Tf.Stopwatch()
+        peakRSSBefore = _getPeakRSSMegabytes()
+
+        try:
+            stopwatch.Start()
+            yield
+        finally:
+            stopwatch.Stop()
+
+            peakRSSAfter = _getPeakRSSMegabytes()
+            result = {
+                'scene': sceneDescription,
+                'wallTimeSeconds': stopwatch.seconds,
+                'peakRSSMegabytes': peakRSSAfter,
+                # The peak is process-wide: this only grows when the benchmark
+                # needed more memory than all the previous ones.
+                'peakRSSGrowthMegabytes': (peakRSSAfter - peakRSSBefore)
+                    if peakRSSAfter is not None else None,
+                'phases': self._ReadPerfReportTotals(perfReportFilePath),
+            }
+            self._results[benchmarkName] = result
+            Tf.Status('%s: %f' % (benchmarkName, stopwatch.seconds))
+
+    def _ExportAndImport(self, name, exportArgs, **sceneDescription):
+        usdFilePath = os.path.join(self._testDir, name + '.usdc')
+        exportReportFilePath = os.path.join(self._testDir, name + '_export.json')
+        importReportFilePath = os.path.join(self._testDir, name + '_import.json')
+
+        with self._Benchmark(name + ' export', exportReportFilePath, **sceneDescription):
+            cmds.mayaUSDExport(file=usdFilePath, perfReport=exportReportFilePath,
+                **exportArgs)
+
+        stage = Usd.Stage.Open(usdFilePath)
+        self.assertTrue(stage)
+        sceneDescription['primCount'] = len(list(stage.TraverseAll()))
+        del stage
+
+        cmds.file(new=True, force=True)
+
+        with self._Benchmark(name + ' import', importReportFilePath, **sceneDescription):
+            cmds.mayaUSDImport(file=usdFilePath, perfReport=importReportFilePath)
+
+    @staticmethod
+    def _Animate(nodeName, attrName, frameCount):
+        cmds.setKeyframe(nodeName, attribute=attrName, time=1, value=0.0)
+        cmds.setKeyframe(nodeName, attribute=attrName, time=frameCount, value=10.0)
+
+    def testManyMeshes(self):
+        '''
+        Many dense static meshes: dominated by mesh topology and primvars.
+        '''
+        meshCount = 64 * self._scale
+        subdivisions = 100
+        for i in range(meshCount):
+            cmds.polyPlane(name='plane%d' % i,
+                subdivisionsX=subdivisions, subdivisionsY=subdivisions)
+
+        self._ExportAndImport('manyMeshes', {},
+            meshCount=meshCount,
+            vertsPerMesh=(subdivisions + 1) * (subdivisions + 1))
+
+    def testAnimatedMeshes(self):
+        '''
+        Meshes with animated transforms and points: dominated by the per-frame
+        export of time samples.
+        '''
+        meshCount = 16 * self._scale
+        frameCount = 48
+        subdivisions = 50
+        for i in range(meshCount):
+            planeName = cmds.polyPlane(name='animPlane%d' % i,
+                subdivisionsX=subdivisions, subdivisionsY=subdivisions)[0]
+            self._Animate(planeName, 'translateY', frameCount)
+            bend = cmds.nonLinear(planeName, type='bend')[0]
+            self._Animate(bend, 'curvature', frameCount)
+
+        self._ExportAndImport('animatedMeshes', {'frameRange': (1, frameCount)},
+            meshCount=meshCount,
+            vertsPerMesh=(subdivisions + 1) * (subdivisions + 1),
+            frameCount=frameCount)
+
+    def testDeepHierarchy(self):
+        '''
+        Deep hierarchies of animated transforms: dominated by the per-prim
+        overhead of the jobs.
+        '''
+        chainCount = 16 * self._scale
+        depth = 64
+        frameCount = 24
+        for i in range(chainCount):
+            parent = cmds.group(empty=True, name='chain%d_0' % i)
+            for level in range(1, depth):
+                parent = cmds.group(empty=True, name='chain%d_%d' % (i, level),
+                    parent=parent)
+            self._Animate(parent, 'rotateY', frameCount)
+            cmds.polyCube(name='leaf%d' % i)
+            cmds.parent('leaf%d' % i, parent)
+
+        self._ExportAndImport('deepHierarchy', {'frameRange': (1, frameCount)},
+            chainCount=chainCount,
+            depth=depth,
+            frameCount=frameCount)
+
+    def testSkinnedCharacters(self):
+        '''
+        Skinned cylinders driven by animated joint chains: dominated by the
+        skeleton and skin weights export and import.
+        '''
+        characterCount = 4 * self._scale
+        jointCount = 32
+        frameCount = 24
+        for i in range(characterCount):
+            cmds.select(clear=True)
+            joints = []
+            for j in range(jointCount):
+                joints.append(cmds.joint(name='char%d_joint%d' % (i, j),
+                    position=(i * 10.0, j * 1.0, 0.0)))
+            for joint in joints[1:]:
+                self._Animate(joint, 'rotateZ', frameCount)
+
+            body = cmds.polyCylinder(name='char%d_body' % i, height=jointCount,
+                subdivisionsX=64, subdivisionsY=jointCount * 4)[0]
+            cmds.move(i * 10.0, jointCount * 0.5, 0.0, body)
+            cmds.skinCluster(joints[0], body, maximumInfluences=4)
+
+        self._ExportAndImport('skinnedCharacters',
+            {'frameRange': (1, frameCount), 'exportSkels': 'auto',
+             'exportSkin': 'auto'},
+            characterCount=characterCount,
+            jointCount=jointCount,
+            frameCount=frameCount)
+
+    def testInstancers(self):
+        '''
+        Particle instancers with many instances: dominated by the point
+        instancer attributes.
+        '''
+        instancerCount = 4 * self._scale
+        instanceCount = 10000
+        for i in range(instancerCount):
+            positions = [(float(p % 100), float(i), float(p // 100))
+                for p in range(instanceCount)]
+            particle = cmds.particle(position=positions,
+                name='particles%d' % i)[1]
+            prototype = cmds.polyCube(name='prototype%d' % i)[0]
+            cmds.particleInstancer(particle, addObject=True, object=prototype)
+
+        self._ExportAndImport('instancers', {},
+            instancerCount=instancerCount,
+            instanceCount=instanceCount)
+
+
+if __name__ == '__main__':
+    unittest.main(verbosity=2)
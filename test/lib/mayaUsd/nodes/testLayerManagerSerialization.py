@@ -173,6 +173,41 @@ class testLayerManagerSerialization(unittest.TestCase):
 
         shutil.rmtree(self._currentTestDir)
 
+    def testSaveAllToMayaAsBinary(self):
+        '''
+        Verify that USD edits saved into the Maya file as binary and
+        compressed binary data are restored when the file is reopened.
+        '''
+        for formatOption in [1, 2]:
+            stage = self.copyTestFilesAndMakeEdits()
+
+            cmds.optionVar(intValue=('mayaUsd_SerializedUsdEditsLocation', 2))
+            cmds.optionVar(intValue=('mayaUsd_SerializedUsdEditsFormat', formatOption))
+
+            cmds.file(save=True, force=True)
+            cmds.file(new=True, force=True)
+
+            cmds.file(self._tempMayaFile, open=True)
+
+            stage = mayaUsd.ufe.getStage(
+                "|SerializationTest|SerializationTestShape")
+            stack = stage.GetLayerStack()
+            self.assertEqual(6, len(stack))
+
+            newPrimPath = "/ChangeInRoot"
+            self.assertTrue(stage.GetPrimAtPath(newPrimPath))
+
+            newPrimPath = "/ChangeInLayer_1_1"
+            self.assertTrue(stage.GetPrimAtPath(newPrimPath))
+
+            newPrimPath = "/ChangeInSessionLayer"
+            self.assertTrue(stage.GetPrimAtPath(newPrimPath))
+
+            self.confirmEditsSavedStatus(False, False)
+
+            cmds.optionVar(remove='mayaUsd_SerializedUsdEditsFormat')
+            shutil.rmtree(self._currentTestDir)
+
     def testSaveAllToUsd(self):
         '''
         Verify that all USD edits are saved back to the original .usd files
@@ -64,6 +64,50 @@ class testProxyShapeBase(unittest.TestCase):
         bboxSize = cmds.getAttr('Cube_usd.boundingBoxSize')[0]
         self.assertEqual(bboxSize, (1.0, 1.0, 1.0))
 
+    def testBoundingBoxIncrementalUpdates(self):
+        '''
+        Verify that the cached prim bounds are updated by stage edits.
+        '''
+        cmds.file(new=True, force=True)
+
+        proxyShape = mayaUsd_createStageWithNewLayer.createStageWithNewLayer()
+        stage = mayaUsd.ufe.getStage(proxyShape)
+
+        UsdGeom.Cube.Define(stage, '/A/Cube').CreateSizeAttr(2.0)
+        UsdGeom.Cube.Define(stage, '/B/Cube').CreateSizeAttr(2.0)
+
+        def bboxMinMax():
+            return (cmds.getAttr(proxyShape + '.boundingBoxMin')[0],
+                    cmds.getAttr(proxyShape + '.boundingBoxMax')[0])
+
+        self.assertEqual(bboxMinMax(), ((-1.0, -1.0, -1.0), (1.0, 1.0, 1.0)))
+
+        # Changing a transform only affects the bounds of the ancestors.
+        UsdGeom.Xformable(stage.GetPrimAtPath('/B')).AddTranslateOp().Set((4.0, 0.0, 0.0))
+        self.assertEqual(bboxMinMax(), ((-1.0, -1.0, -1.0), (5.0, 1.0, 1.0)))
+
+        # Changing an attribute of a prim affects its own bound.
+        stage.GetPrimAtPath('/A/Cube').GetAttribute('size').Set(4.0)
+        self.assertEqual(bboxMinMax(), ((-2.0, -2.0, -2.0), (5.0, 2.0, 2.0)))
+
+        # Visibility is inherited by the whole subtree.
+        UsdGeom.Imageable(stage.GetPrimAtPath('/B')).MakeInvisible()
+        self.assertEqual(bboxMinMax(), ((-2.0, -2.0, -2.0), (2.0, 2.0, 2.0)))
+
+        UsdGeom.Imageable(stage.GetPrimAtPath('/B')).MakeVisible()
+        self.assertEqual(bboxMinMax(), ((-2.0, -2.0, -2.0), (5.0, 2.0, 2.0)))
+
+        # The purpose is inherited by the children without an authored purpose.
+        UsdGeom.Imageable(stage.GetPrimAtPath('/A')).CreatePurposeAttr(UsdGeom.Tokens.guide)
+        self.assertEqual(bboxMinMax(), ((3.0, -1.0, -1.0), (5.0, 1.0, 1.0)))
+
+        UsdGeom.Imageable(stage.GetPrimAtPath('/A')).GetPurposeAttr().Clear()
+        self.assertEqual(bboxMinMax(), ((-2.0, -2.0, -2.0), (5.0, 2.0, 2.0)))
+
+        # Removing a prim resyncs its subtree.
+        stage.RemovePrim('/A')
+        self.assertEqual(bboxMinMax(), ((3.0, -1.0, -1.0), (5.0, 1.0, 1.0)))
+
     def testDuplicateProxyStageAnonymous(self):
         '''
         Verify stage with new anonymous layer is duplicated properly.
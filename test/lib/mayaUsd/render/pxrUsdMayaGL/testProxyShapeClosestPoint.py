@@ -0,0 +1,138 @@
+#!/usr/bin/env mayapy
+#
+# Copyright 2024 Autodesk
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+from pxr import Sdf, UsdGeom
+
+from maya import OpenMayaUI as OMUI
+from maya import cmds
+
+try:
+    from PySide2 import QtCore
+    from PySide2.QtTest import QTest
+    from PySide2.QtWidgets import QWidget
+    from shiboken2 import wrapInstance
+except Exception:
+    from PySide6 import QtCore
+    from PySide6.QtTest import QTest
+    from PySide6.QtWidgets import QWidget
+    from shiboken6 import wrapInstance
+
+import unittest
+
+import fixturesUtils
+import mayaUtils
+
+
+class testProxyShapeClosestPoint(unittest.TestCase):
+    """
+    Tests that objects created on a live proxy shape are placed on the
+    visible meshes of the stage, which are intersected on the CPU.
+    """
+
+    @classmethod
+    def setUpClass(cls):
+        fixturesUtils.readOnlySetUpClass(__file__, initializeStandalone=False)
+
+    def setUp(self):
+        cmds.file(new=True, force=True)
+        cmds.upAxis(axis='y')
+
+        self._proxyShape, self._stage = mayaUtils.createProxyAndStage()
+        self._addPlane('/Ground', 0.0)
+
+        # Look straight down at the origin, so that clicking in the center of
+        # the viewport casts a ray along -Y.
+        camera = cmds.camera()[0]
+        cmds.xform(camera, translation=(0.0, 20.0, 0.0), rotation=(-90.0, 0.0, 0.0))
+
+        self._window = cmds.window(widthHeight=(500, 400))
+        cmds.paneLayout()
+        self._panel = cmds.modelPanel()
+        cmds.modelPanel(self._panel, edit=True, camera=camera)
+        cmds.showWindow(self._window)
+        cmds.refresh()
+
+        self._view = OMUI.M3dView().active3dView()
+        self._viewWidget = wrapInstance(int(self._view.widget()), QWidget)
+
+    def tearDown(self):
+        self._viewWidget = None
+        self._view = None
+        cmds.deleteUI(self._window)
+
+    def _addPlane(self, path, height):
+        mesh = UsdGeom.Mesh.Define(self._stage, path)
+        mesh.CreatePointsAttr(
+            [(-5, height, -5), (-5, height, 5), (5, height, 5), (5, height, -5)])
+        mesh.CreateFaceVertexCountsAttr([4])
+        mesh.CreateFaceVertexIndicesAttr([0, 1, 2, 3])
+        mesh.CreateExtentAttr([(-5, height, -5), (5, height, 5)])
+        return mesh
+
+    def _createTorusHeight(self, torusName):
+        """
+        Creates a torus by clicking in the center of the viewport and returns
+        its height, which is the height of the live surface under the click.
+        """
+        cmds.makeLive(self._proxyShape)
+        cmds.setToolTo('CreatePolyTorusCtx')
+        QTest.mouseClick(self._viewWidget, QtCore.Qt.LeftButton,
+            QtCore.Qt.NoModifier, self._viewWidget.rect().center())
+        cmds.makeLive(none=True)
+
+        self.assertTrue(cmds.ls(torusName))
+        return cmds.xform(torusName, q=True, t=True)[1]
+
+    def testInvisibleParent(self):
+        hidden = UsdGeom.Xform.Define(self._stage, '/Hidden')
+        self._addPlane('/Hidden/Plane', 4.0)
+        hidden.MakeInvisible()
+
+        self.assertAlmostEqual(self._createTorusHeight('pTorus1'), 0.0, places=3)
+
+        hidden.MakeVisible()
+        self.assertAlmostEqual(self._createTorusHeight('pTorus2'), 4.0, places=3)
+
+    def testExcludedPrimPath(self):
+        self._addPlane('/Excluded', 3.0)
+        self.assertAlmostEqual(self._createTorusHeight('pTorus1'), 3.0, places=3)
+
+        cmds.setAttr(self._proxyShape + '.excludePrimPaths', '/Excluded', type='string')
+        self.assertAlmostEqual(self._createTorusHeight('pTorus2'), 0.0, places=3)
+
+    def testInstancedMesh(self):
+        self._stage.CreateClassPrim('/Prototype')
+        self._addPlane('/Prototype/Plane', 0.0)
+
+        instance = UsdGeom.Xform.Define(self._stage, '/Instance')
+        instance.AddTranslateOp().Set((0.0, 6.0, 0.0))
+        instance.GetPrim().GetReferences().AddInternalReference(Sdf.Path('/Prototype'))
+        instance.GetPrim().SetInstanceable(True)
+
+        self.assertAlmostEqual(self._createTorusHeight('pTorus1'), 6.0, places=3)
+
+    def testCannotMakeLiveWithoutMesh(self):
+        self._stage.RemovePrim('/Ground')
+        try:
+            cmds.makeLive(self._proxyShape)
+        except RuntimeError:
+            pass
+        self.assertFalse(cmds.makeLive(query=True))
+
+
+if __name__ == '__main__':
+    fixturesUtils.runTests(globals())
@@ -0,0 +1,213 @@
+//
+// Copyright 2024 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include <mayaUsd/render/MaterialXGenOgsXml/OgsFragment.h>
+#include <mayaUsd/render/MaterialXGenOgsXml/OgsXmlGenerator.h>
+
+#include <pxr/base/tf/getenv.h>
+#include <pxr/base/work/loops.h>
+#include <pxr/imaging/hdMtlx/hdMtlx.h>
+
+#include <MaterialXCore/Document.h>
+#include <MaterialXFormat/File.h>
+#include <MaterialXFormat/Util.h>
+#include <MaterialXFormat/XmlIo.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+
+// Timings of one stage of the fragment generation, over all the materials of the corpus.
+struct Stage
+{
+    explicit Stage(const char* name)
+        : name(name)
+    {
+    }
+
+    template <typename Fn> void measure(const Fn& fn)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        fn();
+        const std::chrono::duration<double, std::milli> duration
+            = std::chrono::steady_clock::now() - start;
+        milliseconds += duration.count();
+        ++count;
+    }
+
+    void print() const
+    {
+        std::cout << std::setw(12) << name << ": " << count << " runs, " << std::fixed
+                  << std::setprecision(2) << milliseconds << " ms" << std::endl;
+    }
+
+    const char* name;
+    double      milliseconds = 0.0;
+    size_t      count = 0;
+};
+
+// Documents with a material using each of the library surface shaders that matter most.
+mx::DocumentPtr createSurfaceDocument(const mx::DocumentPtr& library, const std::string& nodeDef)
+{
+    mx::DocumentPtr doc = mx::createDocument();
+    doc->importLibrary(library);
+
+    mx::NodeDefPtr def = library->getNodeDef(nodeDef);
+    if (!def) {
+        return nullptr;
+    }
+    mx::NodePtr shader = doc->addNodeInstance(def, "Surface");
+    mx::NodePtr material = doc->addMaterialNode("Material", shader);
+    return material ? doc : nullptr;
+}
+
+// The test documents, along with the ones of the directory in the
+// MAYAUSD_MATERIALX_BENCHMARK_CORPUS environment variable, if any.
+std::vector<mx::FilePath> getCorpusFiles()
+{
+    std::vector<mx::FilePath> files { mx::FilePath(MATERIALX_TEST_DATA) / "topology_tests.mtlx" };
+
+    const std::string corpusDir = PXR_NS::TfGetenv("MAYAUSD_MATERIALX_BENCHMARK_CORPUS");
+    if (!corpusDir.empty()) {
+        const mx::FilePath corpusPath(corpusDir);
+        for (const mx::FilePath& file : corpusPath.getFilesInDirectory("mtlx")) {
+            files.push_back(corpusPath / file);
+        }
+    }
+    return files;
+}
+
+} // namespace
+
+TEST(MaterialXGenOgsXml, benchmark)
+{
+#ifdef MAYA_LIGHTAPI_VERSION_2
+    mx::OgsXmlGenerator::setUseLightAPI(MAYA_LIGHTAPI_VERSION_2);
+#endif
+
+    Stage loadLibraries("libraries");
+    Stage readDocument("read");
+    Stage generateFragment("fragment");
+    Stage emitXml("xml");
+    Stage generateInParallel("parallel");
+
+    const mx::FileSearchPath searchPath = PXR_NS::HdMtlxSearchPaths();
+    mx::DocumentPtr          library;
+    loadLibraries.measure([&]() {
+        library = mx::createDocument();
+        mx::loadLibraries({}, searchPath, library);
+    });
+    ASSERT_TRUE(library != nullptr);
+
+    std::vector<mx::DocumentPtr> documents;
+    for (const char* nodeDef :
+         { "ND_standard_surface_surfaceshader", "ND_UsdPreviewSurface_surfaceshader" }) {
+        mx::DocumentPtr doc = createSurfaceDocument(library, nodeDef);
+        ASSERT_TRUE(doc != nullptr) << "Missing library node definition " << nodeDef;
+        documents.push_back(doc);
+    }
+
+    for (const mx::FilePath& file : getCorpusFiles()) {
+        readDocument.measure([&]() {
+            mx::DocumentPtr doc = mx::createDocument();
+            doc->importLibrary(library);
+            const mx::XmlReadOptions readOptions;
+            mx::readFromXmlFile(doc, file, mx::EMPTY_STRING, &readOptions);
+            documents.push_back(doc);
+        });
+    }
+
+    // Same settings as the viewport default, without reading the Maya option variables.
+    MaterialXMaya::OgsFragment::SpecularEnvironment specularEnvironment;
+    specularEnvironment.method = mx::SPECULAR_ENVIRONMENT_PREFILTER;
+
+    // Materials and fragments generated one at a time, compared with the parallel generation.
+    struct Generated
+    {
+        mx::NodePtr material;
+        std::string name;
+        std::string source;
+    };
+    std::vector<Generated> generated;
+
+    size_t numFragments = 0;
+    for (const mx::DocumentPtr& doc : documents) {
+        for (const mx::NodePtr& material : doc->getMaterialNodes()) {
+            if (material->getName().rfind("Broken", 0) == 0) {
+                continue;
+            }
+
+            std::unique_ptr<MaterialXMaya::OgsFragment> fragment;
+            generateFragment.measure([&]() {
+                fragment.reset(
+                    new MaterialXMaya::OgsFragment(material, searchPath, specularEnvironment));
+            });
+            ASSERT_FALSE(fragment->getFragmentSource().empty()) << material->getNamePath();
+            ++numFragments;
+
+            // The XML emission is also part of the fragment generation above.
+            std::string xml;
+            emitXml.measure([&]() {
+                xml = mx::OgsXmlGenerator::generate(
+                    fragment->getFragmentName(), *fragment->getShader(), std::string());
+            });
+            ASSERT_FALSE(xml.empty()) << material->getNamePath();
+
+            // The generation must be deterministic, for the generated fragments to be shared
+            // across materials and sessions.
+            MaterialXMaya::OgsFragment regenerated(material, searchPath, specularEnvironment);
+            EXPECT_EQ(regenerated.getFragmentName(), fragment->getFragmentName())
+                << material->getNamePath();
+            EXPECT_EQ(regenerated.getFragmentSource(), fragment->getFragmentSource())
+                << material->getNamePath();
+
+            generated.push_back(
+                { material, fragment->getFragmentName(), fragment->getFragmentSource() });
+        }
+    }
+    EXPECT_GT(numFragments, 2u);
+
+    // Same generation as HdVP2Material::PrepareMaterialXFragments(), which generates the
+    // fragments of the dirty materials concurrently.
+    std::vector<std::unique_ptr<MaterialXMaya::OgsFragment>> parallelFragments(generated.size());
+    generateInParallel.measure([&]() {
+        PXR_NS::WorkParallelForN(generated.size(), [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                parallelFragments[i].reset(new MaterialXMaya::OgsFragment(
+                    generated[i].material, searchPath, specularEnvironment));
+            }
+        });
+    });
+    for (size_t i = 0; i < generated.size(); ++i) {
+        ASSERT_TRUE(parallelFragments[i] != nullptr);
+        EXPECT_EQ(parallelFragments[i]->getFragmentName(), generated[i].name)
+            << generated[i].material->getNamePath();
+        EXPECT_EQ(parallelFragments[i]->getFragmentSource(), generated[i].source)
+            << generated[i].material->getNamePath();
+    }
+
+    std::cout << "Generating " << numFragments << " MaterialX OGS fragments:" << std::endl;
+    loadLibraries.print();
+    readDocument.print();
+    generateFragment.print();
+    emitXml.print();
+    generateInParallel.print();
+}
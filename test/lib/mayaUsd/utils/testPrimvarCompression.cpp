@@ -0,0 +1,405 @@
+//
+// Copyright 2024 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include <mayaUsd/utils/util.h>
+
+#include <pxr/base/gf/math.h>
+#include <pxr/base/gf/vec2f.h>
+#include <pxr/base/vt/array.h>
+#include <pxr/usd/usdGeom/tokens.h>
+
+#include <maya/MFloatPointArray.h>
+#include <maya/MFnMesh.h>
+#include <maya/MFnMeshData.h>
+#include <maya/MIntArray.h>
+#include <maya/MLibrary.h>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <random>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+namespace {
+
+// The MFnMesh overload needs Maya to be initialized.
+class MayaEnvironment : public ::testing::Environment
+{
+public:
+    void SetUp() override
+    {
+        static char applicationName[] = "testPrimvarCompression";
+        ASSERT_TRUE(MLibrary::initialize(applicationName));
+    }
+
+    void TearDown() override { MLibrary::cleanup(0, false); }
+};
+
+::testing::Environment* const mayaEnvironment
+    = ::testing::AddGlobalTestEnvironment(new MayaEnvironment);
+
+// Grid of numRows x numColumns quads, with its face-vertex topology.
+struct Grid
+{
+    Grid(int numRows, int numColumns)
+        : numVertices((numRows + 1) * (numColumns + 1))
+    {
+        for (int row = 0; row < numRows; ++row) {
+            for (int column = 0; column < numColumns; ++column) {
+                const int corner = row * (numColumns + 1) + column;
+                faceVertexCounts.push_back(4);
+                faceVertexIndices.push_back(corner);
+                faceVertexIndices.push_back(corner + 1);
+                faceVertexIndices.push_back(corner + numColumns + 2);
+                faceVertexIndices.push_back(corner + numColumns + 1);
+            }
+        }
+    }
+
+    int              numVertices;
+    std::vector<int> faceVertexCounts;
+    std::vector<int> faceVertexIndices;
+};
+
+// The implementations that were used before the array-based ones, over plain
+// arrays instead of MFnMesh, used as references for results and timings.
+struct Vec2fHash
+{
+    std::size_t operator()(const GfVec2f& value) const { return hash_value(value); }
+};
+
+struct Vec2fEqual
+{
+    bool operator()(const GfVec2f& a, const GfVec2f& b) const { return GfIsClose(a, b, 1e-9); }
+};
+
+void referenceMergeEquivalentIndexedValues(VtVec2fArray* valueData, VtIntArray* assignmentIndices)
+{
+    const size_t numValues = valueData->size();
+    if (numValues == 0u) {
+        return;
+    }
+
+    std::unordered_map<GfVec2f, size_t, Vec2fHash, Vec2fEqual> valuesMap;
+    VtVec2fArray                                                uniqueValues;
+    VtIntArray                                                  uniqueIndices;
+
+    for (int index : *assignmentIndices) {
+        if (index < 0 || static_cast<size_t>(index) >= numValues) {
+            uniqueIndices.push_back(index);
+            continue;
+        }
+
+        const GfVec2f value = (*valueData)[index];
+        auto inserted = valuesMap.insert(std::pair<GfVec2f, size_t>(value, uniqueValues.size()));
+        if (inserted.second) {
+            uniqueValues.push_back(value);
+        }
+        uniqueIndices.push_back(static_cast<int>(inserted.first->second));
+    }
+
+    if (uniqueValues.size() < numValues) {
+        (*valueData) = uniqueValues;
+        (*assignmentIndices) = uniqueIndices;
+    }
+}
+
+void referenceCompressFaceVaryingPrimvarIndices(
+    const Grid& grid,
+    TfToken*    interpolation,
+    VtIntArray* assignmentIndices)
+{
+    VtIntArray uniformAssignments;
+    uniformAssignments.assign(grid.faceVertexCounts.size(), -2);
+    VtIntArray vertexAssignments;
+    vertexAssignments.assign(grid.numVertices, -2);
+
+    bool isConstant = true;
+    bool isUniform = true;
+    bool isVertex = true;
+
+    size_t fvi = 0;
+    for (size_t face = 0; face < grid.faceVertexCounts.size(); ++face) {
+        for (int v = 0; v < grid.faceVertexCounts[face]; ++v, ++fvi) {
+            const int vertexIndex = grid.faceVertexIndices[fvi];
+            const int assignedIndex = (*assignmentIndices)[fvi];
+
+            if (isConstant && assignedIndex != (*assignmentIndices)[0]) {
+                isConstant = false;
+            }
+            if (isUniform) {
+                if (uniformAssignments[face] < -1) {
+                    uniformAssignments[face] = assignedIndex;
+                } else if (assignedIndex != uniformAssignments[face]) {
+                    isUniform = false;
+                }
+            }
+            if (isVertex) {
+                if (vertexAssignments[vertexIndex] < -1) {
+                    vertexAssignments[vertexIndex] = assignedIndex;
+                } else if (assignedIndex != vertexAssignments[vertexIndex]) {
+                    isVertex = false;
+                }
+            }
+        }
+    }
+
+    if (isConstant) {
+        assignmentIndices->resize(1);
+        *interpolation = UsdGeomTokens->constant;
+    } else if (isUniform) {
+        *assignmentIndices = uniformAssignments;
+        *interpolation = UsdGeomTokens->uniform;
+    } else if (isVertex) {
+        *assignmentIndices = vertexAssignments;
+        *interpolation = UsdGeomTokens->vertex;
+    } else {
+        *interpolation = UsdGeomTokens->faceVarying;
+    }
+}
+
+void compress(const Grid& grid, TfToken* interpolation, VtIntArray* assignmentIndices)
+{
+    UsdMayaUtil::CompressFaceVaryingPrimvarIndices(
+        TfSpan<const int>(grid.faceVertexCounts),
+        TfSpan<const int>(grid.faceVertexIndices),
+        grid.numVertices,
+        interpolation,
+        assignmentIndices);
+}
+
+// One UV per face-vertex of the grid, before merging. The faces of every
+// seamInterval-th column are offset, which creates UV seams.
+void makeGridUVs(const Grid& grid, int numColumns, int seamInterval, VtVec2fArray* uvs)
+{
+    const size_t numFaceVertices = grid.faceVertexIndices.size();
+    uvs->resize(numFaceVertices);
+    for (size_t fvi = 0; fvi < numFaceVertices; ++fvi) {
+        const int   vertex = grid.faceVertexIndices[fvi];
+        const int   faceColumn = static_cast<int>(fvi / 4) % numColumns;
+        const float offset = (faceColumn % seamInterval == 0) ? 0.5f : 0.0f;
+        (*uvs)[fvi] = GfVec2f(vertex % (numColumns + 1) + offset, vertex / (numColumns + 1));
+    }
+}
+
+VtIntArray identityIndices(size_t size)
+{
+    VtIntArray indices(size);
+    for (size_t i = 0; i < size; ++i) {
+        indices[i] = static_cast<int>(i);
+    }
+    return indices;
+}
+
+// Creates the mesh of the grid in \p meshFn. The returned mesh data owns the mesh.
+MObject createGridMesh(const Grid& grid, int numColumns, MFnMesh& meshFn)
+{
+    MFloatPointArray points;
+    for (int vertex = 0; vertex < grid.numVertices; ++vertex) {
+        points.append(
+            static_cast<float>(vertex % (numColumns + 1)),
+            static_cast<float>(vertex / (numColumns + 1)),
+            0.0f);
+    }
+
+    MIntArray faceVertexCounts;
+    for (int count : grid.faceVertexCounts) {
+        faceVertexCounts.append(count);
+    }
+    MIntArray faceVertexIndices;
+    for (int vertex : grid.faceVertexIndices) {
+        faceVertexIndices.append(vertex);
+    }
+
+    MFnMeshData meshDataFn;
+    MObject     meshData = meshDataFn.create();
+    meshFn.create(
+        grid.numVertices,
+        faceVertexCounts.length(),
+        points,
+        faceVertexCounts,
+        faceVertexIndices,
+        meshData);
+    return meshData;
+}
+
+template <typename Fn> double milliseconds(const Fn& fn)
+{
+    const auto start = std::chrono::steady_clock::now();
+    fn();
+    const std::chrono::duration<double, std::milli> duration
+        = std::chrono::steady_clock::now() - start;
+    return duration.count();
+}
+
+} // namespace
+
+TEST(PrimvarCompression, mergeEquivalentIndexedValues)
+{
+    std::mt19937                       random(42);
+    std::uniform_int_distribution<int> valueDistribution(0, 20);
+
+    VtVec2fArray values;
+    for (int i = 0; i < 1000; ++i) {
+        values.push_back(GfVec2f(valueDistribution(random), valueDistribution(random) * 0.5f));
+    }
+
+    // Include unassigned and out of range indices, which are kept as-is.
+    std::uniform_int_distribution<int> indexDistribution(-1, 1000);
+    VtIntArray                         indices;
+    for (int i = 0; i < 5000; ++i) {
+        indices.push_back(indexDistribution(random));
+    }
+
+    VtVec2fArray expectedValues(values);
+    VtIntArray   expectedIndices(indices);
+    referenceMergeEquivalentIndexedValues(&expectedValues, &expectedIndices);
+
+    UsdMayaUtil::MergeEquivalentIndexedValues(&values, &indices);
+
+    EXPECT_LT(values.size(), 1000u);
+    EXPECT_EQ(values, expectedValues);
+    EXPECT_EQ(indices, expectedIndices);
+}
+
+TEST(PrimvarCompression, mergeUniqueValues)
+{
+    VtVec2fArray values { GfVec2f(0.0f), GfVec2f(1.0f), GfVec2f(2.0f) };
+    VtIntArray   indices { 2, 1, 0, 2 };
+
+    UsdMayaUtil::MergeEquivalentIndexedValues(&values, &indices);
+
+    // Nothing to merge: the arrays are left untouched.
+    EXPECT_EQ(values, VtVec2fArray({ GfVec2f(0.0f), GfVec2f(1.0f), GfVec2f(2.0f) }));
+    EXPECT_EQ(indices, VtIntArray({ 2, 1, 0, 2 }));
+}
+
+TEST(PrimvarCompression, compressFaceVaryingPrimvarIndices)
+{
+    const Grid grid(3, 4);
+    const int  numFaceVertices = static_cast<int>(grid.faceVertexIndices.size());
+
+    // Constant.
+    TfToken    interpolation;
+    VtIntArray indices(numFaceVertices, 7);
+    compress(grid, &interpolation, &indices);
+    EXPECT_EQ(interpolation, UsdGeomTokens->constant);
+    EXPECT_EQ(indices, VtIntArray({ 7 }));
+
+    // Uniform.
+    indices.clear();
+    for (int fvi = 0; fvi < numFaceVertices; ++fvi) {
+        indices.push_back(fvi / 4);
+    }
+    compress(grid, &interpolation, &indices);
+    EXPECT_EQ(interpolation, UsdGeomTokens->uniform);
+    EXPECT_EQ(indices, identityIndices(grid.faceVertexCounts.size()));
+
+    // Vertex.
+    indices.clear();
+    for (int vertex : grid.faceVertexIndices) {
+        indices.push_back(vertex);
+    }
+    compress(grid, &interpolation, &indices);
+    EXPECT_EQ(interpolation, UsdGeomTokens->vertex);
+    EXPECT_EQ(indices, identityIndices(grid.numVertices));
+
+    // Face-varying.
+    indices = identityIndices(numFaceVertices);
+    compress(grid, &interpolation, &indices);
+    EXPECT_EQ(interpolation, UsdGeomTokens->faceVarying);
+    EXPECT_EQ(indices, identityIndices(numFaceVertices));
+}
+
+TEST(PrimvarCompression, compressFaceVaryingPrimvarIndicesOfMesh)
+{
+    const int  numColumns = 4;
+    const Grid grid(3, numColumns);
+    const int  numFaceVertices = static_cast<int>(grid.faceVertexIndices.size());
+
+    MFnMesh       mesh;
+    const MObject meshData = createGridMesh(grid, numColumns, mesh);
+    ASSERT_EQ(mesh.numFaceVertices(), numFaceVertices);
+
+    VtIntArray uniformIndices;
+    for (int fvi = 0; fvi < numFaceVertices; ++fvi) {
+        uniformIndices.push_back(fvi / 4);
+    }
+    VtIntArray vertexIndices;
+    for (int vertex : grid.faceVertexIndices) {
+        vertexIndices.push_back(vertex);
+    }
+
+    // The mesh overload gives the same results as the array overload.
+    const std::vector<std::pair<TfToken, VtIntArray>> cases {
+        { UsdGeomTokens->constant, VtIntArray(numFaceVertices, 7) },
+        { UsdGeomTokens->uniform, uniformIndices },
+        { UsdGeomTokens->vertex, vertexIndices },
+        { UsdGeomTokens->faceVarying, identityIndices(numFaceVertices) },
+    };
+    for (const auto& compressionCase : cases) {
+        TfToken    expectedInterpolation;
+        VtIntArray expectedIndices(compressionCase.second);
+        compress(grid, &expectedInterpolation, &expectedIndices);
+
+        TfToken    interpolation;
+        VtIntArray indices(compressionCase.second);
+        UsdMayaUtil::CompressFaceVaryingPrimvarIndices(mesh, &interpolation, &indices);
+
+        EXPECT_EQ(interpolation, compressionCase.first);
+        EXPECT_EQ(interpolation, expectedInterpolation);
+        EXPECT_EQ(indices, expectedIndices);
+    }
+}
+
+// Only run by the testPrimvarCompressionPerformance test.
+TEST(PrimvarCompression, DISABLED_benchmark)
+{
+    // Large enough to be processed in parallel.
+    const int  numRows = 512;
+    const int  numColumns = 512;
+    const Grid grid(numRows, numColumns);
+
+    VtVec2fArray uvs;
+    makeGridUVs(grid, numColumns, 16, &uvs);
+    const VtIntArray uvIndices = identityIndices(uvs.size());
+
+    VtVec2fArray expectedUVs(uvs);
+    VtIntArray   expectedIndices(uvIndices);
+    TfToken      expectedInterpolation;
+    const double referenceMs = milliseconds([&]() {
+        referenceMergeEquivalentIndexedValues(&expectedUVs, &expectedIndices);
+        referenceCompressFaceVaryingPrimvarIndices(grid, &expectedInterpolation, &expectedIndices);
+    });
+
+    VtVec2fArray mergedUVs(uvs);
+    VtIntArray   indices(uvIndices);
+    TfToken      interpolation;
+    const double arrayMs = milliseconds([&]() {
+        UsdMayaUtil::MergeEquivalentIndexedValues(&mergedUVs, &indices);
+        compress(grid, &interpolation, &indices);
+    });
+
+    EXPECT_EQ(mergedUVs, expectedUVs);
+    EXPECT_EQ(indices, expectedIndices);
+    EXPECT_EQ(interpolation, expectedInterpolation);
+
+    EXPECT_LT(arrayMs, referenceMs)
+        << "Merging and compressing " << uvs.size() << " face-varying UVs";
+}
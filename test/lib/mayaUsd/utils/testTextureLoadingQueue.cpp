@@ -0,0 +1,105 @@
+//
+// Copyright 2024 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include <mayaUsd/render/vp2RenderDelegate/textureLoadingQueue.h>
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+namespace {
+
+// Same values as HdVP2Material::TextureLoadingPriority.
+const int kHidden = 0;
+const int kVisible = 1;
+const int kSelected = 2;
+
+std::vector<std::string> popAll(HdVP2TextureLoadingQueue& queue)
+{
+    std::vector<std::string> paths;
+    std::string              path;
+    while (queue.Pop(&path)) {
+        paths.push_back(path);
+    }
+    return paths;
+}
+
+} // namespace
+
+TEST(TextureLoadingQueue, priorityOrder)
+{
+    HdVP2TextureLoadingQueue queue;
+    EXPECT_TRUE(queue.IsEmpty());
+
+    EXPECT_TRUE(queue.Push("hidden1", kHidden));
+    EXPECT_TRUE(queue.Push("visible1", kVisible));
+    EXPECT_TRUE(queue.Push("selected1", kSelected));
+    EXPECT_TRUE(queue.Push("hidden2", kHidden));
+    EXPECT_TRUE(queue.Push("visible2", kVisible));
+    EXPECT_TRUE(queue.Push("selected2", kSelected));
+    EXPECT_EQ(queue.GetSize(), 6u);
+
+    // Highest priority first, then first queued first.
+    EXPECT_EQ(
+        popAll(queue),
+        std::vector<std::string>(
+            { "selected1", "selected2", "visible1", "visible2", "hidden1", "hidden2" }));
+    EXPECT_TRUE(queue.IsEmpty());
+}
+
+TEST(TextureLoadingQueue, changePriority)
+{
+    HdVP2TextureLoadingQueue queue;
+    queue.Push("a", kVisible);
+    queue.Push("b", kVisible);
+    queue.Push("c", kVisible);
+    queue.Push("d", kHidden);
+
+    // Selecting moves a texture up the queue, deselecting moves it back down.
+    EXPECT_FALSE(queue.Push("c", kSelected));
+    EXPECT_FALSE(queue.Push("a", kSelected));
+    EXPECT_FALSE(queue.Push("a", kVisible));
+    EXPECT_FALSE(queue.Push("d", kVisible));
+    EXPECT_EQ(queue.GetSize(), 4u);
+
+    // A texture keeps its rank among the textures of its new priority.
+    EXPECT_EQ(popAll(queue), std::vector<std::string>({ "c", "a", "b", "d" }));
+}
+
+TEST(TextureLoadingQueue, popAndClear)
+{
+    HdVP2TextureLoadingQueue queue;
+    std::string              path;
+    EXPECT_FALSE(queue.Pop(&path));
+
+    queue.Push("a", kHidden);
+    queue.Push("b", kSelected);
+    EXPECT_TRUE(queue.IsQueued("a"));
+    EXPECT_TRUE(queue.Pop(&path));
+    EXPECT_EQ(path, "b");
+    EXPECT_FALSE(queue.IsQueued("b"));
+
+    // Once popped, a texture is queued again as a new one.
+    EXPECT_TRUE(queue.Push("b", kHidden));
+    EXPECT_EQ(popAll(queue), std::vector<std::string>({ "a", "b" }));
+
+    queue.Push("c", kVisible);
+    queue.Clear();
+    EXPECT_TRUE(queue.IsEmpty());
+    EXPECT_FALSE(queue.IsQueued("c"));
+}
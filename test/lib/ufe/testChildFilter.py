@@ -18,6 +18,7 @@
 
 import fixturesUtils
 import mayaUtils
+import ufeUtils
 
 from maya import cmds
 from maya import standalone
@@ -156,6 +157,46 @@ class ChildFilterTestCase(unittest.TestCase):
         self.assertEqual(1, len(children))
         self.assertIn(ballSetItem, children)
 
+    @unittest.skipUnless(ufeUtils.ufeFeatureSetVersion() >= 4, 'Test only available in UFE v4 or greater')
+    def testHasChildrenAfterActivation(self):
+        mayaUtils.openGroupBallsScene()
+        cmds.select(clear=True)
+
+        # hasChildren() results are cached, make sure they follow the
+        # activation of the children.
+        propsPathStr = '|transform1|proxyShape1,/Ball_set/Props'
+        propsItem = ufe.Hierarchy.createItem(ufe.PathString.path(propsPathStr))
+        propsHier = ufe.Hierarchy.hierarchy(propsItem)
+        self.assertTrue(propsHier.hasChildren())
+
+        def setBallActive(index, active):
+            ballPathStr = propsPathStr + '/Ball_%d' % index
+            mayaUsd.ufe.ufePathToPrim(ballPathStr).SetActive(active)
+
+        for index in range(1, 6):
+            setBallActive(index, False)
+            self.assertTrue(propsHier.hasChildren())
+
+        setBallActive(6, False)
+        self.assertFalse(propsHier.hasChildren())
+        self.assertEqual(0, len(propsHier.children()))
+
+        setBallActive(3, True)
+        self.assertTrue(propsHier.hasChildren())
+        self.assertEqual(1, len(propsHier.children()))
+
+        # Same for the proxy shape and the root prim children.
+        psItem = ufe.Hierarchy.createItem(ufe.PathString.path('|transform1|proxyShape1'))
+        psHier = ufe.Hierarchy.hierarchy(psItem)
+        self.assertTrue(psHier.hasChildren())
+
+        ballSetPathStr = '|transform1|proxyShape1,/Ball_set'
+        mayaUsd.ufe.ufePathToPrim(ballSetPathStr).SetActive(False)
+        self.assertFalse(psHier.hasChildren())
+
+        mayaUsd.ufe.ufePathToPrim(ballSetPathStr).SetActive(True)
+        self.assertTrue(psHier.hasChildren())
+
     def testUnload(self):
         mayaUtils.openTopLayerScene()
 
@@ -21,9 +21,11 @@ import fixturesUtils
 from maya import standalone
 from maya import cmds
 import mayaUtils
+import ufeUtils
 
-from pxr import Usd
+from pxr import Sdf, Usd, UsdGeom
 import ufe
+import usdUfe
 
 from mayaUsd import lib as mayaUsdLib
 
@@ -62,6 +64,15 @@ class TestObserver(ufe.Observer):
     def notifications(self):
         return [self.add, self.delete, self.pathChange, self.subtreeInvalidate, self.composite]
 
+class TestTransform3dObserver(ufe.Observer):
+    def __init__(self):
+        self.transform3d = 0
+        super(TestTransform3dObserver, self).__init__()
+
+    def __call__(self, notification):
+        if isinstance(notification, ufe.Transform3dChanged):
+            self.transform3d += 1
+
 class UFEObservableSceneTest(unittest.TestCase):
     
     pluginsLoaded = False
@@ -164,6 +175,71 @@ class UFEObservableSceneTest(unittest.TestCase):
         sessionLayer.Clear()
         self.checkNotifications(snObs, [1,1,0,0,0,0])
         
+    @unittest.skipUnless(ufeUtils.ufeFeatureSetVersion() >= 4, 'Batching is only available in UFE v4 or greater')
+    def testBatchedNotifications(self):
+
+        cmds.file(new=True, force=True)
+
+        _, stage = mayaUtils.createProxyAndStage()
+
+        snObs = TestObserver()
+        ufe.Scene.addObserver(snObs)
+
+        previousBatchSize = usdUfe.sceneNotificationBatchSize()
+        try:
+            # Ten added prims are sent in composite notifications of at most
+            # four changes.
+            usdUfe.setSceneNotificationBatchSize(4)
+            with Sdf.ChangeBlock():
+                for i in range(10):
+                    stage.DefinePrim('/prim%d' % i, 'Xform')
+            self.checkNotifications(snObs, [0,0,0,0,3])
+
+            # The added descendants of an added prim are collapsed into it.
+            with Sdf.ChangeBlock():
+                stage.DefinePrim('/group', 'Xform')
+                for i in range(10):
+                    stage.DefinePrim('/group/prim%d' % i, 'Xform')
+            self.checkNotifications(snObs, [0,0,0,0,4])
+
+            # Without batching, every change is notified on its own.
+            usdUfe.setSceneNotificationBatchSize(0)
+            with Sdf.ChangeBlock():
+                for i in range(10):
+                    stage.DefinePrim('/other%d' % i, 'Xform')
+            self.checkNotifications(snObs, [10,0,0,0,4])
+        finally:
+            usdUfe.setSceneNotificationBatchSize(previousBatchSize)
+            ufe.Scene.removeObserver(snObs)
+
+    @unittest.skipUnless(ufeUtils.ufeFeatureSetVersion() >= 4, 'Batching is only available in UFE v4 or greater')
+    def testBatchedNotificationsKeepTransformChanges(self):
+
+        cmds.file(new=True, force=True)
+
+        proxyShapePath, stage = mayaUtils.createProxyAndStage()
+
+        xform = UsdGeom.Xform.Define(stage, '/xform')
+        translateOp = xform.AddTranslateOp()
+        translateOp.Set((1, 2, 3))
+
+        xformItem = ufeUtils.createItem(proxyShapePath + ',/xform')
+        t3dObs = TestTransform3dObserver()
+        ufe.Transform3d.addObserver(xformItem, t3dObs)
+
+        previousBatchSize = usdUfe.sceneNotificationBatchSize()
+        try:
+            # The prim is resynced by the applied schema, its own transform
+            # change must not be collapsed into the resync.
+            usdUfe.setSceneNotificationBatchSize(4)
+            with Sdf.ChangeBlock():
+                UsdGeom.ModelAPI.Apply(xform.GetPrim())
+                translateOp.Set((4, 5, 6))
+            self.assertGreater(t3dObs.transform3d, 0)
+        finally:
+            usdUfe.setSceneNotificationBatchSize(previousBatchSize)
+            ufe.Transform3d.removeObserver(xformItem, t3dObs)
+
 
 if __name__ == '__main__':
     unittest.main(verbosity=2)
@@ -16,13 +16,14 @@
 #
 
 
+import json
 import os
 import unittest
 
 import fixturesUtils
 from maya import cmds
 from maya import standalone
-from pxr import Usd
+from pxr import Sdf, Usd
 
 
 class testUsdExportAnimation(unittest.TestCase):
@@ -64,6 +65,161 @@ class testUsdExportAnimation(unittest.TestCase):
             num_samples = attr.GetNumTimeSamples()
             self.assertEqual(num_samples, int(not state))
 
+    def testExportTimeSampleTolerance(self):
+        """Test that time samples reconstructible by linear interpolation are
+           dropped when a time sample tolerance is given."""
+        cmds.file(new=True, force=True)
+        cube, _ = cmds.polyCube(name="Cube")
+        cmds.setKeyframe(cube, v=0, at='translateX', time=1, itt='linear', ott='linear')
+        cmds.setKeyframe(cube, v=9, at='translateX', time=10, itt='linear', ott='linear')
+        cmds.setKeyframe(cube, v=0, at='translateX', time=20, itt='linear', ott='linear')
+
+        for tolerance, expectedSamples in ((0.0, 20), (1e-4, 3)):
+            path = os.path.join(self.temp_dir, "timeSampleTolerance{}.usda".format(expectedSamples))
+            cmds.mayaUSDExport(f=path, frameRange=(1, 20), timeSampleTolerance=tolerance)
+
+            stage = Usd.Stage.Open(path)
+            attr = stage.GetPrimAtPath("/Cube").GetAttribute("xformOp:translate")
+            self.assertEqual(attr.GetNumTimeSamples(), expectedSamples)
+            self.assertEqual(attr.GetTimeSamples()[-1], 20)
+            for frame in range(1, 21):
+                expected = frame - 1 if frame <= 10 else 20 - frame
+                self.assertAlmostEqual(attr.Get(frame)[0], expected, places=3)
+
+    def testExportStreamingChunkSize(self):
+        """Test that time samples streamed to value clips resolve to the same
+           values as when they are written to the root layer."""
+        cmds.file(new=True, force=True)
+        cube, _ = cmds.polyCube(name="Cube")
+        cmds.setKeyframe(cube, v=0, at='translateX', time=1, itt='linear', ott='linear')
+        cmds.setKeyframe(cube, v=19, at='translateX', time=20, itt='linear', ott='linear')
+
+        path = os.path.join(self.temp_dir, "streamingChunkSize.usda")
+        cmds.mayaUSDExport(f=path, frameRange=(1, 20), streamingChunkSize=5)
+
+        for clip in range(4):
+            clipPath = os.path.join(self.temp_dir, "streamingChunkSize.clip{:04d}.usdc".format(clip))
+            self.assertTrue(os.path.exists(clipPath))
+        self.assertTrue(os.path.exists(os.path.join(self.temp_dir, "streamingChunkSize.manifest.usdc")))
+
+        stage = Usd.Stage.Open(path)
+        prim = stage.GetPrimAtPath("/Cube")
+        self.assertEqual(len(Usd.ClipsAPI(prim).GetClipAssetPaths()), 4)
+
+        rootLayer = stage.GetRootLayer()
+        self.assertEqual(rootLayer.GetNumTimeSamplesForPath("/Cube.xformOp:translate"), 0)
+
+        attr = prim.GetAttribute("xformOp:translate")
+        self.assertEqual(attr.GetTimeSamples()[0], 1)
+        self.assertEqual(attr.GetTimeSamples()[-1], 20)
+        for frame in range(1, 21):
+            self.assertAlmostEqual(attr.Get(frame)[0], cmds.getAttr(cube + '.translateX', time=frame), places=3)
+
+        # Consecutive clips overlap, so values interpolate between them.
+        firstClip = Sdf.Layer.FindOrOpen(
+            os.path.join(self.temp_dir, "streamingChunkSize.clip0000.usdc"))
+        self.assertEqual(firstClip.ListTimeSamplesForPath("/Cube.xformOp:translate")[-1], 6)
+        self.assertAlmostEqual(attr.Get(5.5)[0], 4.5, places=3)
+
+        # The manifest provides the default value of the clips lacking samples.
+        manifest = Sdf.Layer.FindOrOpen(
+            os.path.join(self.temp_dir, "streamingChunkSize.manifest.usdc"))
+        for attrPath in ("/Cube.xformOp:translate", "/Cube/CubeShape.points"):
+            rootAttr = rootLayer.GetAttributeAtPath(attrPath)
+            manifestAttr = manifest.GetAttributeAtPath(attrPath)
+            if manifestAttr and rootAttr.HasDefaultValue():
+                self.assertEqual(manifestAttr.default, rootAttr.default)
+
+    def testExportParallelWrite(self):
+        """Test that writing the frames of the prim writers in parallel gives
+           the same result as writing them serially."""
+        cmds.file(new=True, force=True)
+        root = cmds.group(empty=True, name="root")
+        for name in ("CubeA", "CubeB"):
+            cube, cubeHistory = cmds.polyCube(name=name)
+            cmds.parent(cube, root)
+            cmds.setKeyframe(cubeHistory, v=1, at='width', time=1)
+            cmds.setKeyframe(cubeHistory, v=3, at='width', time=10)
+            cmds.setKeyframe(cube, v=0, at='translateY', time=1)
+            cmds.setKeyframe(cube, v=5, at='translateY', time=10)
+        cmds.setKeyframe(root, v=0, at='rotateY', time=1)
+        cmds.setKeyframe(root, v=90, at='rotateY', time=10)
+
+        layers = []
+        for parallel in (False, True):
+            path = os.path.join(
+                self.temp_dir, "parallelWrite{}.usda".format("On" if parallel else "Off"))
+            cmds.mayaUSDExport(f=path, frameRange=(1, 10), defaultMeshScheme='none',
+                               parallelWrite=parallel)
+            layers.append(Sdf.Layer.FindOrOpen(path))
+
+        serialLayer, parallelLayer = layers
+        specPaths = []
+        serialLayer.Traverse(Sdf.Path.absoluteRootPath, specPaths.append)
+        attrPaths = [path for path in specPaths if path.IsPropertyPath()]
+        self.assertIn(Sdf.Path("/root/CubeA/CubeAShape.points"), attrPaths)
+        self.assertIn(Sdf.Path("/root/CubeB/CubeBShape.normals"), attrPaths)
+
+        for attrPath in attrPaths:
+            serialAttr = serialLayer.GetAttributeAtPath(attrPath)
+            if not serialAttr:
+                continue
+            parallelAttr = parallelLayer.GetAttributeAtPath(attrPath)
+            self.assertTrue(parallelAttr, attrPath)
+            self.assertEqual(parallelAttr.default, serialAttr.default, attrPath)
+            times = serialLayer.ListTimeSamplesForPath(attrPath)
+            self.assertEqual(parallelLayer.ListTimeSamplesForPath(attrPath), times, attrPath)
+            for time in times:
+                self.assertEqual(
+                    parallelLayer.QueryTimeSample(attrPath, time),
+                    serialLayer.QueryTimeSample(attrPath, time),
+                    attrPath)
+
+    def testExportPerfReport(self):
+        """Test that the performance report times the export job phases and
+           the prim writers."""
+        cmds.file(new=True, force=True)
+        cube, _ = cmds.polyCube(name="Cube")
+        cmds.setKeyframe(cube, v=0, at='translateX', time=1)
+        cmds.setKeyframe(cube, v=9, at='translateX', time=10)
+
+        path = os.path.join(self.temp_dir, "perfReport.usda")
+        reportPath = os.path.join(self.temp_dir, "perfReport.json")
+        cmds.mayaUSDExport(f=path, frameRange=(1, 10), perfReport=reportPath)
+
+        with open(reportPath) as reportFile:
+            report = json.load(reportFile)
+
+        totals = report['totals']
+        self.assertEqual(totals['UsdMaya_WriteJob::_BeginWriting']['count'], 1)
+        self.assertEqual(totals['UsdMaya_WriteJob::_WriteFrame']['count'], 10)
+        self.assertEqual(totals['UsdMaya_WriteJob::_FinishWriting']['count'], 1)
+        self.assertTrue(any(name.endswith('MeshWriter::Write') for name in totals))
+
+        phaseNames = set(event['name'] for event in report['traceEvents'])
+        self.assertIn('UsdMaya_WriteJob::_WriteFrame', phaseNames)
+
+    def testExportTimeSampleToleranceKeepsExtents(self):
+        """Test that the extents keep all their time samples when the points
+           they bound drop the interpolated ones."""
+        cmds.file(new=True, force=True)
+        _, polyCube = cmds.polyCube(name="Cube")
+        cmds.setKeyframe(polyCube, v=1, at='height', time=1, itt='linear', ott='linear')
+        cmds.setKeyframe(polyCube, v=10, at='height', time=10, itt='linear', ott='linear')
+        cmds.setKeyframe(polyCube, v=1, at='height', time=20, itt='linear', ott='linear')
+
+        path = os.path.join(self.temp_dir, "timeSampleToleranceExtents.usda")
+        cmds.mayaUSDExport(f=path, frameRange=(1, 20), timeSampleTolerance=1e-4)
+
+        stage = Usd.Stage.Open(path)
+        prim = stage.GetPrimAtPath("/Cube")
+        self.assertEqual(prim.GetAttribute("points").GetNumTimeSamples(), 3)
+        extent = prim.GetAttribute("extent")
+        self.assertEqual(extent.GetNumTimeSamples(), 20)
+        for frame in range(1, 21):
+            height = frame if frame <= 10 else 10 - 0.9 * (frame - 10)
+            self.assertAlmostEqual(extent.Get(frame)[1][1], height / 2.0, places=3)
+
     def testExportAnimatedCompundValue(self):
         """MayaUSD Issue #1712: Test that animated custom compound attributes
            on a mesh are exported."""
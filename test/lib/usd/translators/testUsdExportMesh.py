@@ -162,6 +162,25 @@ class testUsdExportMesh(unittest.TestCase):
         self.assertAlmostEqual(creaseSharpnesses, expectedCreaseSharpnesses,
             places=3)
 
+    def testExportAnimatedCreases(self):
+        """Creases are only authored at the default time, so they must be
+           authored again when they change while the topology does not."""
+        cmds.file(new=True, force=True)
+        cube, _ = cmds.polyCube(name="AnimatedCreases")
+        cmds.polyCrease(cube + '.e[0]', value=1.0)
+        creaseNode = cmds.ls(cmds.listHistory(cube), type='polyCrease')[0]
+        cmds.setKeyframe(creaseNode, at='crease[0]', v=1.0, time=1)
+        cmds.setKeyframe(creaseNode, at='crease[0]', v=4.0, time=5)
+
+        usdFile = os.path.abspath('UsdExportMesh_animatedCreases.usda')
+        cmds.mayaUSDExport(mergeTransformAndShape=True, file=usdFile,
+            shadingMode='none', frameRange=(1, 5))
+
+        stage = Usd.Stage.Open(usdFile)
+        m = UsdGeom.Mesh.Get(stage, '/AnimatedCreases')
+        self.assertEqual(m.GetCreaseLengthsAttr().Get(), Vt.IntArray([2]))
+        self.assertAlmostEqual(m.GetCreaseSharpnessesAttr().Get()[0], 4.0, places=3)
+
     def testSidedness(self):
         for sidedness in ('single', 'double', 'derived'):
             for doubleSided in (False, True):
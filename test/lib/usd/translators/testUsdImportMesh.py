@@ -33,8 +33,8 @@ class testUsdImportMesh(unittest.TestCase):
     def setUpClass(cls):
         inputPath = fixturesUtils.readOnlySetUpClass(__file__)
 
-        usdFile = os.path.join(inputPath, "UsdImportMeshTest", "Mesh.usda")
-        cmds.usdImport(file=usdFile, shadingMode=[['none', 'default'], ])
+        cls.usdFile = os.path.join(inputPath, "UsdImportMeshTest", "Mesh.usda")
+        cmds.usdImport(file=cls.usdFile, shadingMode=[['none', 'default'], ])
 
     @classmethod
     def tearDownClass(cls):
@@ -93,5 +93,32 @@ class testUsdImportMesh(unittest.TestCase):
     def testImportLeftHandedSubdiv(self):
         self.verifySubdivCommonAttributes('LeftHandedSubdivMeshShape')
 
+    def testImportParallelRead(self):
+        """
+        Tests that prefetching the mesh data on worker threads gives the same
+        meshes as the serial import.
+        """
+        parent = cmds.group(empty=True, name='ParallelRead')
+        cmds.usdImport(file=self.usdFile, shadingMode=[['none', 'default'], ],
+            parallelRead=True, parent=parent)
+
+        for mesh in ['PolyMesh', 'LeftHandedPolyMesh', 'SubdivMesh']:
+            serialMesh = '|World|%s|%sShape' % (mesh, mesh)
+            parallelMesh = '|ParallelRead' + serialMesh
+            self.assertTrue(cmds.objExists(parallelMesh))
+
+            self.assertEqual(
+                cmds.polyEvaluate(parallelMesh, face=True),
+                cmds.polyEvaluate(serialMesh, face=True))
+            self.assertEqual(
+                cmds.getAttr(parallelMesh + '.vt[*]'),
+                cmds.getAttr(serialMesh + '.vt[*]'))
+            self.assertEqual(
+                cmds.polyInfo(parallelMesh, faceToVertex=True),
+                cmds.polyInfo(serialMesh, faceToVertex=True))
+
+        # Keep the short shape names used by the other tests unambiguous.
+        cmds.delete(parent)
+
 if __name__ == '__main__':
     unittest.main(verbosity=2)
@@ -15,7 +15,7 @@
 # limitations under the License.
 #
 import unittest, os
-from pxr import Gf, Usd, UsdSkel
+from pxr import Gf, Usd, UsdGeom, UsdSkel
 
 from maya import cmds
 from maya import standalone
@@ -225,6 +225,26 @@ class testUsdImportSkeleton(unittest.TestCase):
                 _GfMatrixToList(skelRestXforms[i].GetInverse())))
 
 
+    def _ValidateSkinWeights(self, skinClusterName, meshName, jointNames,
+                             usdSkinningQuery):
+
+        numPoints = cmds.polyEvaluate(meshName, vertex=True)
+        indices, weights = usdSkinningQuery.ComputeVaryingJointInfluences(numPoints)
+        numInfluences = len(indices) // numPoints
+
+        for pt in range(numPoints):
+            # Influences referencing the same joint add up.
+            expectedWeights = [0.0] * len(jointNames)
+            for c in range(pt * numInfluences, (pt + 1) * numInfluences):
+                expectedWeights[indices[c]] += weights[c]
+
+            vertex = "%s.vtx[%d]" % (meshName, pt)
+            mayaWeights = [
+                cmds.skinPercent(skinClusterName, vertex, transform=jointName, query=True)
+                for jointName in jointNames]
+            self.assertTrue(_ArraysAreClose(mayaWeights, expectedWeights))
+
+
     def test_SkelImport(self):
         cmds.file(new=True, force=True)
 
@@ -275,6 +295,58 @@ class testUsdImportSkeleton(unittest.TestCase):
             usdSkelQuery=skelQuery,
             usdSkinningQuery=skinningQuery)
 
+        self._ValidateSkinWeights(
+            skinClusterName="skinCluster_{}".format(meshPrim.GetName()),
+            meshName=meshPrim.GetName(),
+            jointNames=jointNames,
+            usdSkinningQuery=skinningQuery)
+
+    def test_SkelImportConstantInfluences(self):
+        """
+        Test that joint influences shared by all the points are applied to every point.
+        """
+        cmds.file(new=True, force=True)
+
+        path = os.path.join(cmds.internalVar(utd=1), "skelConstantInfluences.usda")
+        stage = Usd.Stage.CreateNew(path)
+
+        UsdSkel.Root.Define(stage, "/Root")
+        skel = UsdSkel.Skeleton.Define(stage, "/Root/Skeleton")
+        skel.CreateJointsAttr(["joint1", "joint1/joint2", "joint1/joint2/joint3"])
+        skel.CreateBindTransformsAttr([Gf.Matrix4d(1)] * 3)
+        skel.CreateRestTransformsAttr([Gf.Matrix4d(1)] * 3)
+
+        mesh = UsdGeom.Mesh.Define(stage, "/Root/Plane")
+        mesh.CreatePointsAttr([(0, 0, 0), (1, 0, 0), (1, 0, 1), (0, 0, 1)])
+        mesh.CreateFaceVertexCountsAttr([4])
+        mesh.CreateFaceVertexIndicesAttr([0, 1, 2, 3])
+
+        binding = UsdSkel.BindingAPI.Apply(mesh.GetPrim())
+        binding.CreateSkeletonRel().SetTargets([skel.GetPath()])
+        binding.CreateGeomBindTransformAttr(Gf.Matrix4d(1))
+        # The first joint is referenced twice, its weights add up.
+        binding.CreateJointIndicesPrimvar(constant=True, elementSize=3).Set([0, 2, 0])
+        binding.CreateJointWeightsPrimvar(constant=True, elementSize=3).Set([0.25, 0.5, 0.25])
+        stage.GetRootLayer().Save()
+
+        cmds.mayaUSDImport(file=path, primPath="/Root")
+
+        skelCache = UsdSkel.Cache()
+        skelCache.Populate(UsdSkel.Root(stage.GetPrimAtPath("/Root")), Usd.PrimDefaultPredicate)
+        skinningQuery = skelCache.GetSkinningQuery(mesh.GetPrim())
+        self.assertTrue(skinningQuery.IsRigidlyDeformed())
+
+        self._ValidateSkinWeights(
+            skinClusterName="skinCluster_Plane",
+            meshName="Plane",
+            jointNames=["joint1", "joint2", "joint3"],
+            usdSkinningQuery=skinningQuery)
+
+        for pt in range(4):
+            self.assertAlmostEqual(
+                cmds.skinPercent("skinCluster_Plane", "Plane.vtx[%d]" % pt,
+                                 transform="joint1", query=True), 0.5)
+
     def test_SkelImportStaticTimeSampledMesh(self):
         """
         Test that an import of skinned geometry with a single, static time sample uses the same code path
@@ -3,6 +3,8 @@
 
 #include <gtest/gtest.h>
 
+#include <limits>
+
 static inline float  randFloat() { return float(rand()) / RAND_MAX; }
 static inline double randDouble() { return double(rand()) / RAND_MAX; }
 
@@ -317,6 +319,133 @@ TEST(DiffCore, compareDoubleArray)
     EXPECT_FALSE(MayaUsdUtils::compareArray(a.data(), b.data(), 47, 47, 1e-5f));
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+TEST(DiffCore, isLinearInterpolationFloat)
+{
+    std::vector<float> start(47), end(47), value(47);
+    for (int i = 0; i < 47; ++i) {
+        start[i] = randFloat();
+        end[i] = randFloat();
+        value[i] = start[i] + 0.25f * (end[i] - start[i]);
+    }
+
+    // should pass
+    EXPECT_TRUE(MayaUsdUtils::isLinearInterpolation(
+        start.data(), end.data(), value.data(), 47, 0.25f, 1e-5f));
+
+    // fail when interpolating at another time
+    EXPECT_FALSE(MayaUsdUtils::isLinearInterpolation(
+        start.data(), end.data(), value.data(), 47, 0.75f, 1e-5f));
+
+    // test the remaining elements at the ends of the array
+    for (int i = 0; i < 7; ++i) {
+        // modify value at end of array
+        value[40 + i] += 1.0f;
+
+        // should now fail
+        EXPECT_FALSE(MayaUsdUtils::isLinearInterpolation(
+            start.data(), end.data(), value.data(), 47, 0.25f, 1e-5f));
+
+        // unless the tolerance is large enough
+        EXPECT_TRUE(MayaUsdUtils::isLinearInterpolation(
+            start.data(), end.data(), value.data(), 47, 0.25f, 1.5f));
+
+        value[40 + i] -= 1.0f;
+    }
+
+    // modify value in SIMD blocks
+    value[22] += 1.0f;
+    EXPECT_FALSE(MayaUsdUtils::isLinearInterpolation(
+        start.data(), end.data(), value.data(), 47, 0.25f, 1e-5f));
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+TEST(DiffCore, isLinearInterpolationDouble)
+{
+    std::vector<double> start(47), end(47), value(47);
+    for (int i = 0; i < 47; ++i) {
+        start[i] = randDouble();
+        end[i] = randDouble();
+        value[i] = start[i] + 0.25 * (end[i] - start[i]);
+    }
+
+    // should pass
+    EXPECT_TRUE(MayaUsdUtils::isLinearInterpolation(
+        start.data(), end.data(), value.data(), 47, 0.25, 1e-5));
+
+    // fail when interpolating at another time
+    EXPECT_FALSE(MayaUsdUtils::isLinearInterpolation(
+        start.data(), end.data(), value.data(), 47, 0.75, 1e-5));
+
+    // test the remaining elements at the ends of the array
+    for (int i = 0; i < 7; ++i) {
+        // modify value at end of array
+        value[40 + i] += 1.0;
+
+        // should now fail
+        EXPECT_FALSE(MayaUsdUtils::isLinearInterpolation(
+            start.data(), end.data(), value.data(), 47, 0.25, 1e-5));
+
+        // unless the tolerance is large enough
+        EXPECT_TRUE(MayaUsdUtils::isLinearInterpolation(
+            start.data(), end.data(), value.data(), 47, 0.25, 1.5));
+
+        value[40 + i] -= 1.0;
+    }
+
+    // modify value in SIMD blocks
+    value[22] += 1.0;
+    EXPECT_FALSE(MayaUsdUtils::isLinearInterpolation(
+        start.data(), end.data(), value.data(), 47, 0.25, 1e-5));
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+TEST(DiffCore, isLinearInterpolationNonFinite)
+{
+    std::vector<float>  startf(47), endf(47), valuef(47);
+    std::vector<double> startd(47), endd(47), valued(47);
+    for (int i = 0; i < 47; ++i) {
+        startf[i] = randFloat();
+        endf[i] = randFloat();
+        valuef[i] = startf[i] + 0.25f * (endf[i] - startf[i]);
+        startd[i] = randDouble();
+        endd[i] = randDouble();
+        valued[i] = startd[i] + 0.25 * (endd[i] - startd[i]);
+    }
+
+    // a NaN or infinite element in any of the arrays, in the SIMD blocks or in the remaining
+    // elements, must never be treated as interpolated
+    for (int i : { 22, 46 }) {
+        for (int array = 0; array < 3; ++array) {
+            for (double bad : { std::numeric_limits<double>::quiet_NaN(),
+                                std::numeric_limits<double>::infinity() }) {
+                float&  f = array == 0 ? startf[i] : (array == 1 ? endf[i] : valuef[i]);
+                double& d = array == 0 ? startd[i] : (array == 1 ? endd[i] : valued[i]);
+                const float  oldf = f;
+                const double oldd = d;
+                f = float(bad);
+                d = bad;
+
+                EXPECT_FALSE(MayaUsdUtils::isLinearInterpolation(
+                    startf.data(), endf.data(), valuef.data(), 47, 0.25f, 1e-5f));
+                EXPECT_FALSE(MayaUsdUtils::isLinearInterpolation(
+                    startd.data(), endd.data(), valued.data(), 47, 0.25, 1e-5));
+
+                f = oldf;
+                d = oldd;
+            }
+        }
+    }
+
+    // even with a tolerance large enough to hide any finite difference
+    valuef[3] = std::numeric_limits<float>::quiet_NaN();
+    EXPECT_FALSE(MayaUsdUtils::isLinearInterpolation(
+        startf.data(), endf.data(), valuef.data(), 47, 0.25f, 1e30f));
+    valued[3] = std::numeric_limits<double>::quiet_NaN();
+    EXPECT_FALSE(MayaUsdUtils::isLinearInterpolation(
+        startd.data(), endd.data(), valued.data(), 47, 0.25, 1e300));
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 TEST(DiffCore, compareInt8Array)
 {
@@ -0,0 +1,141 @@
+#include <mayaUsdUtils/DiffPrims.h>
+#include <mayaUsdUtils/MergePrims.h>
+
+#include <pxr/base/gf/vec3f.h>
+#include <pxr/base/vt/array.h>
+#include <pxr/usd/sdf/changeBlock.h>
+#include <pxr/usd/sdf/valueTypeName.h>
+#include <pxr/usd/usd/stage.h>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <string>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+using namespace MayaUsdUtils;
+
+namespace {
+
+// Large enough for the timings to be meaningful.
+const size_t groupCount = 32;
+const size_t meshCount = 128;
+const size_t pointCount = 1024;
+
+// Generous upper bound for each timed operation, so that only real regressions fail.
+const double budgetMilliseconds = 5000.0;
+
+const SdfPath rootPath("/Root");
+const TfToken pointsAttrName("points");
+const TfToken flagsAttrName("flags");
+
+SdfPath meshPath(size_t group, size_t mesh)
+{
+    return rootPath.AppendChild(TfToken("Group_" + std::to_string(group)))
+        .AppendChild(TfToken("Mesh_" + std::to_string(mesh)));
+}
+
+UsdStageRefPtr createLargeStage()
+{
+    auto stage = UsdStage::CreateInMemory();
+
+    SdfChangeBlock changeBlock;
+    stage->DefinePrim(rootPath, TfToken("Xform"));
+    for (size_t group = 0; group < groupCount; ++group) {
+        for (size_t mesh = 0; mesh < meshCount; ++mesh) {
+            auto prim = stage->DefinePrim(meshPath(group, mesh), TfToken("Mesh"));
+
+            VtArray<GfVec3f> points(pointCount);
+            for (size_t i = 0; i < pointCount; ++i)
+                points[i] = GfVec3f(float(i), float(group), float(mesh));
+            prim.CreateAttribute(pointsAttrName, SdfValueTypeNames->Point3fArray).Set(points);
+
+            VtArray<bool> flags(pointCount, true);
+            prim.CreateAttribute(flagsAttrName, SdfValueTypeNames->BoolArray).Set(flags);
+        }
+    }
+
+    return stage;
+}
+
+void offsetLastPoint(const UsdStageRefPtr& stage)
+{
+    auto attr = stage->GetPrimAtPath(meshPath(groupCount - 1, meshCount - 1))
+                    .GetAttribute(pointsAttrName);
+
+    VtArray<GfVec3f> points;
+    attr.Get(&points);
+    points[pointCount - 1][0] += 1.0f;
+    attr.Set(points);
+}
+
+template <class FUNC> void expectWithinBudget(const char* name, FUNC&& func)
+{
+    const auto start = std::chrono::steady_clock::now();
+    func();
+    const std::chrono::duration<double, std::milli> elapsed
+        = std::chrono::steady_clock::now() - start;
+    EXPECT_LT(elapsed.count(), budgetMilliseconds)
+        << name << ": " << groupCount * meshCount << " prims with " << pointCount
+        << " points each";
+}
+
+} // namespace
+
+//----------------------------------------------------------------------------------------------------------------------
+TEST(DiffPrimsPerformance, comparePrimsLargeHierarchy)
+{
+    auto baselineStage = createLargeStage();
+    auto modifiedStage = createLargeStage();
+
+    auto baselinePrim = baselineStage->GetPrimAtPath(rootPath);
+    auto modifiedPrim = modifiedStage->GetPrimAtPath(rootPath);
+
+    DiffResult result = DiffResult::Differ;
+    expectWithinBudget(
+        "comparePrims", [&]() { result = comparePrims(modifiedPrim, baselinePrim); });
+    EXPECT_EQ(result, DiffResult::Same);
+
+    // Only the very last point of the very last mesh differs, so the quick diff has to
+    // compare everything before finding it.
+    offsetLastPoint(modifiedStage);
+
+    DiffResult quickDiff = DiffResult::Same;
+    expectWithinBudget("comparePrims quick diff", [&]() {
+        comparePrims(modifiedPrim, baselinePrim, &quickDiff);
+    });
+    EXPECT_EQ(quickDiff, DiffResult::Differ);
+
+    expectWithinBudget(
+        "comparePrims full diff", [&]() { result = comparePrims(modifiedPrim, baselinePrim); });
+    EXPECT_EQ(result, DiffResult::Differ);
+}
+
+TEST(DiffPrimsPerformance, mergePrimsLargeHierarchy)
+{
+    auto baselineStage = createLargeStage();
+    auto modifiedStage = createLargeStage();
+    offsetLastPoint(modifiedStage);
+
+    MergePrimsOptions options;
+    options.mergeChildren = true;
+    options.verbosity = MergeVerbosity::None;
+
+    bool merged = false;
+    expectWithinBudget("mergePrims", [&]() {
+        merged = mergePrims(
+            modifiedStage,
+            modifiedStage->GetRootLayer(),
+            rootPath,
+            baselineStage,
+            baselineStage->GetRootLayer(),
+            rootPath,
+            options);
+    });
+    EXPECT_TRUE(merged);
+
+    EXPECT_EQ(
+        comparePrims(
+            modifiedStage->GetPrimAtPath(rootPath), baselineStage->GetPrimAtPath(rootPath)),
+        DiffResult::Same);
+}